@@ -23,7 +23,9 @@
 #ifndef MODELFITTING_DATAVSMODELRESIDUALS_H
 #define	MODELFITTING_DATAVSMODELRESIDUALS_H
 
+#include <iterator>
 #include <memory>
+#include <vector>
 #include "ElementsKernel/Exception.h"
 #include "ModelFitting/Engine/ResidualBlockProvider.h"
 #include "ModelFitting/Engine/DataVsModelInputTraits.h"
@@ -65,6 +67,14 @@ namespace ModelFitting {
  * of the DataVsModelInputTraits (see the DataVsModelInputTraits documentation
  * for more details).
  * 
+ * Data points with a weight of zero do not contribute to the cost, as all the
+ * comparators scale the difference by the weight. They are dropped when the
+ * instance is created: only the values of the data and weight at the
+ * remaining positions are kept, and the residual block has one entry per
+ * contributing point. This avoids rendering the comparison, and growing the
+ * Jacobian, for the masked pixels and the pixels outside non-rectangular
+ * fitting windows.
+ * 
  * @tparam DataType
  *    The type used for accessing the data point values
  * @tparam ModelType
@@ -110,7 +120,7 @@ public:
   virtual ~DataVsModelResiduals();
   
   /// Returns the number of residuals produced by this residual provider (same
-  /// as the number of data points)
+  /// as the number of data points with a weight different from zero)
   std::size_t numberOfResiduals() const override;
   
   /// Updates the values where the iterator points with the residuals
@@ -123,6 +133,11 @@ private:
   WeightType m_weight;
   Comparator m_comparator;
   std::size_t m_residual_no;
+
+  // Position, data value and weight of the points with a weight different from zero
+  std::vector<std::size_t> m_valid_index;
+  std::vector<double> m_valid_data;
+  std::vector<double> m_valid_weight;
   
 }; // end of class DataVsModelResiduals
 
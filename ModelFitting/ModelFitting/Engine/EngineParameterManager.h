@@ -23,8 +23,10 @@
 #ifndef MODELFITTING_ENGINEPARAMETERMANAGER_H
 #define	MODELFITTING_ENGINEPARAMETERMANAGER_H
 
+#include <memory>
 #include <vector>
 #include "ModelFitting/Parameters/EngineParameter.h"
+#include "ModelFitting/Parameters/ParameterTape.h"
 
 namespace ModelFitting {
 
@@ -134,10 +136,39 @@ public:
   
   std::vector<double> convertCovarianceMatrixToWorldSpace(std::vector<double> covariance_matrix) const;
 
+  /**
+   * @brief Compiles the graph of parameters depending on the managed ones into
+   *    a ParameterTape, which is used by updateEngineValues() until releaseTape()
+   *
+   * @details
+   * Meant to be used by the minimization engines for the duration of the solving,
+   * via TapeScope. Until the tape is released, the parameters that do not depend
+   * on the managed ones must not be modified.
+   */
+  void compileTape();
+
+  /// Discards the ParameterTape, so the values are propagated again via the observers
+  void releaseTape();
+
+  /// Keeps a ParameterTape compiled during its lifetime
+  class TapeScope {
+  public:
+    explicit TapeScope(EngineParameterManager& manager) : m_manager(manager) {
+      m_manager.compileTape();
+    }
+
+    ~TapeScope() {
+      m_manager.releaseTape();
+    }
+
+  private:
+    EngineParameterManager& m_manager;
+  };
 
 private:
   
   std::vector<std::shared_ptr<EngineParameter>> m_parameters {};
+  std::unique_ptr<ParameterTape> m_tape;
   
 }; // end of class EngineParameterManager
 
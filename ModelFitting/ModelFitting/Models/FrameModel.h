@@ -163,6 +163,17 @@ public:
   const ImageType& getImage();
 
   void rasterToImage(ImageType&);
+
+  /**
+   * Rasterize all the extended models into a single canvas, aligned with the frame grid plus a margin,
+   * convolve it only once, and copy it into the frame.
+   * This is used only when there are at least two extended models, the PSF has the same pixel scale
+   * as the frame, and their stamps cover, together, more pixels than the canvas. Otherwise, each model
+   * is convolved on its own.
+   * Each stamp is still resampled once, but before the convolution instead of after, so the result
+   * differs slightly from the convolution of each model on its own.
+   */
+  void setBatchConvolution(bool batch_convolution);
   
   const_iterator begin();
   
@@ -180,6 +191,7 @@ private:
   std::vector<std::shared_ptr<ExtendedModel<ImageType>>> m_extended_model_list;
   psf_container_t m_psf;
   std::unique_ptr<ImageType> m_model_image {};
+  bool m_batch_convolution {false};
   
 }; // end of class FrameModel
 
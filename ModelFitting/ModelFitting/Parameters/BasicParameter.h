@@ -26,9 +26,12 @@
 #include <functional>    // for std::function of the parameter observer
 #include <map>           // for std::map
 #include <memory>
+#include <vector>
 
 namespace ModelFitting {
 
+class ParameterTape;
+
 /**
  * @class BasicParameter
  * @brief
@@ -70,11 +73,40 @@ public:
    * @return The key to use for removing an observer
    */
   std::size_t addObserver(ParameterObserver observer);
+
+  /**
+   * @brief Registers an observer that updates the dependent parameter. Unlike
+   *    the observers added with addObserver(), these are not called when the
+   *    dependent is evaluated by a ParameterTape.
+   */
+  std::size_t addDependentObserver(BasicParameter* dependent, ParameterObserver observer);
   
   bool removeObserver(std::size_t id);
 
   bool isObserved() const;
 
+  /**
+   * @brief Returns true if the value is being computed by a ParameterTape
+   */
+  bool isTaped() const {
+    return m_taped;
+  }
+
+  /**
+   * @brief The parameters this one is computed from. Empty for independent parameters.
+   */
+  virtual std::vector<BasicParameter*> getInputParameters() const {
+    return {};
+  }
+
+  /**
+   * @brief Computes the value of the parameter given the values of its inputs,
+   *    in the same order as returned by getInputParameters()
+   */
+  virtual double computeValue(const double* /*input_values*/) const {
+    return m_value;
+  }
+
 protected:
   typedef std::function<void(void)> GetValueHook;
 
@@ -94,8 +126,19 @@ protected:
   double m_value;
 
 private:
-  std::map<std::size_t, ParameterObserver> m_observer_map;
+  friend class ParameterTape;
+
+  struct ObserverEntry {
+    ParameterObserver m_observer;
+    BasicParameter* m_dependent;
+  };
+
+  /// Calls the observers that are not part of the ParameterTape evaluating this parameter
+  void notifyUntapedObservers();
+
+  std::map<std::size_t, ObserverEntry> m_observer_map;
   std::size_t m_last_obs_id = 0;
+  bool m_taped = false;
 };
 
 }
@@ -68,12 +68,26 @@ public:
   virtual ~DependentParameter() = default;
 
   double getValue() const override {
-    if (!this->isObserved()) {
+    // A taped parameter is kept up to date by the tape
+    if (!this->isObserved() && !this->isTaped()) {
       const_cast<DependentParameter*>(this)->update((*m_params)[0]->getValue());
     }
     return m_value;
   }
 
+  std::vector<BasicParameter*> getInputParameters() const override {
+    std::vector<BasicParameter*> inputs;
+    inputs.reserve(PARAM_NO);
+    for (auto& param : *m_params) {
+      inputs.emplace_back(param.get());
+    }
+    return inputs;
+  }
+
+  double computeValue(const double* input_values) const override {
+    return compute(input_values);
+  }
+
 private:
 
   /// function to calculate the dependent parameter value
@@ -116,11 +130,22 @@ private:
     BasicParameter::setValue((*m_calculator)(values...));
   }
 
+  /* Same mechanism as update, but reading the input values from an array
+   */
+  template <typename... ParamValues>
+  double compute(const double* input_values, ParamValues... values) const {
+    return compute(input_values, values..., input_values[sizeof...(values)]);
+  }
+
+  double compute(const double*, decltype(std::declval<Parameters>()->getValue())... values) const {
+    return (*m_calculator)(values...);
+  }
+
   template<typename Param>
   void addParameterObserver(int, Param& param) {
-    param->addObserver([this](double){
+    param->addDependentObserver(this, [this](double){
       // Do not bother updating live if there are no observers
-      if (this->isObserved()) {
+      if (this->isObserved() || this->isTaped()) {
           this->update((*m_params)[0]->getValue());
       }
     });
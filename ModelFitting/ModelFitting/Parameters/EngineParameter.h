@@ -65,6 +65,8 @@ public:
 
 private:
 
+  friend class ParameterTape;
+
   /// The parameter value in Engine coordinates
   double m_engine_value;
 
@@ -0,0 +1,112 @@
+/** Copyright © 2019 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file ParameterTape.h
+ * @date October 19, 2026
+ */
+
+#ifndef MODELFITTING_PARAMETERTAPE_H
+#define MODELFITTING_PARAMETERTAPE_H
+
+#include <memory>
+#include <vector>
+#include "ModelFitting/Parameters/EngineParameter.h"
+
+namespace ModelFitting {
+
+/**
+ * @class ParameterTape
+ * @brief Flat, topologically ordered evaluation of a parameter graph
+ *
+ * @details
+ *    Updating an EngineParameter propagates the new value through the observers
+ *    of every parameter depending on it, one std::function call and one
+ *    recursive getValue() at a time. The tape walks this graph once, when
+ *    constructed, and records each DependentParameter reachable from the engine
+ *    parameters as an operation over a contiguous array of values:
+ *    the engine parameters first, then the inputs that do not depend on them
+ *    (captured as constants), and then the dependent parameters in evaluation order.
+ *
+ *    evaluate() runs all the operations in a single loop, and then publishes
+ *    the results to the parameters, so the models keep reading them with getValue().
+ *    Only the observers that are not part of the tape are notified.
+ *
+ *    Operations whose inputs did not change since the previous evaluation are skipped,
+ *    and so are the observers of the values that did not change. The minimization engines
+ *    estimate the Jacobian modifying one engine parameter at a time, so most of the
+ *    dependent parameters - which may be expensive, i.e. interpreted expressions
+ *    coming from the Python configuration - are not recomputed.
+ *
+ *    While the tape exists, the parameters that are not engine parameters
+ *    are assumed not to change. The tape must not outlive the parameters.
+ */
+class ParameterTape {
+
+public:
+
+  explicit ParameterTape(const std::vector<std::shared_ptr<EngineParameter>>& engine_parameters);
+
+  /// Destructor. The dependent parameters go back to being updated by their observers.
+  virtual ~ParameterTape();
+
+  ParameterTape(const ParameterTape&) = delete;
+  ParameterTape& operator=(const ParameterTape&) = delete;
+
+  /// Sets the engine value of the i-th engine parameter, without propagating it
+  void setEngineValue(std::size_t i, double engine_value) {
+    m_engine_values[i] = engine_value;
+  }
+
+  /// Computes all the parameter values from the engine values, and publishes them
+  void evaluate();
+
+  /// Number of dependent parameters evaluated by the tape
+  std::size_t numberOfOperations() const {
+    return m_operations.size();
+  }
+
+  /// Number of operations actually computed by the last call to evaluate()
+  std::size_t numberOfComputedOperations() const {
+    return m_computed_count;
+  }
+
+private:
+
+  struct Operation {
+    BasicParameter* m_parameter;
+    std::size_t m_first_input, m_input_count;
+    std::size_t m_output;
+  };
+
+  std::vector<EngineParameter*> m_engine_parameters;
+  std::vector<double> m_engine_values;
+  std::vector<Operation> m_operations;
+  /// Slots of the inputs of all the operations, consecutively
+  std::vector<std::size_t> m_inputs;
+  /// Values of the engine parameters (in world coordinates), the constants, and the dependent parameters
+  std::vector<double> m_values;
+  /// Which values changed on the last evaluation
+  std::vector<char> m_changed;
+  /// Inputs of the operation being evaluated
+  std::vector<double> m_scratch;
+  bool m_evaluated = false;
+  std::size_t m_computed_count = 0;
+};
+
+} // end of namespace ModelFitting
+
+#endif /* MODELFITTING_PARAMETERTAPE_H */
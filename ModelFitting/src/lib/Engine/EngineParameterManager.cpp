@@ -28,6 +28,7 @@ EngineParameterManager::~EngineParameterManager() = default;
 
 void EngineParameterManager::registerParameter(std::shared_ptr<EngineParameter> parameter) {
   m_parameters.emplace_back(std::move(parameter));
+  m_tape.reset();
 }
 
 std::size_t EngineParameterManager::numberOfParameters() {
@@ -50,5 +51,15 @@ std::vector<double> EngineParameterManager::convertCovarianceMatrixToWorldSpace(
   return converted_matrix;
 }
 
+void EngineParameterManager::compileTape() {
+  // Release first, so the previous tape does not clear the flags of the new one
+  m_tape.reset();
+  m_tape.reset(new ParameterTape(m_parameters));
+}
+
+void EngineParameterManager::releaseTape() {
+  m_tape.reset();
+}
+
 
 } // end of namespace ModelFitting
@@ -117,6 +117,9 @@ static LeastSquareSummary::StatusFlag getStatusFlag(int ret) {
 
 LeastSquareSummary GSLEngine::solveProblem(ModelFitting::EngineParameterManager& parameter_manager,
                                            ModelFitting::ResidualEstimator& residual_estimator) {
+  // Evaluate the parameter graph as a flat tape while solving
+  EngineParameterManager::TapeScope tape_scope {parameter_manager};
+
   // Create a tuple which keeps the references to the given manager and estimator
   // If we capture, we can not use the lambda for the function pointer
   auto adata = std::tie(parameter_manager, residual_estimator);
@@ -121,6 +121,9 @@ namespace {
 
 LeastSquareSummary LevmarEngine::solveProblem(EngineParameterManager& parameter_manager,
                                               ResidualEstimator& residual_estimator) {
+  // Evaluate the parameter graph as a flat tape while solving
+  EngineParameterManager::TapeScope tape_scope {parameter_manager};
+
   // Create a tuple which keeps the references to the given manager and estimator
   auto adata = std::tie(parameter_manager, residual_estimator);
 
@@ -32,13 +32,25 @@ BasicParameter::~BasicParameter() = default;
 void BasicParameter::setValue(const double new_value) {
   m_value = new_value;
   for (auto& observer : m_observer_map) {
-    observer.second(m_value);
+    observer.second.m_observer(m_value);
+  }
+}
+
+void BasicParameter::notifyUntapedObservers() {
+  for (auto& observer : m_observer_map) {
+    if (observer.second.m_dependent == nullptr || !observer.second.m_dependent->m_taped) {
+      observer.second.m_observer(m_value);
+    }
   }
 }
 
 std::size_t BasicParameter::addObserver(ParameterObserver observer) {
+  return addDependentObserver(nullptr, std::move(observer));
+}
+
+std::size_t BasicParameter::addDependentObserver(BasicParameter* dependent, ParameterObserver observer) {
   m_last_obs_id += 1;
-  m_observer_map.emplace(m_last_obs_id, std::move(observer));
+  m_observer_map.emplace(m_last_obs_id, ObserverEntry{std::move(observer), dependent});
   return m_last_obs_id;
 }
 
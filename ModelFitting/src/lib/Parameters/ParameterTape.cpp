@@ -0,0 +1,162 @@
+/** Copyright © 2019 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file ParameterTape.cpp
+ * @date October 19, 2026
+ */
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include "ModelFitting/Parameters/ParameterTape.h"
+
+namespace ModelFitting {
+
+ParameterTape::ParameterTape(const std::vector<std::shared_ptr<EngineParameter>>& engine_parameters) {
+  std::unordered_map<const BasicParameter*, std::size_t> slots;
+
+  for (auto& parameter : engine_parameters) {
+    m_engine_parameters.emplace_back(parameter.get());
+    m_engine_values.emplace_back(parameter->getEngineValue());
+    slots.emplace(parameter.get(), m_values.size());
+    m_values.emplace_back(parameter->getValue());
+  }
+
+  // Find all the parameters downstream of the engine parameters
+  std::unordered_set<BasicParameter*> downstream;
+  std::vector<BasicParameter*> pending(m_engine_parameters.begin(), m_engine_parameters.end());
+  while (!pending.empty()) {
+    auto parameter = pending.back();
+    pending.pop_back();
+    for (auto& observer : parameter->m_observer_map) {
+      auto dependent = observer.second.m_dependent;
+      if (dependent != nullptr && slots.count(dependent) == 0 && downstream.insert(dependent).second) {
+        pending.emplace_back(dependent);
+      }
+    }
+  }
+
+  // Sort them so every parameter comes after its inputs (depth-first post-order)
+  std::vector<std::pair<BasicParameter*, bool>> stack;
+  for (auto parameter : downstream) {
+    stack.emplace_back(parameter, false);
+    while (!stack.empty()) {
+      auto current = stack.back().first;
+      bool inputs_done = stack.back().second;
+      stack.pop_back();
+      if (slots.count(current)) {
+        continue;
+      }
+      auto inputs = current->getInputParameters();
+      if (!inputs_done) {
+        stack.emplace_back(current, true);
+        for (auto input : inputs) {
+          if (slots.count(input) == 0 && downstream.count(input)) {
+            stack.emplace_back(input, false);
+          }
+        }
+        continue;
+      }
+
+      Operation op {current, m_inputs.size(), inputs.size(), 0};
+      for (auto input : inputs) {
+        auto slot = slots.find(input);
+        if (slot == slots.end()) {
+          // Not affected by the engine parameters
+          slot = slots.emplace(input, m_values.size()).first;
+          m_values.emplace_back(input->getValue());
+        }
+        m_inputs.emplace_back(slot->second);
+      }
+      op.m_output = m_values.size();
+      slots.emplace(current, op.m_output);
+      m_values.emplace_back(current->getValue());
+      m_operations.emplace_back(op);
+      m_scratch.resize(std::max(m_scratch.size(), inputs.size()));
+    }
+  }
+
+  m_changed.resize(m_values.size(), false);
+  for (auto& op : m_operations) {
+    op.m_parameter->m_taped = true;
+  }
+}
+
+ParameterTape::~ParameterTape() {
+  for (auto& op : m_operations) {
+    op.m_parameter->m_taped = false;
+  }
+}
+
+void ParameterTape::evaluate() {
+  // Everything is considered modified the first time
+  char all_changed = !m_evaluated;
+  m_evaluated = true;
+
+  double* values = m_values.data();
+  char* changed = m_changed.data();
+  for (std::size_t i = 0; i < m_engine_parameters.size(); ++i) {
+    auto parameter = m_engine_parameters[i];
+    double world = parameter->m_converter->engineToWorld(m_engine_values[i]);
+    // A saturated converter maps different engine values to the same world value,
+    // so compare the engine value too
+    changed[i] = all_changed || world != values[i] || m_engine_values[i] != parameter->m_engine_value;
+    values[i] = world;
+  }
+
+  const std::size_t* inputs = m_inputs.data();
+  double* scratch = m_scratch.data();
+  m_computed_count = 0;
+  for (auto& op : m_operations) {
+    char inputs_changed = all_changed;
+    for (std::size_t i = 0; i < op.m_input_count; ++i) {
+      std::size_t slot = inputs[op.m_first_input + i];
+      scratch[i] = values[slot];
+      inputs_changed |= changed[slot];
+    }
+    if (inputs_changed) {
+      double value = op.m_parameter->computeValue(scratch);
+      changed[op.m_output] = all_changed || value != values[op.m_output];
+      values[op.m_output] = value;
+      ++m_computed_count;
+    }
+    else {
+      changed[op.m_output] = false;
+    }
+  }
+
+  // Publish all the values before notifying, so the observers see a consistent state
+  for (std::size_t i = 0; i < m_engine_parameters.size(); ++i) {
+    m_engine_parameters[i]->m_value = values[i];
+    m_engine_parameters[i]->m_engine_value = m_engine_values[i];
+  }
+  for (auto& op : m_operations) {
+    op.m_parameter->m_value = values[op.m_output];
+  }
+  for (std::size_t i = 0; i < m_engine_parameters.size(); ++i) {
+    if (changed[i]) {
+      m_engine_parameters[i]->notifyUntapedObservers();
+    }
+  }
+  for (auto& op : m_operations) {
+    if (changed[op.m_output]) {
+      op.m_parameter->notifyUntapedObservers();
+    }
+  }
+}
+
+} // end of namespace ModelFitting
@@ -0,0 +1,78 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Engine/DataVsModelResiduals_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include "ModelFitting/Engine/ChiSquareComparator.h"
+#include "ModelFitting/Engine/DataVsModelResiduals.h"
+
+using namespace ModelFitting;
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (DataVsModelResiduals_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE (AllValid_test) {
+  std::vector<double> data {1, 2, 3, 4};
+  std::vector<double> model {0, 0, 1, 1};
+  std::vector<double> weight {1, 2, 1, 2};
+
+  auto residuals = createDataVsModelResiduals(data, model, weight, ChiSquareComparator{});
+  BOOST_CHECK_EQUAL(residuals->numberOfResiduals(), 4);
+
+  std::vector<double> output(4);
+  residuals->populateResidualBlock(output.data());
+  std::vector<double> expected {1, 4, 2, 6};
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected.begin(), expected.end());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE (SkipZeroWeight_test) {
+  std::vector<double> data {1, 2, 3, 4, 5, 6};
+  std::vector<double> model {1, 1, 1, 1, 1, 1};
+  std::vector<double> weight {0, 1, 0, 0, 2, 0};
+
+  auto residuals = createDataVsModelResiduals(data, model, weight, ChiSquareComparator{});
+  BOOST_CHECK_EQUAL(residuals->numberOfResiduals(), 2);
+
+  std::vector<double> output(2);
+  residuals->populateResidualBlock(output.data());
+  std::vector<double> expected {1, 8};
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected.begin(), expected.end());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE (AllMasked_test) {
+  std::vector<double> data {1, 2, 3};
+  std::vector<double> model {1, 1, 1};
+  std::vector<double> weight {0, 0, 0};
+
+  auto residuals = createDataVsModelResiduals(data, model, weight, ChiSquareComparator{});
+  BOOST_CHECK_EQUAL(residuals->numberOfResiduals(), 0);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -0,0 +1,159 @@
+/** Copyright © 2019 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file ParameterTape_test.cpp
+ * @date October 19, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "ModelFitting/Parameters/ManualParameter.h"
+#include "ModelFitting/Parameters/DependentParameter.h"
+#include "ModelFitting/Parameters/EngineParameter.h"
+#include "ModelFitting/Parameters/NeutralConverter.h"
+#include "ModelFitting/Parameters/ExpSigmoidConverter.h"
+#include "ModelFitting/Parameters/ParameterTape.h"
+#include "ModelFitting/Engine/EngineParameterManager.h"
+
+using namespace ModelFitting;
+
+BOOST_AUTO_TEST_SUITE (ParameterTape_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(evaluate_test) {
+  auto a = std::make_shared<EngineParameter>(2., std::unique_ptr<CoordinateConverter>{new NeutralConverter});
+  auto b = std::make_shared<EngineParameter>(3., std::unique_ptr<CoordinateConverter>{new ExpSigmoidConverter(0.1, 100.)});
+  auto c = std::make_shared<ManualParameter>(10.);
+
+  auto sum = createDependentParameter([](double x, double y) { return x + y; }, a, b);
+  auto scaled = createDependentParameter([](double s, double k) { return s * k; }, sum, c);
+  // Depends on an engine parameter both directly and through another dependent
+  auto diff = createDependentParameter([](double x, double s) { return s - x; }, a, scaled);
+
+  double observed = 0.;
+  scaled->addObserver([&observed](double v) { observed = v; });
+
+  ParameterTape tape({a, b});
+  BOOST_CHECK_EQUAL(tape.numberOfOperations(), 3);
+  BOOST_CHECK(sum->isTaped());
+  BOOST_CHECK(!a->isTaped());
+
+  tape.setEngineValue(0, 5.);
+  tape.setEngineValue(1, b->getEngineValue());
+  tape.evaluate();
+
+  BOOST_CHECK_CLOSE(a->getValue(), 5., 1e-8);
+  BOOST_CHECK_CLOSE(a->getEngineValue(), 5., 1e-8);
+  BOOST_CHECK_CLOSE(b->getValue(), 3., 1e-8);
+  BOOST_CHECK_CLOSE(sum->getValue(), 8., 1e-8);
+  BOOST_CHECK_CLOSE(scaled->getValue(), 80., 1e-8);
+  BOOST_CHECK_CLOSE(diff->getValue(), 75., 1e-8);
+  BOOST_CHECK_CLOSE(observed, 80., 1e-8);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(skipUnchanged_test) {
+  auto a = std::make_shared<EngineParameter>(1., std::unique_ptr<CoordinateConverter>{new NeutralConverter});
+  auto b = std::make_shared<EngineParameter>(2., std::unique_ptr<CoordinateConverter>{new NeutralConverter});
+
+  int a_calls = 0, b_calls = 0;
+  auto from_a = createDependentParameter([&a_calls](double x) { ++a_calls; return x * 2; }, a);
+  auto from_b = createDependentParameter([&b_calls](double x) { ++b_calls; return x * 3; }, b);
+
+  int b_notifications = 0;
+  from_b->addObserver([&b_notifications](double) { ++b_notifications; });
+
+  ParameterTape tape({a, b});
+  a_calls = b_calls = 0;
+
+  tape.setEngineValue(0, 1.);
+  tape.setEngineValue(1, 2.);
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(tape.numberOfComputedOperations(), 2);
+  BOOST_CHECK_EQUAL(b_notifications, 1);
+
+  // Only the parameters depending on a are recomputed
+  tape.setEngineValue(0, 5.);
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(tape.numberOfComputedOperations(), 1);
+  BOOST_CHECK_EQUAL(a_calls, 2);
+  BOOST_CHECK_EQUAL(b_calls, 1);
+  BOOST_CHECK_EQUAL(b_notifications, 1);
+  BOOST_CHECK_CLOSE(from_a->getValue(), 10., 1e-8);
+  BOOST_CHECK_CLOSE(from_b->getValue(), 6., 1e-8);
+
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(tape.numberOfComputedOperations(), 0);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(saturatedConverter_test) {
+  // Far from 0 the converter saturates, and different engine values give the same world value
+  auto a = std::make_shared<EngineParameter>(100., std::unique_ptr<CoordinateConverter>{new ExpSigmoidConverter(0.1, 100.)});
+  auto dep = createDependentParameter([](double x) { return 2 * x; }, a);
+
+  int notifications = 0;
+  a->addObserver([&notifications](double) { ++notifications; });
+
+  ParameterTape tape({a});
+  tape.setEngineValue(0, 60.);
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(notifications, 1);
+  double world = a->getValue();
+
+  tape.setEngineValue(0, 70.);
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(a->getValue(), world);
+  BOOST_CHECK_CLOSE(a->getEngineValue(), 70., 1e-8);
+  BOOST_CHECK_CLOSE(dep->getValue(), 2 * world, 1e-8);
+  BOOST_CHECK_EQUAL(notifications, 2);
+
+  // Nothing changed at all
+  tape.evaluate();
+  BOOST_CHECK_EQUAL(tape.numberOfComputedOperations(), 0);
+  BOOST_CHECK_EQUAL(notifications, 2);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(manager_test) {
+  auto a = std::make_shared<EngineParameter>(1., std::unique_ptr<CoordinateConverter>{new NeutralConverter});
+  auto dep = createDependentParameter([](double x) { return 2 * x; }, a);
+
+  EngineParameterManager manager;
+  manager.registerParameter(a);
+
+  std::vector<double> values {4.};
+  {
+    EngineParameterManager::TapeScope scope {manager};
+    BOOST_CHECK(dep->isTaped());
+    manager.updateEngineValues(values.begin());
+    BOOST_CHECK_CLOSE(dep->getValue(), 8., 1e-8);
+  }
+
+  // Without the tape, the values are propagated as usual
+  BOOST_CHECK(!dep->isTaped());
+  values[0] = 6.;
+  manager.updateEngineValues(values.begin());
+  BOOST_CHECK_CLOSE(dep->getValue(), 12., 1e-8);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
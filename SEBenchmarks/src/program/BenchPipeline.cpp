@@ -0,0 +1,483 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/**
+ * @file src/program/BenchPipeline.cpp
+ * @date 10/19/26
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/random.hpp>
+
+#include <ElementsKernel/Exception.h>
+#include <ElementsKernel/Logging.h>
+#include <ElementsKernel/Program.h>
+#include <ElementsKernel/Main.h>
+#include <AlexandriaKernel/StringUtils.h>
+
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+namespace pt = boost::property_tree;
+using namespace Euclid;
+
+static Elements::Logging logger = Elements::Logging::getLogger("BenchPipeline");
+
+/**
+ * A synthetic field
+ */
+struct Scenario {
+  int m_size;
+  /// Sources per megapixel
+  double m_density;
+  /// Fraction of sources placed right next to another one
+  double m_blend_fraction;
+  int m_bands;
+
+  std::string getId() const {
+    std::ostringstream id;
+    id << "size=" << m_size << ",density=" << m_density << ",blend=" << m_blend_fraction << ",bands=" << m_bands;
+    return id.str();
+  }
+};
+
+/**
+ * Outcome of running the pipeline over a scenario with a given number of threads
+ */
+struct RunResult {
+  Scenario m_scenario;
+  int m_threads;
+  double m_wall;
+  size_t m_sources;
+  long m_peak_rss_kb;
+  double m_efficiency;
+  std::vector<std::pair<std::string, double>> m_stages;
+
+  std::string getId() const {
+    return m_scenario.getId() + ",threads=" + std::to_string(m_threads);
+  }
+
+  double getSourcesPerSecond() const {
+    return m_wall > 0 ? m_sources / m_wall : 0.;
+  }
+};
+
+/**
+ * One line of the source list understood by TestImage
+ */
+struct SyntheticSource {
+  double x, y;
+  double exp_flux, exp_rad, exp_aspect, exp_rot;
+  double color;
+};
+
+/**
+ * @class BenchPipeline
+ * Render synthetic fields with TestImage, and time the full sourcextractor++ pipeline over them
+ * for different thread counts. The report can be compared with a previous one, used as baseline.
+ */
+class BenchPipeline : public Elements::Program {
+private:
+  std::string m_sourcextractor, m_test_image;
+  std::vector<std::string> m_extra_args;
+  fs::path m_work_dir;
+  unsigned int m_seed;
+  int m_repeat;
+
+  /**
+   * Run a process, wait for it, and measure its wall time and peak resident memory.
+   * stdout and stderr are redirected to log_path.
+   */
+  static int runProcess(const std::vector<std::string>& cmd, const fs::path& log_path,
+                        double& wall, long& peak_rss_kb) {
+    logger.debug() << boost::algorithm::join(cmd, " ");
+
+    std::vector<char*> argv;
+    for (auto& arg : cmd) {
+      argv.emplace_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.emplace_back(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if (pid < 0) {
+      throw Elements::Exception() << "Could not fork: " << std::strerror(errno);
+    }
+    if (pid == 0) {
+      int fd = open(log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd >= 0) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+      }
+      execvp(argv[0], argv.data());
+      _exit(127);
+    }
+
+    int status = 0;
+    struct rusage usage {};
+    if (wait4(pid, &status, 0, &usage) < 0) {
+      throw Elements::Exception() << "Could not wait for " << cmd.front() << ": " << std::strerror(errno);
+    }
+    wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // Linux reports kilobytes, macOS bytes
+#ifdef __APPLE__
+    peak_rss_kb = usage.ru_maxrss / 1024;
+#else
+    peak_rss_kb = usage.ru_maxrss;
+#endif
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+
+  static void checkedRun(const std::vector<std::string>& cmd, const fs::path& log_path,
+                         double& wall, long& peak_rss_kb) {
+    int ret = runProcess(cmd, log_path, wall, peak_rss_kb);
+    if (ret != 0) {
+      throw Elements::Exception() << cmd.front() << " failed with exit code " << ret << ", see " << log_path.native();
+    }
+  }
+
+  /**
+   * Generate reproducible source positions and shapes. The random generator depends only on the
+   * seed and the scenario, so the same field is obtained across runs and machines.
+   */
+  std::vector<SyntheticSource> generateSources(const Scenario& scenario) const {
+    boost::random::mt19937 rng{m_seed};
+    size_t nsources = std::llround(scenario.m_density * scenario.m_size * scenario.m_size / 1e6);
+
+    double margin = scenario.m_size * .02;
+    boost::random::uniform_real_distribution<> position(margin, scenario.m_size - margin);
+    boost::random::uniform_real_distribution<> log_flux(std::log(1e3), std::log(1e5));
+    boost::random::uniform_real_distribution<> radius(.5, 6.);
+    boost::random::uniform_real_distribution<> aspect(.2, 1.);
+    boost::random::uniform_real_distribution<> rotation(-90., 90.);
+    boost::random::uniform_real_distribution<> color(.5, 2.);
+    boost::random::uniform_real_distribution<> unit(0., 1.);
+    boost::random::uniform_real_distribution<> blend_distance(2., 8.);
+    boost::random::uniform_real_distribution<> angle(0., 2 * M_PI);
+
+    std::vector<SyntheticSource> sources;
+    sources.reserve(nsources);
+    for (size_t i = 0; i < nsources; ++i) {
+      SyntheticSource source{position(rng), position(rng), std::exp(log_flux(rng)), radius(rng), aspect(rng),
+                             rotation(rng), color(rng)};
+      if (!sources.empty() && unit(rng) < scenario.m_blend_fraction) {
+        auto& neighbour = sources[boost::random::uniform_int_distribution<size_t>(0, sources.size() - 1)(rng)];
+        double d = blend_distance(rng), a = angle(rng);
+        source.x = neighbour.x + d * std::cos(a);
+        source.y = neighbour.y + d * std::sin(a);
+      }
+      sources.emplace_back(source);
+    }
+    return sources;
+  }
+
+  /**
+   * Write the source list for one band. Each source has a color, so the bands are not just scaled copies.
+   */
+  static void writeSourceList(const fs::path& path, const std::vector<SyntheticSource>& sources, int band) {
+    std::ofstream out(path.native());
+    for (auto& source : sources) {
+      double flux = source.exp_flux * std::pow(source.color, band);
+      out << source.x << " " << source.y << " " << flux << " " << source.exp_rad << " " << source.exp_aspect << " "
+          << source.exp_rot << " 0 1 1 0 0\n";
+    }
+  }
+
+  /**
+   * Python configuration measuring the aperture photometry on all the bands
+   */
+  static void writePythonConfig(const fs::path& path, const std::vector<fs::path>& bands) {
+    std::ofstream out(path.native());
+    out << "from sourcextractor.config import *\n\n";
+    out << "images = [\n";
+    for (auto& band : bands) {
+      out << "    load_fits_image('" << band.native() << "'),\n";
+    }
+    out << "]\n";
+    out << "apertures = add_aperture_photometry(images, [5, 10])\n";
+    out << "add_output_column('aperture', apertures)\n";
+  }
+
+  /**
+   * Render all the bands of a scenario, unless they already exist in the work area for the same seed
+   */
+  std::vector<fs::path> renderScenario(const Scenario& scenario) const {
+    auto scenario_dir = m_work_dir / boost::replace_all_copy(scenario.getId() + ",seed=" + std::to_string(m_seed),
+                                                             ",", "_");
+    fs::create_directories(scenario_dir);
+
+    auto sources = generateSources(scenario);
+    std::vector<fs::path> bands;
+    for (int band = 0; band < scenario.m_bands; ++band) {
+      auto image_path = scenario_dir / ("band" + std::to_string(band) + ".fits");
+      bands.emplace_back(image_path);
+      if (fs::exists(image_path)) {
+        continue;
+      }
+
+      auto source_list = scenario_dir / ("band" + std::to_string(band) + ".txt");
+      writeSourceList(source_list, sources, band);
+
+      double wall;
+      long peak_rss;
+      logger.info() << "Rendering " << image_path.native() << " with " << sources.size() << " sources";
+      checkedRun({m_test_image, "--size", std::to_string(scenario.m_size), "--source-list", source_list.native(),
+                  "--seed", std::to_string(m_seed + band), "--output", image_path.native()},
+                 scenario_dir / ("band" + std::to_string(band) + ".log"), wall, peak_rss);
+    }
+    writePythonConfig(scenario_dir / "config.py", bands);
+    return bands;
+  }
+
+  /**
+   * Number of rows on an ASCII catalog
+   */
+  static size_t countCatalogRows(const fs::path& path) {
+    std::ifstream in(path.native());
+    std::string line;
+    size_t rows = 0;
+    while (std::getline(in, line)) {
+      if (!line.empty() && line[0] != '#') {
+        ++rows;
+      }
+    }
+    return rows;
+  }
+
+  /**
+   * Time spent on each stage, as written by the profiler. The self time excludes the nested stages
+   * (i.e. the grouping triggering the measurement), so the stages do not count the same time twice.
+   */
+  static std::vector<std::pair<std::string, double>> readStageTimes(const fs::path& path) {
+    std::vector<std::pair<std::string, double>> stages;
+    if (!fs::exists(path)) {
+      return stages;
+    }
+    pt::ptree profile;
+    pt::read_json(path.native(), profile);
+    for (auto& timer : profile.get_child("timers")) {
+      if (timer.second.get<std::string>("category") == "stage") {
+        stages.emplace_back(timer.second.get<std::string>("name"), timer.second.get<double>("self"));
+      }
+    }
+    return stages;
+  }
+
+  RunResult runPipeline(const Scenario& scenario, const std::vector<fs::path>& bands, int threads) const {
+    auto scenario_dir = bands.front().parent_path();
+    auto suffix = "_" + std::to_string(threads);
+    auto catalog = scenario_dir / ("catalog" + suffix + ".txt");
+    auto profile = scenario_dir / ("profile" + suffix + ".json");
+
+    std::vector<std::string> cmd{
+      m_sourcextractor,
+      "--detection-image", bands.front().native(),
+      "--python-config-file", (scenario_dir / "config.py").native(),
+      "--output-catalog-format", "ASCII",
+      "--output-catalog-filename", catalog.native(),
+      "--thread-count", std::to_string(threads),
+      "--profile-file", profile.native()
+    };
+    cmd.insert(cmd.end(), m_extra_args.begin(), m_extra_args.end());
+
+    RunResult result{scenario, threads, std::numeric_limits<double>::max(), 0, 0, 1., {}};
+    for (int i = 0; i < m_repeat; ++i) {
+      double wall;
+      long peak_rss;
+      checkedRun(cmd, scenario_dir / ("sourcextractor" + suffix + ".log"), wall, peak_rss);
+      // Keep the best run, the others are the ones disturbed by something else
+      if (wall < result.m_wall) {
+        result.m_wall = wall;
+        result.m_peak_rss_kb = peak_rss;
+        result.m_stages = readStageTimes(profile);
+      }
+    }
+    result.m_sources = countCatalogRows(catalog);
+
+    logger.info() << result.getId() << ": " << result.m_sources << " sources in " << result.m_wall << " s, "
+                  << result.m_peak_rss_kb / 1024 << " MiB";
+    return result;
+  }
+
+  static void writeReport(std::ostream& out, const std::vector<RunResult>& results) {
+    out << std::setprecision(6) << "{\n  \"runs\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+      auto& r = results[i];
+      out << (i ? "," : "") << "\n    {\"id\": \"" << r.getId() << "\", \"size\": " << r.m_scenario.m_size
+          << ", \"density\": " << r.m_scenario.m_density << ", \"blend\": " << r.m_scenario.m_blend_fraction
+          << ", \"bands\": " << r.m_scenario.m_bands << ", \"threads\": " << r.m_threads
+          << ", \"sources\": " << r.m_sources << ", \"wall\": " << r.m_wall
+          << ", \"sources_per_second\": " << r.getSourcesPerSecond()
+          << ", \"peak_rss_kb\": " << r.m_peak_rss_kb << ", \"efficiency\": " << r.m_efficiency
+          << ",\n     \"stages\": {";
+      for (size_t j = 0; j < r.m_stages.size(); ++j) {
+        out << (j ? ", " : "") << "\"" << r.m_stages[j].first << "\": " << r.m_stages[j].second;
+      }
+      out << "}}";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  /**
+   * Compare the results with a baseline report
+   * @return The number of regressions
+   */
+  static int compareBaseline(const std::string& baseline_path, const std::vector<RunResult>& results,
+                             double tolerance) {
+    pt::ptree baseline;
+    pt::read_json(baseline_path, baseline);
+
+    std::map<std::string, const pt::ptree*> baseline_runs;
+    for (auto& run : baseline.get_child("runs")) {
+      baseline_runs[run.second.get<std::string>("id")] = &run.second;
+    }
+
+    int regressions = 0;
+    for (auto& result : results) {
+      auto i = baseline_runs.find(result.getId());
+      if (i == baseline_runs.end()) {
+        logger.warn() << result.getId() << " is not on the baseline";
+        continue;
+      }
+      auto base_rate = i->second->get<double>("sources_per_second");
+      auto base_rss = i->second->get<double>("peak_rss_kb");
+      if (result.getSourcesPerSecond() < base_rate * (1. - tolerance)) {
+        logger.error() << result.getId() << ": " << result.getSourcesPerSecond() << " sources/s, baseline "
+                       << base_rate;
+        ++regressions;
+      }
+      if (result.m_peak_rss_kb > base_rss * (1. + tolerance)) {
+        logger.error() << result.getId() << ": " << result.m_peak_rss_kb << " KiB peak RSS, baseline " << base_rss;
+        ++regressions;
+      }
+    }
+    return regressions;
+  }
+
+public:
+
+  po::options_description defineSpecificProgramOptions() override {
+    po::options_description options;
+    options.add_options()
+      ("sourcextractor", po::value<std::string>()->default_value("sourcextractor++"), "sourcextractor++ executable")
+      ("test-image", po::value<std::string>()->default_value("TestImage"), "TestImage executable")
+      ("sourcextractor-args", po::value<std::string>()->default_value(""),
+        "Additional arguments for sourcextractor++ (i.e. grouping or model fitting configuration)")
+      ("work-area", po::value<std::string>()->default_value((fs::temp_directory_path() / "BenchPipeline").native()),
+        "Directory for the rendered fields, the catalogs and the logs. Existing fields are reused")
+      ("image-size", po::value<std::string>()->default_value("2048"), "Image sizes, in pixels")
+      ("density", po::value<std::string>()->default_value("500"), "Source densities, in sources per megapixel")
+      ("blend-fraction", po::value<std::string>()->default_value("0.1"), "Fractions of blended sources")
+      ("bands", po::value<std::string>()->default_value("1"), "Number of bands")
+      ("threads", po::value<std::string>()->default_value("1,2,4,8"), "Thread counts")
+      ("repeat", po::value<int>()->default_value(1), "Run each configuration this many times, and keep the fastest")
+      ("seed", po::value<unsigned int>()->default_value(42), "Seed for the synthetic fields")
+      ("output", po::value<std::string>()->default_value(""), "Write the JSON report here instead of stdout")
+      ("baseline", po::value<std::string>()->default_value(""), "Compare with this report")
+      ("tolerance", po::value<double>()->default_value(0.1), "Relative slowdown or memory growth accepted");
+    return options;
+  }
+
+  Elements::ExitCode mainMethod(std::map<std::string, po::variable_value>& args) override {
+    m_sourcextractor = args.at("sourcextractor").as<std::string>();
+    m_test_image = args.at("test-image").as<std::string>();
+    auto extra_args = boost::trim_copy(args.at("sourcextractor-args").as<std::string>());
+    if (!extra_args.empty()) {
+      boost::split(m_extra_args, extra_args, boost::is_space(), boost::token_compress_on);
+    }
+    m_work_dir = args.at("work-area").as<std::string>();
+    m_seed = args.at("seed").as<unsigned int>();
+    m_repeat = std::max(1, args.at("repeat").as<int>());
+
+    auto sizes = stringToVector<int>(args.at("image-size").as<std::string>());
+    auto densities = stringToVector<double>(args.at("density").as<std::string>());
+    auto blends = stringToVector<double>(args.at("blend-fraction").as<std::string>());
+    auto bands = stringToVector<int>(args.at("bands").as<std::string>());
+    auto threads = stringToVector<int>(args.at("threads").as<std::string>());
+    if (threads.empty()) {
+      throw Elements::Exception() << "At least one thread count is required";
+    }
+
+    std::vector<RunResult> results;
+    for (auto size : sizes) {
+      for (auto density : densities) {
+        for (auto blend : blends) {
+          for (auto nbands : bands) {
+            Scenario scenario{size, density, blend, nbands};
+            auto images = renderScenario(scenario);
+
+            size_t first = results.size();
+            for (auto nthreads : threads) {
+              results.emplace_back(runPipeline(scenario, images, nthreads));
+            }
+            // Scaling efficiency relative to the first thread count
+            auto& reference = results[first];
+            for (size_t i = first; i < results.size(); ++i) {
+              double ideal = reference.getSourcesPerSecond() * std::max(1, results[i].m_threads) /
+                             std::max(1, reference.m_threads);
+              results[i].m_efficiency = ideal > 0 ? results[i].getSourcesPerSecond() / ideal : 0.;
+            }
+          }
+        }
+      }
+    }
+
+    auto output = args.at("output").as<std::string>();
+    if (output.empty()) {
+      writeReport(std::cout, results);
+    }
+    else {
+      std::ofstream out(output);
+      writeReport(out, results);
+      logger.info() << "Report written into " << output;
+    }
+
+    auto baseline = args.at("baseline").as<std::string>();
+    if (!baseline.empty()) {
+      int regressions = compareBaseline(baseline, results, args.at("tolerance").as<double>());
+      if (regressions > 0) {
+        logger.error() << regressions << " regression(s) with respect to " << baseline;
+        return Elements::ExitCode::NOT_OK;
+      }
+      logger.info() << "No regressions with respect to " << baseline;
+    }
+
+    return Elements::ExitCode::OK;
+  }
+};
+
+MAIN_FOR(BenchPipeline)
@@ -25,6 +25,7 @@
 #define _SEFRAMEWORK_SEFRAMEWORK_APERTURE_MEASUREFLUX_H
 
 #include "Aperture.h"
+#include "SEFramework/Image/VectorImage.h"
 #include "SEFramework/Image/WriteableImage.h"
 #include "SEFramework/Source/SourceFlags.h"
 
@@ -125,6 +126,39 @@ void drawAperture(const std::shared_ptr<Aperture> &aperture, SeFloat centroid_x,
   }
 }
 
+/**
+ * Render an aperture into a stamp covering its bounding box
+ * @param aperture
+ *  Aperture to use
+ * @param centroid_x
+ *  Center of the aperture on the X axis
+ * @param centroid_y
+ *  Center of the aperture on the Y axis
+ * @param value
+ *  Value to use for the fill. Pixels outside the aperture are set to 0.
+ * @param min_pixel
+ *  Output parameter: coordinates of the stamp top left corner
+ * @return
+ *  The rendered stamp
+ */
+template <typename T>
+std::shared_ptr<VectorImage<T>> drawApertureStamp(const std::shared_ptr<Aperture> &aperture,
+                                                  SeFloat centroid_x, SeFloat centroid_y,
+                                                  T value, PixelCoordinate& min_pixel) {
+  min_pixel = aperture->getMinPixel(centroid_x, centroid_y);
+  auto max_pixel = aperture->getMaxPixel(centroid_x, centroid_y);
+  auto stamp = VectorImage<T>::create(max_pixel.m_x - min_pixel.m_x + 1, max_pixel.m_y - min_pixel.m_y + 1);
+
+  for (int y = min_pixel.m_y; y <= max_pixel.m_y; ++y) {
+    for (int x = min_pixel.m_x; x <= max_pixel.m_x; ++x) {
+      if (aperture->drawArea(centroid_x, centroid_y, x, y) > 0) {
+        stamp->at(x - min_pixel.m_x, y - min_pixel.m_y) = value;
+      }
+    }
+  }
+  return stamp;
+}
+
 } // end SourceXtractor
 
 #endif // _SEFRAMEWORK_SEFRAMEWORK_APERTURE_MEASUREFLUX_H
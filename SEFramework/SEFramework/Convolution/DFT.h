@@ -57,6 +57,15 @@ public:
   struct ConvolutionContext {
     ConvolutionContext() = default;
 
+    /// The buffers go back to the pool of the thread, for the next context
+    ~ConvolutionContext() {
+      FFT<T>::releaseBuffer(std::move(m_kernel_transform));
+      FFT<T>::releaseBuffer(std::move(m_work_area));
+    }
+
+    ConvolutionContext(const ConvolutionContext&) = delete;
+    ConvolutionContext& operator=(const ConvolutionContext&) = delete;
+
   private:
     int m_padded_width, m_padded_height, m_transform_padding;
     std::vector<real_t> m_kernel_transform, m_work_area;
@@ -119,9 +128,9 @@ public:
     context->m_transform_padding = 2 * (context->m_padded_width / 2 + 1) - context->m_padded_width;
     int work_area_size = context->m_padded_height * (context->m_padded_width / 2 + 1) * 2;
 
-    // Pre-allocate buffers for the transformations
-    context->m_kernel_transform.resize(work_area_size);
-    context->m_work_area.resize(work_area_size);
+    // Pre-allocate buffers for the transformations, reusing those of previous contexts if possible
+    context->m_kernel_transform = FFT<T>::acquireBuffer(work_area_size);
+    context->m_work_area = FFT<T>::acquireBuffer(work_area_size);
 
     // Since we already have the buffers, get the plans too
     context->m_fwd_plan = FFT<T>::createForwardPlan(context->m_padded_width, context->m_padded_height,
@@ -26,6 +26,7 @@
 #include <complex>
 #include <fftw3.h>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace SourceXtractor {
@@ -48,12 +49,20 @@ struct FFTTraits<float> {
   typedef decltype(fftwf_destroy_plan)    func_destroy_plan_t;
   typedef decltype(fftwf_execute_dft_r2c) func_execute_fwd_t;
   typedef decltype(fftwf_execute_dft_c2r) func_execute_inv_t;
+  typedef decltype(fftwf_plan_dft_2d)     func_plan_c2c_t;
+  typedef decltype(fftwf_execute_dft)     func_execute_c2c_t;
+  typedef decltype(fftwf_import_wisdom_from_filename) func_import_wisdom_t;
+  typedef decltype(fftwf_export_wisdom_to_filename)   func_export_wisdom_t;
 
   static func_plan_fwd_t*     func_plan_fwd;
   static func_plan_inv_t*     func_plan_inv;
   static func_destroy_plan_t* func_destroy_plan;
   static func_execute_fwd_t*  func_execute_fwd;
   static func_execute_inv_t*  func_execute_inv;
+  static func_plan_c2c_t*     func_plan_c2c;
+  static func_execute_c2c_t*  func_execute_c2c;
+  static func_import_wisdom_t* func_import_wisdom;
+  static func_export_wisdom_t* func_export_wisdom;
 };
 
 /**
@@ -68,12 +77,20 @@ struct FFTTraits<double> {
   typedef decltype(fftw_destroy_plan)    func_destroy_plan_t;
   typedef decltype(fftw_execute_dft_r2c) func_execute_fwd_t;
   typedef decltype(fftw_execute_dft_c2r) func_execute_inv_t;
+  typedef decltype(fftw_plan_dft_2d)     func_plan_c2c_t;
+  typedef decltype(fftw_execute_dft)     func_execute_c2c_t;
+  typedef decltype(fftw_import_wisdom_from_filename) func_import_wisdom_t;
+  typedef decltype(fftw_export_wisdom_to_filename)   func_export_wisdom_t;
 
   static func_plan_fwd_t*     func_plan_fwd;
   static func_plan_inv_t*     func_plan_inv;
   static func_destroy_plan_t* func_destroy_plan;
   static func_execute_fwd_t*  func_execute_fwd;
   static func_execute_inv_t*  func_execute_inv;
+  static func_plan_c2c_t*     func_plan_c2c;
+  static func_execute_c2c_t*  func_execute_c2c;
+  static func_import_wisdom_t* func_import_wisdom;
+  static func_export_wisdom_t* func_export_wisdom;
 };
 
 /**
@@ -138,8 +155,75 @@ struct FFT {
    *    A buffer *in row major order* with the input data. It will be overwritten.
    */
   static void executeInverse(plan_ptr_t& plan, std::vector<T>& inout);
+
+  /**
+   * Create, or reuses if already exists, a 2D FFTW complex to complex plan.
+   * Transforming two real signals packed as the real and imaginary parts of a complex one
+   * costs roughly the same as transforming a single real signal with a r2c plan.
+   * @param width
+   *    The width of the 2D original data
+   * @param height
+   *    The height of the 2D original data
+   * @param inverse
+   *    If true, create a backward plan, forward otherwise
+   * @param inout
+   *    A buffer *in row major order* with interleaved real and imaginary parts, 2 * width * height positions.
+   *    It *will be overwritten*. If the memory area is not big enough, createComplexPlan will resize the vector.
+   * @return
+   *    A pointer to a plan fit to the given dimensions. It can be safely reused between threads.
+   */
+  static plan_ptr_t createComplexPlan(int width, int height, bool inverse, std::vector<T>& inout);
+
+  /**
+   * Execute a complex to complex Fourier Transform
+   * @param plan
+   *    A plan as created by createComplexPlan
+   * @param inout
+   *    A buffer with interleaved complex data. It will be overwritten.
+   */
+  static void executeComplex(plan_ptr_t& plan, std::vector<T>& inout);
+
+  /// Maximum number of buffers kept by each thread
+  static const size_t MAX_POOLED_BUFFERS = 8;
+
+  /**
+   * Get a work buffer from the pool of the calling thread, or allocate one if none is big enough.
+   * Useful when many short-lived transforms of similar sizes are done, as during model fitting.
+   * @param size
+   *    Number of elements. The content is unspecified.
+   */
+  static std::vector<T> acquireBuffer(size_t size);
+
+  /**
+   * Give a buffer back to the pool of the calling thread, so it can be reused.
+   */
+  static void releaseBuffer(std::vector<T>&& buffer);
 };
 
+/**
+ * Set the planner rigor (FFTW_ESTIMATE, FFTW_MEASURE, FFTW_PATIENT or FFTW_EXHAUSTIVE) for the plans
+ * created from now on. Plans already in the cache are kept.
+ * More rigorous planning gives faster transforms, at the cost of a slower planning, which
+ * can be avoided on later runs loading the wisdom with fftImportWisdom.
+ */
+void fftSetPlannerFlags(unsigned flags);
+
+/// @return The planner rigor used for new plans
+unsigned fftGetPlannerFlags();
+
+/**
+ * Load FFTW wisdom, for both single and double precision (the latter with the suffix .double)
+ * @return
+ *    false if none could be read
+ */
+bool fftImportWisdom(const std::string& path);
+
+/**
+ * Save the accumulated FFTW wisdom, for both single and double precision (the latter with the suffix .double)
+ * @throw Elements::Exception if it can not be written
+ */
+void fftExportWisdom(const std::string& path);
+
 /**
  * FFTW is best at handling sizes of the form 2^a 3^b 5^c 7^d 11^e 13^f where e+f is either 0 or 1.
  * It can compute any size, but to make things faster, this function will return a new size greater
@@ -112,6 +112,18 @@ public:
     return m_image_type;
   }
 
+  bool getNativeTileSize(int& width, int& height) const override;
+
+  /// Only sources opened for reading, each reader gets its own file handle
+  bool supportsConcurrentReads() const override {
+    return m_read_only;
+  }
+
+  /// Disk access, plus the decompression if the image is compressed
+  double getRegenerationCost() const override {
+    return m_native_tile_width > 0 ? 8. : 4.;
+  }
+
   std::unique_ptr<std::vector<char>> getFitsHeaders(int& number_of_records) const;
 
   const std::map<std::string, MetadataEntry>& getMetadata() const override;
@@ -137,6 +149,10 @@ private:
   ImageTile::ImageType m_image_type;
 
   int m_current_layer;
+
+  /// Size of the compression tiles, 0 if the image is not compressed
+  int m_native_tile_width, m_native_tile_height;
+  bool m_read_only;
 };
 
 }
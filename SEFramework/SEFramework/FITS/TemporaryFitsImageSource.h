@@ -74,6 +74,10 @@ public:
     return m_image_source->getType();
   }
 
+  double getRegenerationCost() const override {
+    return m_image_source->getRegenerationCost();
+  }
+
 private:
   Elements::TempFile m_temp_file;
   std::shared_ptr<FitsImageSource> m_image_source;
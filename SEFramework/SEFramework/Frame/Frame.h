@@ -25,6 +25,7 @@
 #define _SEFRAMEWORK_FRAME_FRAME_H_
 
 #include <algorithm>
+#include <utility>
 
 #include "SEUtils/Types.h"
 #include "SEFramework/Image/Image.h"
@@ -55,6 +56,16 @@ public:
   public:
     virtual ~ImageFilter() = default;
     virtual std::shared_ptr<Image<T>> processImage(std::shared_ptr<Image<T>> image, std::shared_ptr<Image<T>> variance, T threshold) const = 0;
+
+    /**
+     * Filter both the image and its variance map. Filters able to share the work between the two
+     * (i.e. the masking) should override this method.
+     * @return The filtered image, and the filtered variance
+     */
+    virtual std::pair<std::shared_ptr<Image<T>>, std::shared_ptr<Image<T>>>
+    processImageAndVariance(std::shared_ptr<Image<T>> image, std::shared_ptr<Image<T>> variance, T threshold) const {
+      return std::make_pair(processImage(image, variance, threshold), processImage(variance, variance, threshold));
+    }
   };
 
   Frame(std::shared_ptr<Image<T>> detection_image,
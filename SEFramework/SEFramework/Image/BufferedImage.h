@@ -57,6 +57,9 @@ public:
 
   std::shared_ptr<ImageChunk<T>> getChunk(int x, int y, int width, int height) const override;
 
+  /// Declare how this image is going to be read, so the tile manager does not need to learn it
+  void setAccessPattern(TileManager::AccessPattern pattern);
+
 protected:
   std::shared_ptr<const ImageSource> m_source;
   std::shared_ptr<TileManager> m_tile_manager;
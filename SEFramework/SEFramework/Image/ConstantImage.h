@@ -62,6 +62,10 @@ public:
     return UniversalImageChunk<T>::create(std::vector<T>(width * height, m_constant_value), width, height);
   }
 
+  T getConstantValue() const {
+    return m_constant_value;
+  }
+
 private:
 
   int m_width;
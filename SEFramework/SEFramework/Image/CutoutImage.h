@@ -0,0 +1,126 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CutoutImage.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEFRAMEWORK_IMAGE_CUTOUTIMAGE_H_
+#define _SEFRAMEWORK_IMAGE_CUTOUTIMAGE_H_
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "SEFramework/Image/Image.h"
+#include "SEFramework/Image/ImageChunk.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CutoutImage
+ * @brief Full size view of an image, with a region materialized into a contiguous buffer
+ *
+ * @details
+ *  The region is copied once from the wrapped image. Chunks that fall within it are returned
+ *  as views over the buffer, without touching the wrapped image (i.e. the tile cache) anymore.
+ *  Chunks outside, or crossing the border of the region, are still served by the wrapped image,
+ *  so the cutout can be used anywhere the full image is.
+ */
+template<typename T>
+class CutoutImage : public Image<T> {
+protected:
+  CutoutImage(std::shared_ptr<const Image<T>> image, int x, int y, int width, int height)
+    : m_image(std::move(image)) {
+    m_min_x = std::max(x, 0);
+    m_min_y = std::max(y, 0);
+    m_width = std::max(std::min(x + width, m_image->getWidth()) - m_min_x, 0);
+    m_height = std::max(std::min(y + height, m_image->getHeight()) - m_min_y, 0);
+
+    auto data = std::make_shared<std::vector<T>>(m_width * m_height);
+    if (m_width > 0 && m_height > 0) {
+      auto chunk = m_image->getChunk(m_min_x, m_min_y, m_width, m_height);
+      for (int iy = 0; iy < m_height; ++iy) {
+        auto row = chunk->getRowPtr(iy);
+        std::copy(row, row + m_width, data->begin() + iy * m_width);
+      }
+    }
+    m_data = std::move(data);
+  }
+
+public:
+  virtual ~CutoutImage() = default;
+
+  /**
+   * Create a cutout
+   * @param image
+   *    Image to wrap
+   * @param x, y, width, height
+   *    Region to materialize. It is clipped to the image boundaries.
+   */
+  static std::shared_ptr<CutoutImage<T>> create(std::shared_ptr<const Image<T>> image,
+                                                int x, int y, int width, int height) {
+    return std::shared_ptr<CutoutImage<T>>(new CutoutImage<T>(std::move(image), x, y, width, height));
+  }
+
+  std::string getRepr() const override {
+    return "CutoutImage(" + m_image->getRepr() + ", " + std::to_string(m_min_x) + ", " + std::to_string(m_min_y) +
+           ", " + std::to_string(m_width) + ", " + std::to_string(m_height) + ")";
+  }
+
+  int getWidth() const override {
+    return m_image->getWidth();
+  }
+
+  int getHeight() const override {
+    return m_image->getHeight();
+  }
+
+  std::shared_ptr<ImageChunk<T>> getChunk(int x, int y, int width, int height) const override {
+    if (isInCutout(x, y, width, height)) {
+      return ImageChunk<T>::create(m_data, (x - m_min_x) + (y - m_min_y) * m_width, width, height, m_width);
+    }
+    return m_image->getChunk(x, y, width, height);
+  }
+
+  /// @return true if the region is fully contained within the materialized area
+  bool isInCutout(int x, int y, int width, int height) const {
+    return x >= m_min_x && y >= m_min_y && x + width <= m_min_x + m_width && y + height <= m_min_y + m_height;
+  }
+
+  PixelCoordinate getCutoutOffset() const {
+    return PixelCoordinate(m_min_x, m_min_y);
+  }
+
+  int getCutoutWidth() const {
+    return m_width;
+  }
+
+  int getCutoutHeight() const {
+    return m_height;
+  }
+
+private:
+  std::shared_ptr<const Image<T>> m_image;
+  std::shared_ptr<const std::vector<T>> m_data;
+  int m_min_x, m_min_y, m_width, m_height;
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEFRAMEWORK_IMAGE_CUTOUTIMAGE_H_
@@ -75,6 +75,24 @@ public:
   explicit ImageAccessor(const Image<T>& img, AccessHint hint = TOP_LEFT, int w = 64, int h = 64)
       : m_image(&img), m_hint(hint), m_read_width(w), m_read_height(h){};
 
+  /**
+   * Constructor with a known region of interest
+   * @param img
+   *    Image to be accessed
+   * @param region_min, region_max
+   *    Corners of the region, inclusive. Any read within it gets a single chunk covering the whole region
+   *    (i.e. the materialized area of a CutoutImage).
+   * @param hint, w, h
+   *    Used for the reads outside the region
+   */
+  ImageAccessor(std::shared_ptr<const Image<T>> img, const PixelCoordinate& region_min,
+                const PixelCoordinate& region_max, AccessHint hint = TOP_LEFT, int w = 64, int h = 1)
+      : ImageAccessor(std::move(img), hint, w, h) {
+    m_has_region = region_min <= region_max;
+    m_region_min = region_min;
+    m_region_max = region_max;
+  }
+
   /**
    * Can not be copied!
    */
@@ -135,6 +153,8 @@ private:
   PixelCoordinate m_chunk_min, m_chunk_max;
   AccessHint m_hint;
   int m_read_width, m_read_height;
+  bool m_has_region = false;
+  PixelCoordinate m_region_min, m_region_max;
 
   /**
    * Verify if the requested coordinates can be satisfied, and asks
@@ -152,6 +172,11 @@ private:
    * Try to guess what's coming next. It just uses some rudimentary heuristics.
    */
   void nextCoordinates(const PixelCoordinate& coord) {
+    if (m_has_region && coord >= m_region_min && coord <= m_region_max) {
+      m_chunk_min = m_region_min;
+      m_chunk_max = m_region_max;
+      return;
+    }
     if (!m_chunk) {
       m_chunk_min = firstCoordinates(coord);
     }
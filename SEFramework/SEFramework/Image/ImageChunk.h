@@ -65,6 +65,12 @@ public:
     return (*m_data)[m_offset + coord.m_x + coord.m_y * m_stride];
   }
 
+  /// Returns a pointer to the first pixel of the row y. Pixels within a row are contiguous
+  const T* getRowPtr(int y) const {
+    assert(y >= 0 && y < m_height);
+    return m_data->data() + m_offset + y * m_stride;
+  }
+
   /// Returns the width of the image chunk in pixels
   int getWidth() const final {
     return m_width;
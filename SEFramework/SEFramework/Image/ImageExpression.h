@@ -0,0 +1,401 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file SEFramework/Image/ImageExpression.h
+ * @date 10/19/26
+ */
+
+#ifndef _SEFRAMEWORK_IMAGE_IMAGEEXPRESSION_H
+#define _SEFRAMEWORK_IMAGE_IMAGEEXPRESSION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SEFramework/Image/Image.h"
+#include "SEFramework/Image/ImageChunk.h"
+#include "SEFramework/Image/ConstantImage.h"
+
+namespace SourceXtractor {
+
+/**
+ * Per-pixel image expressions composed at compile time.
+ *
+ * Instead of stacking lazy images (ProcessedImage, ThresholdedImage, FunctionalImage...), each one
+ * materializing a chunk for its inputs and another for its output, an expression
+ * like `(image - background) - sqrt(variance) * threshold` is built as a tree of
+ * inlined nodes. ExpressionImage fetches each input chunk once, and evaluates the whole tree
+ * row by row over contiguous buffers, writing into a single output chunk.
+ *
+ * Operators and functions are found via ADL, so they do not interfere with the usual
+ * mathematical functions on plain numbers.
+ */
+namespace ImageExpr {
+
+/**
+ * CRTP base of all the expression nodes
+ */
+template<typename E>
+struct Expression {
+  const E& self() const {
+    return static_cast<const E&>(*this);
+  }
+};
+
+/**
+ * Leaf wrapping an image
+ */
+template<typename T>
+class ImageLeaf : public Expression<ImageLeaf<T>> {
+public:
+  using value_type = T;
+
+  class Bound {
+  public:
+    Bound(const Image<T>& image, int x, int y, int width, int height) : m_row(nullptr), m_is_constant(false) {
+      auto constant = dynamic_cast<const ConstantImage<T>*>(&image);
+      if (constant) {
+        // Avoid materializing a full chunk, a single row is enough
+        m_constant_row.resize(width, constant->getConstantValue());
+        m_row = m_constant_row.data();
+        m_is_constant = true;
+      }
+      else {
+        m_chunk = image.getChunk(x, y, width, height);
+      }
+    }
+
+    void setRow(int iy) {
+      if (!m_is_constant) {
+        m_row = m_chunk->getRowPtr(iy);
+      }
+    }
+
+    T operator[](int ix) const {
+      return m_row[ix];
+    }
+
+  private:
+    std::shared_ptr<ImageChunk<T>> m_chunk;
+    std::vector<T> m_constant_row;
+    const T* m_row;
+    bool m_is_constant;
+  };
+
+  explicit ImageLeaf(std::shared_ptr<const Image<T>> image) : m_image(std::move(image)) {
+    assert(m_image != nullptr);
+  }
+
+  Bound bind(int x, int y, int width, int height) const {
+    return Bound(*m_image, x, y, width, height);
+  }
+
+  int getWidth() const {
+    return m_image->getWidth();
+  }
+
+  int getHeight() const {
+    return m_image->getHeight();
+  }
+
+  std::string getRepr() const {
+    return m_image->getRepr();
+  }
+
+private:
+  std::shared_ptr<const Image<T>> m_image;
+};
+
+/**
+ * Leaf wrapping a scalar
+ */
+template<typename T>
+class ScalarLeaf : public Expression<ScalarLeaf<T>> {
+public:
+  using value_type = T;
+
+  class Bound {
+  public:
+    explicit Bound(T value) : m_value(value) {}
+
+    void setRow(int) {}
+
+    T operator[](int) const {
+      return m_value;
+    }
+
+  private:
+    T m_value;
+  };
+
+  explicit ScalarLeaf(T value) : m_value(value) {}
+
+  Bound bind(int, int, int, int) const {
+    return Bound(m_value);
+  }
+
+  // Scalars adapt to any size
+  int getWidth() const {
+    return -1;
+  }
+
+  int getHeight() const {
+    return -1;
+  }
+
+  std::string getRepr() const {
+    return std::to_string(m_value);
+  }
+
+private:
+  T m_value;
+};
+
+/**
+ * Node applying an unary operation to its operand
+ */
+template<typename Op, typename E>
+class UnaryNode : public Expression<UnaryNode<Op, E>> {
+public:
+  using value_type = typename E::value_type;
+
+  class Bound {
+  public:
+    explicit Bound(typename E::Bound&& operand) : m_operand(std::move(operand)) {}
+
+    void setRow(int iy) {
+      m_operand.setRow(iy);
+    }
+
+    value_type operator[](int ix) const {
+      return Op::apply(m_operand[ix]);
+    }
+
+  private:
+    typename E::Bound m_operand;
+  };
+
+  explicit UnaryNode(const E& operand) : m_operand(operand) {}
+
+  Bound bind(int x, int y, int width, int height) const {
+    return Bound(m_operand.bind(x, y, width, height));
+  }
+
+  int getWidth() const {
+    return m_operand.getWidth();
+  }
+
+  int getHeight() const {
+    return m_operand.getHeight();
+  }
+
+  std::string getRepr() const {
+    return std::string(Op::name()) + "(" + m_operand.getRepr() + ")";
+  }
+
+private:
+  E m_operand;
+};
+
+/**
+ * Node applying a binary operation to its operands
+ */
+template<typename Op, typename L, typename R>
+class BinaryNode : public Expression<BinaryNode<Op, L, R>> {
+public:
+  using value_type = typename L::value_type;
+
+  class Bound {
+  public:
+    Bound(typename L::Bound&& lhs, typename R::Bound&& rhs) : m_lhs(std::move(lhs)), m_rhs(std::move(rhs)) {}
+
+    void setRow(int iy) {
+      m_lhs.setRow(iy);
+      m_rhs.setRow(iy);
+    }
+
+    value_type operator[](int ix) const {
+      return Op::apply(m_lhs[ix], m_rhs[ix]);
+    }
+
+  private:
+    typename L::Bound m_lhs;
+    typename R::Bound m_rhs;
+  };
+
+  BinaryNode(const L& lhs, const R& rhs) : m_lhs(lhs), m_rhs(rhs) {
+    assert(lhs.getWidth() < 0 || rhs.getWidth() < 0 || lhs.getWidth() == rhs.getWidth());
+    assert(lhs.getHeight() < 0 || rhs.getHeight() < 0 || lhs.getHeight() == rhs.getHeight());
+  }
+
+  Bound bind(int x, int y, int width, int height) const {
+    return Bound(m_lhs.bind(x, y, width, height), m_rhs.bind(x, y, width, height));
+  }
+
+  int getWidth() const {
+    return std::max(m_lhs.getWidth(), m_rhs.getWidth());
+  }
+
+  int getHeight() const {
+    return std::max(m_lhs.getHeight(), m_rhs.getHeight());
+  }
+
+  std::string getRepr() const {
+    return std::string(Op::name()) + "(" + m_lhs.getRepr() + "," + m_rhs.getRepr() + ")";
+  }
+
+private:
+  L m_lhs;
+  R m_rhs;
+};
+
+struct AddOp {
+  template<typename T>
+  static T apply(T a, T b) { return a + b; }
+  static const char* name() { return "Add"; }
+};
+
+struct SubtractOp {
+  template<typename T>
+  static T apply(T a, T b) { return a - b; }
+  static const char* name() { return "Subtract"; }
+};
+
+struct MultiplyOp {
+  template<typename T>
+  static T apply(T a, T b) { return a * b; }
+  static const char* name() { return "Multiply"; }
+};
+
+struct DivideOp {
+  template<typename T>
+  static T apply(T a, T b) { return a / b; }
+  static const char* name() { return "Divide"; }
+};
+
+struct MaxOp {
+  template<typename T>
+  static T apply(T a, T b) { return a < b ? b : a; }
+  static const char* name() { return "Max"; }
+};
+
+struct SqrtOp {
+  template<typename T>
+  static T apply(T a) { return std::sqrt(a); }
+  static const char* name() { return "Sqrt"; }
+};
+
+/// Wrap an image so it can be used within an expression
+template<typename I>
+ImageLeaf<typename I::PixelType> image(std::shared_ptr<I> img) {
+  return ImageLeaf<typename I::PixelType>(std::move(img));
+}
+
+#define SE_IMAGE_EXPR_BINARY(FUNC, OP) \
+  template<typename L, typename R> \
+  BinaryNode<OP, L, R> FUNC(const Expression<L>& lhs, const Expression<R>& rhs) { \
+    return BinaryNode<OP, L, R>(lhs.self(), rhs.self()); \
+  } \
+  template<typename L> \
+  BinaryNode<OP, L, ScalarLeaf<typename L::value_type>> FUNC(const Expression<L>& lhs, typename L::value_type rhs) { \
+    return BinaryNode<OP, L, ScalarLeaf<typename L::value_type>>(lhs.self(), ScalarLeaf<typename L::value_type>(rhs)); \
+  } \
+  template<typename R> \
+  BinaryNode<OP, ScalarLeaf<typename R::value_type>, R> FUNC(typename R::value_type lhs, const Expression<R>& rhs) { \
+    return BinaryNode<OP, ScalarLeaf<typename R::value_type>, R>(ScalarLeaf<typename R::value_type>(lhs), rhs.self()); \
+  }
+
+SE_IMAGE_EXPR_BINARY(operator+, AddOp)
+SE_IMAGE_EXPR_BINARY(operator-, SubtractOp)
+SE_IMAGE_EXPR_BINARY(operator*, MultiplyOp)
+SE_IMAGE_EXPR_BINARY(operator/, DivideOp)
+SE_IMAGE_EXPR_BINARY(max, MaxOp)
+
+#undef SE_IMAGE_EXPR_BINARY
+
+template<typename E>
+UnaryNode<SqrtOp, E> sqrt(const Expression<E>& operand) {
+  return UnaryNode<SqrtOp, E>(operand.self());
+}
+
+} // end of namespace ImageExpr
+
+/**
+ * @class ExpressionImage
+ * @brief Image whose pixels are computed evaluating an ImageExpr expression
+ *
+ * @details
+ *  The result of the whole expression is written into a single buffer, using tight loops
+ *  over contiguous rows that the compiler can vectorize.
+ */
+template<typename T, typename E>
+class ExpressionImage : public Image<T> {
+protected:
+  explicit ExpressionImage(const E& expr) : m_expr(expr) {
+    assert(m_expr.getWidth() >= 0 && m_expr.getHeight() >= 0);
+  }
+
+public:
+  virtual ~ExpressionImage() = default;
+
+  static std::shared_ptr<ExpressionImage<T, E>> create(const E& expr) {
+    return std::shared_ptr<ExpressionImage<T, E>>(new ExpressionImage<T, E>(expr));
+  }
+
+  std::string getRepr() const final {
+    return "ExpressionImage(" + m_expr.getRepr() + ")";
+  }
+
+  int getWidth() const final {
+    return m_expr.getWidth();
+  }
+
+  int getHeight() const final {
+    return m_expr.getHeight();
+  }
+
+  std::shared_ptr<ImageChunk<T>> getChunk(int x, int y, int width, int height) const final {
+    auto bound = m_expr.bind(x, y, width, height);
+    std::vector<T> data(width * height);
+    for (int iy = 0; iy < height; ++iy) {
+      bound.setRow(iy);
+      T* out = data.data() + iy * width;
+      for (int ix = 0; ix < width; ++ix) {
+        out[ix] = bound[ix];
+      }
+    }
+    return UniversalImageChunk<T>::create(std::move(data), width, height);
+  }
+
+private:
+  E m_expr;
+};
+
+/**
+ * Convenience factory, so the expression type does not need to be spelled
+ */
+template<typename E>
+std::shared_ptr<ExpressionImage<typename E::value_type, E>> createExpressionImage(const ImageExpr::Expression<E>& expr) {
+  return ExpressionImage<typename E::value_type, E>::create(expr.self());
+}
+
+} // end of namespace SourceXtractor
+
+#endif // _SEFRAMEWORK_IMAGE_IMAGEEXPRESSION_H
@@ -74,6 +74,28 @@ public:
 
   virtual ImageTile::ImageType getType() const = 0;
 
+  /**
+   * Geometry in which the source stores its pixels, i.e. the compression tiles of a FITS image.
+   * Reading a region that does not align with it is more expensive.
+   * @return false if the source has no native tiling
+   */
+  virtual bool getNativeTileSize(int& /*width*/, int& /*height*/) const {
+    return false;
+  }
+
+  /// True if getImageTile can be called concurrently for different tiles
+  virtual bool supportsConcurrentReads() const {
+    return false;
+  }
+
+  /**
+   * Relative cost of producing again a tile evicted from the cache. Reading from disk is
+   * more expensive than, for instance, interpolating a background mesh.
+   */
+  virtual double getRegenerationCost() const {
+    return 1.;
+  }
+
   /**
    * @return A copy of the metadata set
    */
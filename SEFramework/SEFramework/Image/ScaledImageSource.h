@@ -157,6 +157,11 @@ public:
     return ImageTile::getTypeValue(T());
   }
 
+  /// The spline interpolation is cheap compared with reading from disk
+  double getRegenerationCost() const override {
+    return .5;
+  }
+
 private:
   std::shared_ptr<Image<T>> m_image;
   int m_width, m_height;
@@ -24,6 +24,7 @@
 #ifndef _SEFRAMEWORK_IMAGE_TILEMANAGER_H_
 #define _SEFRAMEWORK_IMAGE_TILEMANAGER_H_
 
+#include <atomic>
 #include <iostream>
 #include <thread>
 #include <list>
@@ -42,6 +43,8 @@ namespace SourceXtractor {
 struct TileKey {
   std::shared_ptr<const ImageSource> m_source;
   int m_tile_x, m_tile_y;
+  /// The geometry of a source can change if its access pattern is learned
+  int m_tile_width, m_tile_height;
 
   bool operator==(const TileKey& other) const;
 
@@ -64,6 +67,8 @@ struct hash<SourceXtractor::TileKey> {
     boost::hash_combine(local_hash, key.m_source);
     boost::hash_combine(local_hash, key.m_tile_x);
     boost::hash_combine(local_hash, key.m_tile_y);
+    boost::hash_combine(local_hash, key.m_tile_width);
+    boost::hash_combine(local_hash, key.m_tile_height);
     return local_hash;
   }
 };
@@ -72,9 +77,30 @@ struct hash<SourceXtractor::TileKey> {
 
 namespace SourceXtractor {
 
+/**
+ * @class TileManager
+ * @brief Cache of the image tiles read from the image sources
+ *
+ * @details
+ *  The tile geometry is chosen per source, depending on how it is read: full-width strips for sources
+ *  read row by row (i.e. by the segmentation), squares for sources read in cutouts (i.e. by the measurement).
+ *  The access pattern can be declared, or it is learned from the chunks requested by BufferedImage.
+ *
+ *  When the memory limit is reached, the tiles cheaper to produce again are evicted first
+ *  (see ImageSource::getRegenerationCost), unless they have been used more recently.
+ */
 class TileManager {
 public:
 
+  enum class AccessPattern {
+    /// Learn it from the requests
+    UNKNOWN,
+    /// Full-width strips of rows
+    ROWS,
+    /// Small cutouts at random positions
+    CUTOUTS
+  };
+
   TileManager();
 
   virtual ~TileManager();
@@ -87,6 +113,10 @@ public:
   std::shared_ptr<ImageTile>
   getTileForPixel(int x, int y, std::shared_ptr<const ImageSource> source);
 
+  /// Same as above, with a geometry obtained before from getTileSize
+  std::shared_ptr<ImageTile>
+  getTileForPixel(int x, int y, std::shared_ptr<const ImageSource> source, int tile_width, int tile_height);
+
   static std::shared_ptr<TileManager> getInstance();
 
   void saveAllTiles();
@@ -95,27 +125,86 @@ public:
 
   int getTileHeight() const;
 
+  /**
+   * Tile geometry used for a given source. If the source has a native tiling, the tiles are made of
+   * whole native tiles, covering about the same area as the configured geometry.
+   */
+  void getTileSize(const std::shared_ptr<const ImageSource>& source, int& width, int& height) const;
+
+  /// Declare how the source is going to be read. The geometry of its tiles will not be learned.
+  void setAccessPattern(const std::shared_ptr<const ImageSource>& source, AccessPattern pattern);
+
+  /// Access pattern of the source, as declared or learned until now
+  AccessPattern getAccessPattern(const std::shared_ptr<const ImageSource>& source) const;
+
+  /// Let the tile manager learn how the source is read
+  void recordAccess(const std::shared_ptr<const ImageSource>& source, int width, int height);
+
+  /// Number of lookups served from the cache. Only counted while the Profiler is enabled.
+  uint64_t getCacheHits() const;
+
+  /// Number of lookups that had to read the tile from the source. Only counted while the Profiler is enabled.
+  uint64_t getCacheMisses() const;
+
 private:
 
+  struct SourceProfile {
+    std::weak_ptr<const ImageSource> m_source;
+    bool m_declared;
+    std::atomic<int> m_pattern;
+    std::atomic<uint64_t> m_row_reads, m_cutout_reads;
+
+    SourceProfile(const std::shared_ptr<const ImageSource>& source, AccessPattern pattern, bool declared)
+      : m_source(source), m_declared(declared), m_pattern(static_cast<int>(pattern)),
+        m_row_reads(0), m_cutout_reads(0) {}
+  };
+
+  struct CachedTile {
+    std::shared_ptr<ImageTile> m_tile;
+    double m_cost;
+    /// Refreshed on every hit. The tile with the lowest value is evicted first.
+    std::atomic<double> m_priority;
+
+    CachedTile(std::shared_ptr<ImageTile> tile, double cost, double priority)
+      : m_tile(std::move(tile)), m_cost(cost), m_priority(priority) {}
+  };
+
   std::shared_ptr<ImageTile> tryTileFromCache(const TileKey& key);
 
-  std::shared_ptr<boost::mutex>& getMutexForImageSource(const ImageSource*);
+  std::shared_ptr<SourceProfile> getProfile(const std::shared_ptr<const ImageSource>& source, bool create) const;
+
+  std::shared_ptr<boost::mutex> getMutexForImageSource(const ImageSource*);
+
+  std::shared_ptr<boost::mutex> getMutexForTile(const TileKey& key);
 
   void removeTile(TileKey tile_key);
 
   void removeExtraTiles();
 
-  void addTile(TileKey key, std::shared_ptr<ImageTile> tile);
+  /// @return The cached tile, which is the given one unless the key was already there
+  std::shared_ptr<ImageTile> addTile(TileKey key, std::shared_ptr<ImageTile> tile, double cost);
 
   int m_tile_width, m_tile_height;
   long m_max_memory;
   long m_total_memory_used;
 
-  std::unordered_map<TileKey, std::shared_ptr<ImageTile>> m_tile_map;
+  std::unordered_map<TileKey, CachedTile> m_tile_map;
   std::unordered_map<const ImageSource*, std::shared_ptr<boost::mutex>> m_mutex_map;
+  /// Per tile loading mutexes, for sources that allow concurrent reads. Removed with the tile.
+  std::unordered_map<TileKey, std::shared_ptr<boost::mutex>> m_loading_map;
   std::list<TileKey> m_tile_list;
 
   boost::shared_mutex m_mutex;
+
+  mutable std::unordered_map<const ImageSource*, std::shared_ptr<SourceProfile>> m_profiles;
+  mutable boost::shared_mutex m_profile_mutex;
+
+  /// Priority of the last evicted tile, added to the cost of the tiles when they are used
+  std::atomic<double> m_eviction_clock;
+
+  std::atomic<uint64_t> m_cache_hits, m_cache_misses;
+
+  void countLookup(bool hit);
 };
 
 }
@@ -35,7 +35,10 @@ class WriteableBufferedImage : public BufferedImage<T>, public virtual Writeable
 protected:
 
   WriteableBufferedImage(std::shared_ptr<const ImageSource> source, std::shared_ptr<TileManager> tile_manager)
-      : BufferedImage<T>(source, tile_manager) {}
+      : BufferedImage<T>(source, tile_manager) {
+    // Tiles with pending writes must not be shadowed by tiles with a different geometry
+    this->setAccessPattern(TileManager::AccessPattern::CUTOUTS);
+  }
 
 public:
 
@@ -68,6 +68,9 @@ public:
 
   void receiveProcessSignal(const ProcessSourcesEvent& event) override;
 
+  /// Applies the DeblendSteps to the SourceGroup without notifying it. Returns nullptr if no source is left.
+  std::unique_ptr<SourceGroupInterface> applySteps(std::unique_ptr<SourceGroupInterface> group) const;
+
   /// Returns the set of required properties to compute the deblending
   std::set<PropertyId> requiredProperties() const;
 
@@ -28,10 +28,23 @@
 #include "SEFramework/Pipeline/PipelineStage.h"
 #include "SEFramework/Source/SourceGroupInterface.h"
 #include "SEFramework/Task/TaskProvider.h"
+#include "SEUtils/Observable.h"
 
 namespace SourceXtractor {
 
-class Measurement : public PipelineReceiver<SourceGroupInterface>, public PipelineEmitter<SourceGroupInterface> {
+/**
+ * @struct MeasurementQueueProgress
+ * @brief Used to notify observers of the groups accepted by the measurement and not yet released
+ */
+struct MeasurementQueueProgress {
+  /// Groups in flight
+  size_t groups;
+  /// Estimated memory used by the groups in flight, and the limit (0 if there is none)
+  size_t bytes, max_bytes;
+};
+
+class Measurement : public PipelineReceiver<SourceGroupInterface>, public PipelineEmitter<SourceGroupInterface>,
+                    public Observable<MeasurementQueueProgress> {
 public:
 
   ~Measurement() override = default;
@@ -68,6 +68,9 @@ public:
   void receiveSource(std::unique_ptr<SourceInterface> source) override;
   void receiveProcessSignal(const ProcessSourcesEvent& event) override;
 
+  /// Applies all the steps to the source, and returns the resulting sources without notifying them
+  std::vector<std::unique_ptr<SourceInterface>> applySteps(std::unique_ptr<SourceInterface> source) const;
+
 private:
   std::vector<std::shared_ptr<PartitionStep>> m_steps;
 
@@ -18,6 +18,7 @@
 #ifndef _SEFRAMEWORK_PIPELINE_PIPELINESTAGE_H
 #define _SEFRAMEWORK_PIPELINE_PIPELINESTAGE_H
 
+#include "SEFramework/Pipeline/Profiler.h"
 #include "SEFramework/Source/SourceInterface.h"
 #include "SEUtils/Observable.h"
 
@@ -85,6 +86,7 @@ protected:
   void sendSource(std::unique_ptr<T> source) const {
     Observable<T>::notifyObservers(*source);
     if (m_next_stage) {
+      ProfilerScope scope(Profiler::Category::STAGE, typeid(*m_next_stage));
       m_next_stage->receiveSource(std::move(source));
     }
   }
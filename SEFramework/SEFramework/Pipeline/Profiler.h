@@ -0,0 +1,229 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * Profiler.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEFRAMEWORK_PIPELINE_PROFILER_H_
+#define _SEFRAMEWORK_PIPELINE_PROFILER_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include <boost/thread/shared_mutex.hpp>
+
+#include "SEFramework/Property/PropertyId.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class Profiler
+ * @brief Collects the time spent on each pipeline stage and on each task, and samples gauges
+ * as queue depths or cache hit rates
+ *
+ * @details
+ *  It is disabled by default, and then a ProfilerScope costs a single relaxed atomic read.
+ *  Once enabled, each thread accumulates its own counters and histograms, so there is no
+ *  contention between workers. Scopes nest: the time spent on a scope opened within another
+ *  is accounted as inclusive time for the outer one, but not as its self time.
+ *
+ *  Optionally, each scope is also kept as an event, so the run can be dumped in the
+ *  Chrome trace-event format and opened on a timeline viewer (chrome://tracing, Perfetto...).
+ */
+class Profiler {
+public:
+
+  enum class Category {
+    STAGE, SOURCE_TASK, GROUP_TASK
+  };
+
+  static Profiler& getInstance();
+
+  /**
+   * Start collecting. Call before the pipeline starts.
+   * @param trace
+   *    Keep every scope as an event for writeChromeTrace
+   * @param max_trace_events
+   *    Maximum number of events kept per thread, so the memory does not grow without bound
+   */
+  void enable(bool trace, size_t max_trace_events = 1 << 20);
+
+  /// Stop collecting and forget the collected data
+  void reset();
+
+  bool isEnabled() const {
+    return m_enabled.load(std::memory_order_relaxed);
+  }
+
+  bool isTracing() const {
+    return m_tracing;
+  }
+
+  /// Identifier for a name, so the scopes do not need to hash strings on the hot path
+  unsigned getNameId(Category category, const std::string& name);
+  /// Identifier for a type name (i.e. of a pipeline stage)
+  unsigned getNameId(Category category, std::type_index type);
+  /// Identifier for the task computing a property
+  unsigned getNameId(Category category, const PropertyId& property_id);
+
+  /// Sample the value of a gauge, as the number of objects on a queue
+  void sample(const std::string& gauge, double value);
+
+  /// Dump the aggregated timers and gauges as a JSON document
+  void writeJson(std::ostream& out) const;
+
+  /// Dump the aggregated timers and gauges as a CSV table
+  void writeCsv(std::ostream& out) const;
+
+  /// Dump the collected events in the Chrome trace-event format
+  void writeChromeTrace(std::ostream& out) const;
+
+private:
+  friend class ProfilerScope;
+
+  /// Power of two buckets, in nanoseconds: the last one goes above 9 minutes
+  static const size_t HISTOGRAM_BUCKETS = 40;
+
+  struct TimerStats {
+    uint64_t m_calls = 0;
+    int64_t m_total = 0, m_self = 0, m_min = 0, m_max = 0;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> m_histogram{};
+
+    void add(int64_t duration, int64_t self);
+    void merge(const TimerStats& other);
+    /// Upper bound of the bucket containing the given quantile
+    int64_t quantile(double q) const;
+  };
+
+  struct TraceEvent {
+    unsigned m_name_id;
+    int64_t m_start, m_duration;
+  };
+
+  struct ThreadState {
+    unsigned m_thread_id;
+    mutable std::mutex m_mutex;
+    std::vector<TimerStats> m_timers;
+    std::vector<TraceEvent> m_events;
+    // Time spent on nested scopes, one entry per open scope
+    std::vector<int64_t> m_children;
+  };
+
+  struct GaugeStats {
+    uint64_t m_samples = 0;
+    double m_sum = 0, m_min = 0, m_max = 0, m_last = 0;
+  };
+
+  struct GaugeEvent {
+    unsigned m_gauge_id;
+    int64_t m_time;
+    double m_value;
+  };
+
+  struct AggregatedTimer {
+    Category m_category;
+    std::string m_name;
+    TimerStats m_stats;
+  };
+
+  Profiler() : m_enabled(false), m_tracing(false), m_max_trace_events(0) {}
+
+  int64_t now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - m_origin).count();
+  }
+
+  ThreadState& getThreadState();
+  void record(unsigned name_id, int64_t start, int64_t duration, int64_t self);
+  std::vector<AggregatedTimer> aggregate() const;
+
+  std::atomic<bool> m_enabled;
+  bool m_tracing;
+  size_t m_max_trace_events;
+  std::chrono::steady_clock::time_point m_origin;
+
+  mutable boost::shared_mutex m_names_mutex;
+  std::vector<std::pair<Category, std::string>> m_names;
+  std::map<std::pair<Category, std::string>, unsigned> m_name_ids;
+  std::map<std::pair<Category, std::type_index>, unsigned> m_type_ids;
+  std::map<std::pair<Category, PropertyId>, unsigned> m_property_ids;
+
+  mutable std::mutex m_threads_mutex;
+  std::list<ThreadState> m_threads;
+
+  mutable std::mutex m_gauges_mutex;
+  std::vector<std::string> m_gauge_names;
+  std::unordered_map<std::string, unsigned> m_gauge_ids;
+  std::vector<GaugeStats> m_gauges;
+  std::vector<GaugeEvent> m_gauge_events;
+};
+
+/**
+ * @class ProfilerScope
+ * @brief Times its own lifetime, if the Profiler is enabled
+ */
+class ProfilerScope {
+public:
+  ProfilerScope(Profiler::Category category, const PropertyId& property_id) : m_active(false) {
+    auto& profiler = Profiler::getInstance();
+    if (profiler.isEnabled()) {
+      start(profiler, profiler.getNameId(category, property_id));
+    }
+  }
+
+  ProfilerScope(Profiler::Category category, std::type_index type) : m_active(false) {
+    auto& profiler = Profiler::getInstance();
+    if (profiler.isEnabled()) {
+      start(profiler, profiler.getNameId(category, type));
+    }
+  }
+
+  ProfilerScope(Profiler::Category category, const std::string& name) : m_active(false) {
+    auto& profiler = Profiler::getInstance();
+    if (profiler.isEnabled()) {
+      start(profiler, profiler.getNameId(category, name));
+    }
+  }
+
+  ~ProfilerScope();
+
+  ProfilerScope(const ProfilerScope&) = delete;
+  ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+  void start(Profiler& profiler, unsigned name_id);
+
+  bool m_active;
+  unsigned m_name_id;
+  int64_t m_start;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEFRAMEWORK_PIPELINE_PROFILER_H_ */
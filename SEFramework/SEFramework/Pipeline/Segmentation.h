@@ -23,9 +23,12 @@
 #ifndef _SEFRAMEWORK_PIPELINE_SEGMENTATION_H
 #define _SEFRAMEWORK_PIPELINE_SEGMENTATION_H
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 
+#include "ElementsKernel/Exception.h"
+#include "SEUtils/PixelRectangle.h"
 #include "SEFramework/CoordinateSystem/CoordinateSystem.h"
 #include "SEFramework/Frame/Frame.h"
 #include "SEFramework/Image/Image.h"
@@ -74,6 +77,9 @@ public:
   /// Processes a Frame notifying Observers with a Source object for each detection
   void processFrame(std::shared_ptr<DetectionImageFrame> frame) const;
 
+  /// Restrict the detection to a region of the frames. Must be called after setLabelling.
+  void setDetectionRegion(const PixelRectangle& region);
+
 private:
   std::unique_ptr<Labelling> m_labelling;
   std::shared_ptr<DetectionImageFrame::ImageFilter> m_filter_image_processing;
@@ -112,6 +118,29 @@ public:
   Labelling() {}
 
   virtual void labelImage(Segmentation::LabellingListener& listener, std::shared_ptr<const DetectionImageFrame> frame) = 0;
+
+  /// Labelling implementations that support it will only look for detections within this region
+  void setRegion(const PixelRectangle& region) {
+    m_region = region;
+  }
+
+protected:
+  /// @return The region to label, clipped to the image size. The full image if no region was set.
+  PixelRectangle getRegion(int width, int height) const {
+    if (m_region.getWidth() <= 0) {
+      return PixelRectangle(PixelCoordinate(0, 0), PixelCoordinate(width - 1, height - 1));
+    }
+    PixelCoordinate top_left(std::max(0, m_region.getTopLeft().m_x), std::max(0, m_region.getTopLeft().m_y));
+    PixelCoordinate bottom_right(std::min(width - 1, m_region.getBottomRight().m_x),
+                                 std::min(height - 1, m_region.getBottomRight().m_y));
+    if (top_left.m_x > bottom_right.m_x || top_left.m_y > bottom_right.m_y) {
+      throw Elements::Exception() << "The detection region is outside the image";
+    }
+    return PixelRectangle(top_left, bottom_right);
+  }
+
+private:
+  PixelRectangle m_region;
 };
 
 } /* namespace SourceXtractor */
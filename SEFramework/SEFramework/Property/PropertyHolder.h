@@ -25,6 +25,8 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
+#include <boost/thread/shared_mutex.hpp>
 
 #include "SEFramework/Property/PropertyId.h"
 #include "SEFramework/Property/Property.h"
@@ -36,7 +38,10 @@ namespace SourceXtractor {
  * @class PropertyHolder
  * @brief A class providing a simple implementation of a container of properties.
  *
- * @details This class is used to provide a common implementation for objects that have properties
+ * @details This class is used to provide a common implementation for objects that have properties.
+ *  Properties can be read and set concurrently. Since a property can be computed twice
+ *  by concurrent threads, an overwritten property is kept alive until clear() is called, so
+ *  references handed out by getProperty remain valid.
  *
  */
 
@@ -70,6 +75,8 @@ public:
 private:
 
   std::unordered_map<PropertyId, std::unique_ptr<Property>> m_properties;
+  std::vector<std::unique_ptr<Property>> m_retired;
+  mutable boost::shared_mutex m_mutex;
 
 }; /* End of ObjectWithProperties class */
 
@@ -24,6 +24,11 @@
 #ifndef _SEIMPLEMENTATION_PSF_VARIABLEPSF_H_
 #define _SEIMPLEMENTATION_PSF_VARIABLEPSF_H_
 
+#include <list>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
 #include "SEFramework/Image/VectorImage.h"
 #include "SEFramework/Psf/Psf.h"
 
@@ -117,6 +122,17 @@ public:
    */
   std::shared_ptr<VectorImage<SeFloat>> getPsf(const std::vector<double>& values) const override;
 
+  /**
+   * Enable the caching of the reconstructed PSFs. The pixel coordinates (i.e. X_IMAGE) are divided
+   * into cells of the given size, and the PSF is evaluated once per cell, at its center.
+   * Any other component is used as given, so it is only reused for identical values.
+   * @param cell_size
+   *    Size of the cells, in pixels. 0 disables the cache.
+   * @param max_bytes
+   *    Maximum memory used by the cached PSFs. When reached, the oldest entries are dropped.
+   */
+  void setCache(double cell_size, size_t max_bytes);
+
 private:
   double                                             m_pixel_sampling;
   std::vector<Component>                             m_components;
@@ -125,6 +141,19 @@ private:
   std::vector<std::shared_ptr<VectorImage<SeFloat>>> m_coefficients;
   std::vector<std::vector<int>>                      m_exponents;
 
+  double m_cache_cell_size;
+  /// Components moved to the center of their cell, instead of used as given
+  std::vector<bool> m_cache_quantized;
+  size_t m_cache_max_entries;
+  mutable boost::shared_mutex m_cache_mutex;
+  /// Indexed by the component values the PSF has been evaluated at
+  mutable std::unordered_map<std::vector<double>, std::shared_ptr<const VectorImage<SeFloat>>,
+                             boost::hash<std::vector<double>>> m_cache;
+  mutable std::list<std::vector<double>> m_cache_order;
+
+  /// Evaluates the polynomial for the given component values
+  std::shared_ptr<VectorImage<SeFloat>> computePsf(const std::vector<double>& values) const;
+
   /// Verify that the preconditions of getPsf are met at construction time
   void selfTest();
 
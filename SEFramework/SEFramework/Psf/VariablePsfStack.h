@@ -24,12 +24,31 @@
 #ifndef _SEIMPLEMENTATION_PSF_VARIABLEPSFSTACK_H_
 #define _SEIMPLEMENTATION_PSF_VARIABLEPSFSTACK_H_
 
+#include <list>
+#include <unordered_map>
+#include <boost/thread/shared_mutex.hpp>
 #include <CCfits/CCfits>
 #include <SEFramework/Image/VectorImage.h>
 #include <SEFramework/Psf/Psf.h>
+#include <SEUtils/KdTree.h>
 
 namespace SourceXtractor {
 
+/**
+ * Position of one of the PSFs of the stack, used to index them spatially
+ */
+struct VariablePsfStackPosition {
+  double m_x, m_y;
+  long m_index;
+};
+
+template <>
+struct KdTreeTraits<VariablePsfStackPosition> {
+  static double getCoord(const VariablePsfStackPosition& p, size_t index) {
+    return index == 0 ? p.m_x : p.m_y;
+  }
+};
+
 /**
  * @class VariablePsfStack
  *
@@ -45,7 +64,8 @@ public:
   /**
    * Constructor
    */
-  explicit VariablePsfStack(std::shared_ptr<CCfits::FITS> pFits) : m_pFits(pFits), m_psf_size(0), mm_pixel_sampling(0.0) {
+  explicit VariablePsfStack(std::shared_ptr<CCfits::FITS> pFits) : m_pFits(pFits), m_psf_size(0), mm_pixel_sampling(0.0),
+    m_stack_width(0), m_max_cached_stamps(0) {
     setup(pFits);
     selfTest();
   };
@@ -108,6 +128,25 @@ private:
 
   std::vector<std::string> m_components = {"X_IMAGE", "Y_IMAGE"};
 
+  // Spatial index over (m_x_values, m_y_values)
+  std::unique_ptr<KdTree<VariablePsfStackPosition>> m_position_index;
+
+  // Whole stack image, only loaded if it is small enough
+  std::valarray<SeFloat> m_stack_data;
+  long m_stack_width;
+
+  // Otherwise, recently used stamps are kept here. Entries are evicted in insertion order
+  // so lookups only need a shared lock.
+  mutable boost::shared_mutex m_cache_mutex;
+  mutable std::unordered_map<long, std::shared_ptr<const std::valarray<SeFloat>>> m_stamp_cache;
+  mutable std::list<long> m_stamp_cache_order;
+  size_t m_max_cached_stamps;
+
+  /*
+   * Read from the file the stamp for the given PSF index, or get it from the cache
+   */
+  std::shared_ptr<const std::valarray<SeFloat>> getStamp(long index) const;
+
   /*
    * Check the file, load the positions and so on
    */
@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ElementsKernel/Exception.h"
 
@@ -54,6 +55,10 @@ public:
   std::shared_ptr<const T> getTask(const PropertyId& property_id) const {
     return std::dynamic_pointer_cast<const T>(getTask(property_id));
   }
+
+  /// Returns the ids of all the properties for which a task has been requested so far
+  std::vector<PropertyId> getKnownPropertyIds() const;
+
 protected:
   /// Requests a Task that will be used to compute the property corresponding to the property_id
   virtual std::shared_ptr<const Task> getTask(const PropertyId& property_id) const;
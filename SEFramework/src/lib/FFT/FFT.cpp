@@ -21,10 +21,15 @@
  */
 
 #include "SEFramework/FFT/FFT.h"
+#include <ElementsKernel/Exception.h>
+#include <boost/thread/locks.hpp>
 #include <boost/thread/shared_mutex.hpp>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <fftw3.h>
 #include <map>
+#include <tuple>
 
 namespace SourceXtractor {
 
@@ -39,12 +44,20 @@ typename FFTTraits<float>::func_plan_inv_t*     FFTTraits<float>::func_plan_inv{
 typename FFTTraits<float>::func_destroy_plan_t* FFTTraits<float>::func_destroy_plan{fftwf_destroy_plan};
 typename FFTTraits<float>::func_execute_fwd_t*  FFTTraits<float>::func_execute_fwd{fftwf_execute_dft_r2c};
 typename FFTTraits<float>::func_execute_inv_t*  FFTTraits<float>::func_execute_inv{fftwf_execute_dft_c2r};
+typename FFTTraits<float>::func_plan_c2c_t*     FFTTraits<float>::func_plan_c2c{fftwf_plan_dft_2d};
+typename FFTTraits<float>::func_execute_c2c_t*  FFTTraits<float>::func_execute_c2c{fftwf_execute_dft};
+typename FFTTraits<float>::func_import_wisdom_t* FFTTraits<float>::func_import_wisdom{fftwf_import_wisdom_from_filename};
+typename FFTTraits<float>::func_export_wisdom_t* FFTTraits<float>::func_export_wisdom{fftwf_export_wisdom_to_filename};
 
 typename FFTTraits<double>::func_plan_fwd_t*     FFTTraits<double>::func_plan_fwd{fftw_plan_dft_r2c_2d};
 typename FFTTraits<double>::func_plan_inv_t*     FFTTraits<double>::func_plan_inv{fftw_plan_dft_c2r_2d};
 typename FFTTraits<double>::func_destroy_plan_t* FFTTraits<double>::func_destroy_plan{fftw_destroy_plan};
 typename FFTTraits<double>::func_execute_fwd_t*  FFTTraits<double>::func_execute_fwd{fftw_execute_dft_r2c};
 typename FFTTraits<double>::func_execute_inv_t*  FFTTraits<double>::func_execute_inv{fftw_execute_dft_c2r};
+typename FFTTraits<double>::func_plan_c2c_t*     FFTTraits<double>::func_plan_c2c{fftw_plan_dft_2d};
+typename FFTTraits<double>::func_execute_c2c_t*  FFTTraits<double>::func_execute_c2c{fftw_execute_dft};
+typename FFTTraits<double>::func_import_wisdom_t* FFTTraits<double>::func_import_wisdom{fftw_import_wisdom_from_filename};
+typename FFTTraits<double>::func_export_wisdom_t* FFTTraits<double>::func_export_wisdom{fftw_export_wisdom_to_filename};
 
 int fftRoundDimension(int size) {
   // Precomputed lookup table for the optimal dimension
@@ -107,48 +120,108 @@ int fftRoundDimension(int size) {
   return (size / 512 + (size % 512 != 0)) * 512;
 }
 
+namespace {
+
+enum class PlanKind {
+  FORWARD, INVERSE, COMPLEX_FORWARD, COMPLEX_INVERSE
+};
+
+typedef std::tuple<PlanKind, int, int> PlanKey;
+
+/// Planner rigor for the new plans
+std::atomic<unsigned> fftw_planner_flags{FFTW_ESTIMATE};
+
+/// Plans shared by all threads
 template <typename T>
-auto FFT<T>::createForwardPlan(int width, int height, std::vector<T>& inout) -> plan_ptr_t {
-  size_t phy_height = height;
-  size_t phy_width  = 2 * (width / 2 + 1);
-  size_t mem_size = phy_height * phy_width;
+struct SharedPlanCache {
+  boost::shared_mutex                                      m_mutex;
+  std::map<PlanKey, typename FFT<T>::plan_ptr_t>           m_plans;
 
-  // Make sure the buffers are big enough
-  if (inout.size() < mem_size) {
-    inout.resize(mem_size);
+  static SharedPlanCache& getInstance() {
+    static SharedPlanCache s_cache;
+    return s_cache;
   }
+};
 
-  // Cache plan, as they can be reused
-  static boost::shared_mutex                        mutex;
-  static std::map<std::tuple<int, int>, plan_ptr_t> plan_cache;
+/**
+ * Get the plan from the cache of the calling thread, which needs no locking. Otherwise, from the shared
+ * cache, which needs a read lock. Only if it is not there, plan, serialized by fftw_global_plan_mutex.
+ * The planner gets a scratch buffer, so rigor levels above FFTW_ESTIMATE do not overwrite caller's data.
+ */
+template <typename T, typename Planner>
+typename FFT<T>::plan_ptr_t getPlan(PlanKind kind, int width, int height, size_t mem_size, Planner planner) {
+  typedef typename FFT<T>::plan_ptr_t plan_ptr_t;
+  static thread_local std::map<PlanKey, plan_ptr_t> local_plans;
 
-  boost::upgrade_lock<boost::shared_mutex> read_lock{mutex};
+  auto key = std::make_tuple(kind, width, height);
+  auto li = local_plans.find(key);
+  if (li != local_plans.end()) {
+    return li->second;
+  }
 
-  auto pi = plan_cache.find(std::make_tuple(width, height));
-  if (pi != plan_cache.end()) {
-    return pi->second;
+  auto& shared = SharedPlanCache<T>::getInstance();
+  {
+    boost::shared_lock<boost::shared_mutex> read_lock{shared.m_mutex};
+    auto pi = shared.m_plans.find(key);
+    if (pi != shared.m_plans.end()) {
+      return local_plans.emplace(key, pi->second).first->second;
+    }
   }
 
-  // No available plan yet, so get one from FFTW
-  boost::upgrade_to_unique_lock<boost::shared_mutex> write_lock{read_lock};
-  boost::lock_guard<boost::mutex>                    lock_planner{fftw_global_plan_mutex};
-
-  pi = plan_cache.emplace(
-    std::make_tuple(width, height),
-    plan_ptr_t{
-      fftw_traits::func_plan_fwd(
-          height, width, // n0, n1
-          inout.data(), reinterpret_cast<complex_t*>(inout.data()), // in, out
-          FFTW_ESTIMATE | FFTW_DESTROY_INPUT // flags
-        ),
-        fftw_traits::func_destroy_plan}
-  ).first;
-
-  return pi->second;
+  // Readers are not blocked while planning, which may be slow for rigorous planning
+  boost::lock_guard<boost::mutex> lock_planner{fftw_global_plan_mutex};
+  {
+    // Someone may have planned it while we waited
+    boost::shared_lock<boost::shared_mutex> read_lock{shared.m_mutex};
+    auto pi = shared.m_plans.find(key);
+    if (pi != shared.m_plans.end()) {
+      return local_plans.emplace(key, pi->second).first->second;
+    }
+  }
+  std::vector<T> scratch(mem_size);
+  plan_ptr_t plan{planner(scratch.data(), fftw_planner_flags | FFTW_DESTROY_INPUT),
+                  FFTTraits<T>::func_destroy_plan};
+  {
+    boost::unique_lock<boost::shared_mutex> write_lock{shared.m_mutex};
+    shared.m_plans.emplace(key, plan);
+  }
+  return local_plans.emplace(key, plan).first->second;
 }
 
+/// Reusable buffers of the calling thread
 template <typename T>
-auto FFT<T>::createInversePlan(int width, int height, std::vector<T>& inout) -> plan_ptr_t {
+std::vector<std::vector<T>>& localBufferPool() {
+  static thread_local std::vector<std::vector<T>> s_pool;
+  return s_pool;
+}
+
+}  // end of anonymous namespace
+
+void fftSetPlannerFlags(unsigned flags) {
+  fftw_planner_flags = flags;
+}
+
+unsigned fftGetPlannerFlags() {
+  return fftw_planner_flags;
+}
+
+bool fftImportWisdom(const std::string& path) {
+  boost::lock_guard<boost::mutex> lock_planner{fftw_global_plan_mutex};
+  bool single = FFTTraits<float>::func_import_wisdom(path.c_str());
+  bool dbl = FFTTraits<double>::func_import_wisdom((path + ".double").c_str());
+  return single || dbl;
+}
+
+void fftExportWisdom(const std::string& path) {
+  boost::lock_guard<boost::mutex> lock_planner{fftw_global_plan_mutex};
+  if (!FFTTraits<float>::func_export_wisdom(path.c_str()) ||
+      !FFTTraits<double>::func_export_wisdom((path + ".double").c_str())) {
+    throw Elements::Exception() << "Could not write the FFTW wisdom into " << path;
+  }
+}
+
+template <typename T>
+auto FFT<T>::createForwardPlan(int width, int height, std::vector<T>& inout) -> plan_ptr_t {
   size_t phy_height = height;
   size_t phy_width  = 2 * (width / 2 + 1);
   size_t mem_size = phy_height * phy_width;
@@ -158,33 +231,33 @@ auto FFT<T>::createInversePlan(int width, int height, std::vector<T>& inout) ->
     inout.resize(mem_size);
   }
 
-  // Cache plan, as they can be reused
-  static boost::shared_mutex                        mutex;
-  static std::map<std::tuple<int, int>, plan_ptr_t> plan_cache;
+  return getPlan<T>(PlanKind::FORWARD, width, height, mem_size, [width, height](T* data, unsigned flags) {
+    return fftw_traits::func_plan_fwd(
+      height, width, // n0, n1
+      data, reinterpret_cast<complex_t*>(data), // in, out
+      flags
+    );
+  });
+}
 
-  boost::upgrade_lock<boost::shared_mutex> read_lock{mutex};
+template <typename T>
+auto FFT<T>::createInversePlan(int width, int height, std::vector<T>& inout) -> plan_ptr_t {
+  size_t phy_height = height;
+  size_t phy_width  = 2 * (width / 2 + 1);
+  size_t mem_size = phy_height * phy_width;
 
-  auto pi = plan_cache.find(std::make_tuple(width, height));
-  if (pi != plan_cache.end()) {
-    return pi->second;
+  // Make sure the buffers are big enough
+  if (inout.size() < mem_size) {
+    inout.resize(mem_size);
   }
 
-  // No available plan yet, so get one from FFTW
-  boost::upgrade_to_unique_lock<boost::shared_mutex> write_lock{read_lock};
-  boost::lock_guard<boost::mutex>                    lock_planner{fftw_global_plan_mutex};
-
-  pi = plan_cache.emplace(
-    std::make_tuple(width, height),
-    plan_ptr_t{
-      fftw_traits::func_plan_inv(
-        height, width,       // n0, n1
-        reinterpret_cast<complex_t*>(inout.data()), inout.data(),  // in, out
-        FFTW_ESTIMATE | FFTW_DESTROY_INPUT // flags
-      ),
-      fftw_traits::func_destroy_plan}
- ).first;
-
-  return pi->second;
+  return getPlan<T>(PlanKind::INVERSE, width, height, mem_size, [width, height](T* data, unsigned flags) {
+    return fftw_traits::func_plan_inv(
+      height, width, // n0, n1
+      reinterpret_cast<complex_t*>(data), data, // in, out
+      flags
+    );
+  });
 }
 
 template <typename T>
@@ -197,6 +270,71 @@ void FFT<T>::executeInverse(plan_ptr_t& plan, std::vector<T>& inout) {
   fftw_traits::func_execute_inv(plan.get(), reinterpret_cast<complex_t*>(inout.data()), inout.data());
 }
 
+template <typename T>
+auto FFT<T>::createComplexPlan(int width, int height, bool inverse, std::vector<T>& inout) -> plan_ptr_t {
+  size_t mem_size = 2 * static_cast<size_t>(width) * height;
+
+  // Make sure the buffers are big enough
+  if (inout.size() < mem_size) {
+    inout.resize(mem_size);
+  }
+
+  auto kind = inverse ? PlanKind::COMPLEX_INVERSE : PlanKind::COMPLEX_FORWARD;
+  return getPlan<T>(kind, width, height, mem_size, [width, height, inverse](T* data, unsigned flags) {
+    auto complex_data = reinterpret_cast<complex_t*>(data);
+    return fftw_traits::func_plan_c2c(
+      height, width, // n0, n1
+      complex_data, complex_data, // in, out
+      inverse ? FFTW_BACKWARD : FFTW_FORWARD,
+      flags
+    );
+  });
+}
+
+template <typename T>
+std::vector<T> FFT<T>::acquireBuffer(size_t size) {
+  auto& pool = localBufferPool<T>();
+  // Prefer the smallest buffer that is big enough, to leave the big ones for big requests
+  auto best = pool.end();
+  for (auto i = pool.begin(); i != pool.end(); ++i) {
+    if (i->capacity() >= size && (best == pool.end() || i->capacity() < best->capacity())) {
+      best = i;
+    }
+  }
+  if (best == pool.end()) {
+    return std::vector<T>(size);
+  }
+  std::vector<T> buffer = std::move(*best);
+  pool.erase(best);
+  buffer.resize(size);
+  return buffer;
+}
+
+template <typename T>
+void FFT<T>::releaseBuffer(std::vector<T>&& buffer) {
+  if (buffer.capacity() == 0) {
+    return;
+  }
+  auto& pool = localBufferPool<T>();
+  if (pool.size() >= MAX_POOLED_BUFFERS) {
+    // Drop the smallest, the big ones are the most expensive to get again
+    auto smallest = std::min_element(pool.begin(), pool.end(), [](const std::vector<T>& a, const std::vector<T>& b) {
+      return a.capacity() < b.capacity();
+    });
+    if (smallest->capacity() >= buffer.capacity()) {
+      return;
+    }
+    pool.erase(smallest);
+  }
+  pool.emplace_back(std::move(buffer));
+}
+
+template <typename T>
+void FFT<T>::executeComplex(plan_ptr_t& plan, std::vector<T>& inout) {
+  auto complex_data = reinterpret_cast<complex_t*>(inout.data());
+  fftw_traits::func_execute_c2c(plan.get(), complex_data, complex_data);
+}
+
 template struct FFT<float>;
 template struct FFT<double>;
 
@@ -77,7 +77,11 @@ FitsImageSource::FitsImageSource(const std::string& filename, int hdu_number,
     : m_filename(filename)
     , m_file_manager(std::move(manager))
     , m_handler(m_file_manager->getFileHandler(filename))
-    , m_hdu_number(hdu_number) {
+    , m_hdu_number(hdu_number)
+    , m_current_layer(0)
+    , m_native_tile_width(0)
+    , m_native_tile_height(0)
+    , m_read_only(true) {
   int status = 0;
   int bitpix, naxis;
   long naxes[3] = {1, 1, 1};
@@ -107,6 +111,18 @@ FitsImageSource::FitsImageSource(const std::string& filename, int hdu_number,
   m_height = naxes[1];
   m_depth = naxis >= 3 ? naxes[2] : 1;
 
+  // Tile-compressed images are decompressed by whole tiles. Without ZTILEn, cfitsio compresses row by row
+  if (fits_is_compressed_image(fptr, &status)) {
+    long ztile[2] = {m_width, 1};
+    for (int i = 0; i < 2; ++i) {
+      int key_status = 0;
+      std::string keyword = "ZTILE" + std::to_string(i + 1);
+      fits_read_key(fptr, TLONG, keyword.c_str(), &ztile[i], nullptr, &key_status);
+    }
+    m_native_tile_width = ztile[0];
+    m_native_tile_height = ztile[1];
+  }
+
   if (image_type < 0) {
     m_image_type = convertImageType(bitpix);
   }
@@ -123,7 +139,11 @@ FitsImageSource::FitsImageSource(const std::string& filename, int width, int hei
     , m_handler(m_file_manager->getFileHandler(filename))
     , m_width(width)
     , m_height(height)
-    , m_image_type(image_type) {
+    , m_image_type(image_type)
+    , m_current_layer(0)
+    , m_native_tile_width(0)
+    , m_native_tile_height(0)
+    , m_read_only(false) {
 
   int status = 0;
   fitsfile* fptr = nullptr;
@@ -231,6 +251,15 @@ std::shared_ptr<ImageTile> FitsImageSource::getImageTile(int x, int y, int width
   return tile;
 }
 
+bool FitsImageSource::getNativeTileSize(int& width, int& height) const {
+  if (m_native_tile_width <= 0 || m_native_tile_height <= 0) {
+    return false;
+  }
+  width = m_native_tile_width;
+  height = m_native_tile_height;
+  return true;
+}
+
 void FitsImageSource::saveTile(ImageTile& tile) {
   auto acc  = m_handler->getAccessor<FitsFile>(FileHandler::kWrite);
   auto fptr = acc->m_fd.getFitsFilePtr();
@@ -19,10 +19,8 @@
 #include "SEFramework/Image/ImageAccessor.h"
 #include "SEFramework/Image/BufferedImage.h"
 #include "SEFramework/Image/ConstantImage.h"
-#include "SEFramework/Image/FunctionalImage.h"
+#include "SEFramework/Image/ImageExpression.h"
 #include "SEFramework/Image/InterpolatedImageSource.h"
-#include "SEFramework/Image/ProcessedImage.h"
-#include "SEFramework/Image/ThresholdedImage.h"
 
 
 namespace SourceXtractor {
@@ -121,7 +119,7 @@ std::shared_ptr<Image<T>> Frame<T>::getInterpolatedImage() const {
 
 template<typename T>
 std::shared_ptr<Image<T>> Frame<T>::getSubtractedImage() const {
-  return SubtractImage<T>::create(getInterpolatedImage(), getBackgroundLevelMap());
+  return createExpressionImage(ImageExpr::image(getInterpolatedImage()) - ImageExpr::image(getBackgroundLevelMap()));
 }
 
 
@@ -133,13 +131,25 @@ std::shared_ptr<Image<T>> Frame<T>::getFilteredImage() const {
 
 template<typename T>
 std::shared_ptr<Image<T>> Frame<T>::getThresholdedImage() const {
-  return ThresholdedImage<T>::create(getFilteredImage(), getVarianceMap(), m_detection_threshold);
+  auto variance = ImageExpr::image(getVarianceMap());
+  // Without filter, fuse the background subtraction with the thresholding
+  if (m_filter == nullptr) {
+    return createExpressionImage(
+      ImageExpr::image(getInterpolatedImage()) - ImageExpr::image(getBackgroundLevelMap()) -
+      sqrt(variance) * m_detection_threshold);
+  }
+  return createExpressionImage(ImageExpr::image(getFilteredImage()) - sqrt(variance) * m_detection_threshold);
 }
 
 
 template<typename T>
 std::shared_ptr<Image<T>> Frame<T>::getSnrImage() const {
-  return SnrImage<T>::create(getFilteredImage(), getVarianceMap());
+  auto variance = ImageExpr::image(getVarianceMap());
+  if (m_filter == nullptr) {
+    return createExpressionImage(
+      (ImageExpr::image(getInterpolatedImage()) - ImageExpr::image(getBackgroundLevelMap())) / sqrt(variance));
+  }
+  return createExpressionImage(ImageExpr::image(getFilteredImage()) / sqrt(variance));
 }
 
 
@@ -162,12 +172,7 @@ std::shared_ptr<WeightImage> Frame<T>::getUnfilteredVarianceMap() const {
 
 template<typename T>
 std::shared_ptr<Image<T>> Frame<T>::getDetectionThresholdMap() const {
-  struct ThresholdOperation {
-    static T process(const T& a, const T& b) { return sqrt(a) * b; }
-  };
-
-  using ThresholdImage = ProcessedImage<T, ThresholdOperation>;
-  return ThresholdImage::create(m_variance_map, m_detection_threshold);
+  return createExpressionImage(sqrt(ImageExpr::image(m_variance_map)) * m_detection_threshold);
 }
 
 
@@ -261,16 +266,10 @@ void Frame<T>::setLabel(const std::string& label) {
 template<typename T>
 void Frame<T>::applyFilter() {
   if (m_filter != nullptr) {
-    m_filtered_image = m_filter->processImage(getSubtractedImage(), getUnfilteredVarianceMap(),
-                                              m_variance_threshold);
-    auto filtered_variance_map = m_filter->processImage(getUnfilteredVarianceMap(),
-                                                        getUnfilteredVarianceMap(),
-                                                        m_variance_threshold);
-    m_filtered_variance_map = FunctionalImage<T>::create(
-      filtered_variance_map, [](int, int, WeightImage::PixelType v) {
-        return std::max(v, 0.f);
-      }
-    );
+    auto filtered = m_filter->processImageAndVariance(getSubtractedImage(), getUnfilteredVarianceMap(),
+                                                      m_variance_threshold);
+    m_filtered_image = filtered.first;
+    m_filtered_variance_map = createExpressionImage(max(ImageExpr::image(filtered.second), 0.f));
   }
   else {
     m_filtered_image = getSubtractedImage();
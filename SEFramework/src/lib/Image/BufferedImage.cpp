@@ -53,10 +53,18 @@ int BufferedImage<T>::getHeight() const {
 }
 
 
+template<typename T>
+void BufferedImage<T>::setAccessPattern(TileManager::AccessPattern pattern) {
+  m_tile_manager->setAccessPattern(m_source, pattern);
+}
+
+
 template<typename T>
 std::shared_ptr<ImageChunk<T>> BufferedImage<T>::getChunk(int x, int y, int width, int height) const {
-  int tile_width = m_tile_manager->getTileWidth();
-  int tile_height = m_tile_manager->getTileHeight();
+  m_tile_manager->recordAccess(m_source, width, height);
+
+  int tile_width, tile_height;
+  m_tile_manager->getTileSize(m_source, tile_width, tile_height);
   int tile_offset_x = x % tile_width;
   int tile_offset_y = y % tile_height;
 
@@ -65,7 +73,8 @@ std::shared_ptr<ImageChunk<T>> BufferedImage<T>::getChunk(int x, int y, int widt
     // the tile image is going to be kept in memory as long as the chunk exists, but it could be unloaded
     // from TileManager and even reloaded again, wasting memory,
     // however image chunks are normally short lived so it's probably OK
-    auto tile = std::dynamic_pointer_cast<ImageTileWithType<T>>(m_tile_manager->getTileForPixel(x, y, m_source));
+    auto tile = std::dynamic_pointer_cast<ImageTileWithType<T>>(
+      m_tile_manager->getTileForPixel(x, y, m_source, tile_width, tile_height));
     assert(tile != nullptr);
 
     // The tile may be smaller than tile_width x tile_height if the image is smaller, or does not divide neatly!
@@ -78,8 +87,8 @@ std::shared_ptr<ImageChunk<T>> BufferedImage<T>::getChunk(int x, int y, int widt
     // Also, instead of iterating on the pixel coordinates, to avoid asking several times for the same tile,
     // iterate over the tiles
     std::vector<T> data(width * height);
-    int tile_w = m_tile_manager->getTileWidth();
-    int tile_h = m_tile_manager->getTileHeight();
+    int tile_w = tile_width;
+    int tile_h = tile_height;
 
     int tile_start_x = x / tile_w * tile_w;
     int tile_start_y = y / tile_h * tile_h;
@@ -88,7 +97,8 @@ std::shared_ptr<ImageChunk<T>> BufferedImage<T>::getChunk(int x, int y, int widt
 
     for (int iy = tile_start_y; iy <= tile_end_y; iy += tile_h) {
       for (int ix = tile_start_x; ix <= tile_end_x; ix += tile_w) {
-        auto tile = std::dynamic_pointer_cast<ImageTileWithType<T>>(m_tile_manager->getTileForPixel(ix, iy, m_source));
+        auto tile = std::dynamic_pointer_cast<ImageTileWithType<T>>(
+          m_tile_manager->getTileForPixel(ix, iy, m_source, tile_w, tile_h));
         copyOverlappingPixels(*tile, data, x, y, width, height, tile_w, tile_h);
       }
     }
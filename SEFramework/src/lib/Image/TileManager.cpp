@@ -21,15 +21,25 @@
  *      Author: mschefer
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "SEFramework/Image/TileManager.h"
+#include "SEFramework/Pipeline/Profiler.h"
 
 namespace SourceXtractor {
 
 static std::shared_ptr<TileManager> s_instance;
 static Elements::Logging s_tile_logger = Elements::Logging::getLogger("TileManager");
 
+/// Number of requests between re-evaluations of the access pattern of a source
+static const uint64_t LEARNING_WINDOW = 256;
+/// Number of tiles, starting from the oldest, considered for eviction
+static const int EVICTION_SAMPLES = 8;
+
 bool TileKey::operator==(const TileKey& other) const {
-  return m_source == other.m_source && m_tile_x == other.m_tile_x && m_tile_y == other.m_tile_y;
+  return m_source == other.m_source && m_tile_x == other.m_tile_x && m_tile_y == other.m_tile_y &&
+         m_tile_width == other.m_tile_width && m_tile_height == other.m_tile_height;
 }
 
 std::string TileKey::getRepr() const {
@@ -40,7 +50,8 @@ std::string TileKey::getRepr() const {
 
 
 TileManager::TileManager() : m_tile_width(256), m_tile_height(256),
-                             m_max_memory(100 * 1024L * 1024L), m_total_memory_used(0) {
+                             m_max_memory(100 * 1024L * 1024L), m_total_memory_used(0),
+                             m_eviction_clock(0), m_cache_hits(0), m_cache_misses(0) {
 }
 
 TileManager::~TileManager() {
@@ -67,7 +78,20 @@ void TileManager::flush() {
   boost::lock_guard<boost::shared_mutex> wr_lock(m_mutex);
   m_tile_list.clear();
   m_tile_map.clear();
+  m_loading_map.clear();
   m_total_memory_used = 0;
+  m_eviction_clock = 0;
+
+  // Forget the sources that do not exist anymore. The rest keep their declared or learned pattern.
+  boost::lock_guard<boost::shared_mutex> profile_lock(m_profile_mutex);
+  for (auto i = m_profiles.begin(); i != m_profiles.end();) {
+    if (i->second->m_source.expired()) {
+      i = m_profiles.erase(i);
+    }
+    else {
+      ++i;
+    }
+  }
 }
 
 /*
@@ -83,7 +107,8 @@ std::shared_ptr<ImageTile> TileManager::tryTileFromCache(const TileKey& key) {
 #ifndef NDEBUG
     s_tile_logger.debug() << "Cache hit " << key;
 #endif
-    return std::dynamic_pointer_cast<ImageTile>(it->second);
+    it->second.m_priority = m_eviction_clock + it->second.m_cost;
+    return it->second.m_tile;
   }
   return nullptr;
 }
@@ -91,7 +116,7 @@ std::shared_ptr<ImageTile> TileManager::tryTileFromCache(const TileKey& key) {
 /*
  * If the mutex does not exist, we need an upgradable lock
  */
-std::shared_ptr<boost::mutex>& TileManager::getMutexForImageSource(const ImageSource *src_ptr) {
+std::shared_ptr<boost::mutex> TileManager::getMutexForImageSource(const ImageSource *src_ptr) {
   boost::upgrade_lock<boost::shared_mutex> upgrade_lock(m_mutex);
   auto mit = m_mutex_map.find(src_ptr);
   if (mit == m_mutex_map.end()) {
@@ -101,23 +126,135 @@ std::shared_ptr<boost::mutex>& TileManager::getMutexForImageSource(const ImageSo
   return mit->second;
 }
 
+/*
+ * Sources that support concurrent reads only block readers of the same tile, so different
+ * tiles - i.e. compressed tiles - can be read and decompressed in parallel
+ */
+std::shared_ptr<boost::mutex> TileManager::getMutexForTile(const TileKey& key) {
+  boost::upgrade_lock<boost::shared_mutex> upgrade_lock(m_mutex);
+  auto mit = m_loading_map.find(key);
+  if (mit == m_loading_map.end()) {
+    boost::upgrade_to_unique_lock<boost::shared_mutex> unique_lock(upgrade_lock);
+    mit = m_loading_map.emplace(key, std::make_shared<boost::mutex>()).first;
+  }
+  return mit->second;
+}
+
+auto TileManager::getProfile(const std::shared_ptr<const ImageSource>& source, bool create) const
+-> std::shared_ptr<SourceProfile> {
+  {
+    boost::shared_lock<boost::shared_mutex> rd_lock(m_profile_mutex);
+    auto i = m_profiles.find(source.get());
+    // A different source may have been allocated where an expired one was
+    if (i != m_profiles.end() && i->second->m_source.lock() == source) {
+      return i->second;
+    }
+    if (!create) {
+      return nullptr;
+    }
+  }
+  boost::lock_guard<boost::shared_mutex> wr_lock(m_profile_mutex);
+  auto& profile = m_profiles[source.get()];
+  if (!profile || profile->m_source.lock() != source) {
+    profile = std::make_shared<SourceProfile>(source, AccessPattern::UNKNOWN, false);
+  }
+  return profile;
+}
+
+void TileManager::setAccessPattern(const std::shared_ptr<const ImageSource>& source, AccessPattern pattern) {
+  boost::lock_guard<boost::shared_mutex> wr_lock(m_profile_mutex);
+  m_profiles[source.get()] = std::make_shared<SourceProfile>(source, pattern, pattern != AccessPattern::UNKNOWN);
+}
+
+auto TileManager::getAccessPattern(const std::shared_ptr<const ImageSource>& source) const -> AccessPattern {
+  auto profile = getProfile(source, false);
+  if (!profile) {
+    return AccessPattern::UNKNOWN;
+  }
+  return static_cast<AccessPattern>(profile->m_pattern.load());
+}
+
+void TileManager::recordAccess(const std::shared_ptr<const ImageSource>& source, int width, int height) {
+  auto profile = getProfile(source, true);
+  if (profile->m_declared) {
+    return;
+  }
+
+  bool row_read = width * 2 >= source->getWidth() && width >= 4 * height;
+  uint64_t rows = row_read ? ++profile->m_row_reads : profile->m_row_reads.load();
+  uint64_t cutouts = row_read ? profile->m_cutout_reads.load() : ++profile->m_cutout_reads;
+  if ((rows + cutouts) % LEARNING_WINDOW != 0) {
+    return;
+  }
+
+  // Switch only on a clear majority, so interleaved segmentation and measurement do not flip the geometry.
+  // Halving the counters lets a change of phase be noticed.
+  auto pattern = static_cast<AccessPattern>(profile->m_pattern.load());
+  if (rows * 4 >= (rows + cutouts) * 3) {
+    pattern = AccessPattern::ROWS;
+  }
+  else if (cutouts * 4 >= (rows + cutouts) * 3) {
+    pattern = AccessPattern::CUTOUTS;
+  }
+  profile->m_row_reads = rows / 2;
+  profile->m_cutout_reads = cutouts / 2;
+  if (profile->m_pattern.exchange(static_cast<int>(pattern)) != static_cast<int>(pattern)) {
+    s_tile_logger.debug() << "Access pattern of " << source->getRepr() << " is now "
+                          << (pattern == AccessPattern::ROWS ? "rows" : "cutouts");
+  }
+}
+
+void TileManager::getTileSize(const std::shared_ptr<const ImageSource>& source, int& width, int& height) const {
+  long area = static_cast<long>(m_tile_width) * m_tile_height;
+  width = m_tile_width;
+  height = m_tile_height;
+
+  auto profile = getProfile(source, false);
+  if (profile && static_cast<AccessPattern>(profile->m_pattern.load()) == AccessPattern::ROWS) {
+    width = source->getWidth();
+    height = static_cast<int>(std::max(1L, area / width));
+  }
+
+  int native_width, native_height;
+  if (!source->getNativeTileSize(native_width, native_height) || native_width <= 0 || native_height <= 0) {
+    return;
+  }
+
+  // Full rows of native tiles can be very wide (i.e. the default compression tiling is row by row),
+  // so the number of rows is adjusted to keep the area close to the configured one
+  long nx = std::max(1L, std::lround(static_cast<double>(width) / native_width));
+  long ny = std::max(1L, area / (nx * native_width * native_height));
+  width = static_cast<int>(std::min<long>(nx * native_width, source->getWidth()));
+  height = static_cast<int>(std::min<long>(ny * native_height, source->getHeight()));
+}
+
 std::shared_ptr<ImageTile> TileManager::getTileForPixel(int x, int y,
                                                         std::shared_ptr<const ImageSource> source) {
-  x = x / m_tile_width * m_tile_width;
-  y = y / m_tile_height * m_tile_height;
-  TileKey key{std::static_pointer_cast<const ImageSource>(source), x, y};
+  int tile_width, tile_height;
+  getTileSize(source, tile_width, tile_height);
+  return getTileForPixel(x, y, std::move(source), tile_width, tile_height);
+}
+
+std::shared_ptr<ImageTile> TileManager::getTileForPixel(int x, int y, std::shared_ptr<const ImageSource> source,
+                                                        int tile_width, int tile_height) {
+  x = x / tile_width * tile_width;
+  y = y / tile_height * tile_height;
+  TileKey key{std::static_pointer_cast<const ImageSource>(source), x, y, tile_width, tile_height};
 
   // Try from the cache, this can be done by multiple threads in parallel
   auto tile = tryTileFromCache(key);
   if (tile) {
+    countLookup(true);
     return tile;
   }
+  countLookup(false);
 
   // Cache miss, we need to ask the underlying source.
-  // First, we need a mutex only for that source, and that needs writing to the tile manager.
-  auto img_mutex = getMutexForImageSource(source.get());
+  // First, we need a mutex only for that source (or tile), and that needs writing to the tile manager.
+  bool concurrent = source->supportsConcurrentReads();
+  auto img_mutex = concurrent ? getMutexForTile(key) : getMutexForImageSource(source.get());
 
-  // Here we block access only to this specific image source
+  // Here we block access only to this specific image source (or tile)
   boost::lock_guard<boost::mutex> img_lock(*img_mutex);
 
   // Try again from the cache, maybe someone put it there while we waited for the image lock
@@ -127,16 +264,37 @@ std::shared_ptr<ImageTile> TileManager::getTileForPixel(int x, int y,
   }
 
   tile = source->getImageTile(x, y,
-                              std::min(m_tile_width, source->getWidth() - x),
-                              std::min(m_tile_height, source->getHeight() - y));
+                              std::min(tile_width, source->getWidth() - x),
+                              std::min(tile_height, source->getHeight() - y));
 
   // Here we need to acquire the mutex in write mode!
   boost::lock_guard<boost::shared_mutex> wr_lock(m_mutex);
-  addTile(key, std::static_pointer_cast<ImageTile>(tile));
+  tile = addTile(key, std::static_pointer_cast<ImageTile>(tile), source->getRegenerationCost());
   removeExtraTiles();
   return tile;
 }
 
+void TileManager::countLookup(bool hit) {
+  auto& profiler = Profiler::getInstance();
+  if (!profiler.isEnabled()) {
+    return;
+  }
+  uint64_t hits = hit ? ++m_cache_hits : m_cache_hits.load();
+  uint64_t misses = hit ? m_cache_misses.load() : ++m_cache_misses;
+  // Sample the hit rate every now and then, so it can be followed over time
+  if ((hits + misses) % 4096 == 0) {
+    profiler.sample("TileManager.hit_rate", static_cast<double>(hits) / (hits + misses));
+  }
+}
+
+uint64_t TileManager::getCacheHits() const {
+  return m_cache_hits;
+}
+
+uint64_t TileManager::getCacheMisses() const {
+  return m_cache_misses;
+}
+
 std::shared_ptr<TileManager> TileManager::getInstance() {
   if (s_instance == nullptr) {
     s_instance = std::make_shared<TileManager>();
@@ -148,7 +306,7 @@ void TileManager::saveAllTiles() {
   boost::lock_guard<boost::shared_mutex> wr_lock(m_mutex);
 
   for (auto tile_key : m_tile_list) {
-    m_tile_map.at(tile_key)->saveIfModified();
+    m_tile_map.at(tile_key).m_tile->saveIfModified();
   }
 }
 
@@ -165,31 +323,59 @@ void TileManager::removeTile(TileKey tile_key) {
   s_tile_logger.debug() << "Cache eviction " << tile_key;
 #endif
 
-  auto& tile = m_tile_map.at(tile_key);
+  auto& tile = m_tile_map.at(tile_key).m_tile;
 
   tile->saveIfModified();
   m_total_memory_used -= tile->getTileMemorySize();
 
   m_tile_map.erase(tile_key);
+  // Kept while the tile is cached, so the threads that miss it wait for the same load
+  m_loading_map.erase(tile_key);
 }
 
+/*
+ * Approximation of the GreedyDual policy: among the oldest tiles, the one with the lowest priority
+ * is evicted. The priority is the cost of the tile plus the priority of the last eviction when
+ * the tile was last used, so expensive tiles survive longer, but not forever.
+ */
 void TileManager::removeExtraTiles() {
   while (m_total_memory_used > m_max_memory) {
     assert(m_tile_list.size() > 0);
-    auto tile_to_remove = m_tile_list.back();
-    removeTile(tile_to_remove);
-    m_tile_list.pop_back();
+    auto tile_to_remove = std::prev(m_tile_list.end());
+    double lowest_priority = m_tile_map.at(*tile_to_remove).m_priority;
+    auto candidate = tile_to_remove;
+    for (int i = 1; i < EVICTION_SAMPLES && candidate != m_tile_list.begin(); ++i) {
+      --candidate;
+      double priority = m_tile_map.at(*candidate).m_priority;
+      if (priority < lowest_priority) {
+        lowest_priority = priority;
+        tile_to_remove = candidate;
+      }
+    }
+    m_eviction_clock = std::max(m_eviction_clock.load(), lowest_priority);
+    removeTile(*tile_to_remove);
+    m_tile_list.erase(tile_to_remove);
   }
 }
 
-void TileManager::addTile(TileKey key, std::shared_ptr<ImageTile> tile) {
+std::shared_ptr<ImageTile> TileManager::addTile(TileKey key, std::shared_ptr<ImageTile> tile, double cost) {
 #ifndef NDEBUG
   s_tile_logger.debug() << "Cache miss " << key;
 #endif
 
-  m_tile_map[key] = tile;
+  // A loading mutex may have been replaced after an eviction while another thread was waiting
+  // on the old one, so both read the tile. Keep the first, which others may be modifying already.
+  auto it = m_tile_map.find(key);
+  if (it != m_tile_map.end()) {
+    it->second.m_priority = m_eviction_clock + it->second.m_cost;
+    return it->second.m_tile;
+  }
+
+  m_tile_map.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(tile, cost, m_eviction_clock + cost));
   m_tile_list.push_front(key);
   m_total_memory_used += tile->getTileMemorySize();
+  return tile;
 }
 
 }
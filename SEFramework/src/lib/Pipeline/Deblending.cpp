@@ -29,16 +29,24 @@ Deblending::Deblending(std::vector<std::shared_ptr<DeblendStep>> deblend_steps)
 }
 
 void Deblending::receiveSource(std::unique_ptr<SourceGroupInterface> group) {
+  // If the SourceGroup still contains sources, we notify the observers
+  group = applySteps(std::move(group));
+  if (group) {
+    sendSource(std::move(group));
+  }
+}
+
+std::unique_ptr<SourceGroupInterface> Deblending::applySteps(std::unique_ptr<SourceGroupInterface> group) const {
 
   // Applies every DeblendStep to the SourceGroup
   for (auto& step : m_deblend_steps) {
     step->deblend(*group);
   }
 
-  // If the SourceGroup still contains sources, we notify the observers
-  if (group->begin() != group->end()) {
-    sendSource(std::move(group));
+  if (group->begin() == group->end()) {
+    return nullptr;
   }
+  return group;
 }
 
 std::set<PropertyId> Deblending::requiredProperties() const {
@@ -0,0 +1,403 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * Profiler.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <boost/version.hpp>
+#include <boost/thread/locks.hpp>
+
+#include "SEFramework/Pipeline/Profiler.h"
+
+#if BOOST_VERSION < 105600
+#include <boost/units/detail/utility.hpp>
+using boost::units::detail::demangle;
+#else
+#include <boost/core/demangle.hpp>
+using boost::core::demangle;
+#endif
+
+namespace SourceXtractor {
+
+namespace {
+
+// The state of each thread is owned by the profiler. The generation detects a reset.
+struct ThreadStateRef {
+  void* m_state = nullptr;
+  unsigned m_generation = 0;
+};
+
+thread_local ThreadStateRef s_thread_state;
+std::atomic<unsigned> s_generation{1};
+
+const char* categoryName(Profiler::Category category) {
+  switch (category) {
+    case Profiler::Category::STAGE:
+      return "stage";
+    case Profiler::Category::SOURCE_TASK:
+      return "source_task";
+    case Profiler::Category::GROUP_TASK:
+      return "group_task";
+  }
+  return "unknown";
+}
+
+std::string jsonEscape(const std::string& str) {
+  std::ostringstream escaped;
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        escaped << "\\\"";
+        break;
+      case '\\':
+        escaped << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+        }
+        else {
+          escaped << c;
+        }
+    }
+  }
+  return escaped.str();
+}
+
+std::string csvEscape(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+  std::string escaped = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      escaped += '"';
+    }
+    escaped += c;
+  }
+  return escaped + '"';
+}
+
+double toSeconds(int64_t ns) {
+  return ns * 1e-9;
+}
+
+} // end of anonymous namespace
+
+Profiler& Profiler::getInstance() {
+  static Profiler s_profiler;
+  return s_profiler;
+}
+
+void Profiler::enable(bool trace, size_t max_trace_events) {
+  m_tracing = trace;
+  m_max_trace_events = max_trace_events;
+  m_origin = std::chrono::steady_clock::now();
+  m_enabled = true;
+}
+
+void Profiler::reset() {
+  m_enabled = false;
+  m_tracing = false;
+  ++s_generation;
+  {
+    std::lock_guard<std::mutex> lock(m_threads_mutex);
+    m_threads.clear();
+  }
+  std::lock_guard<std::mutex> lock(m_gauges_mutex);
+  m_gauge_names.clear();
+  m_gauge_ids.clear();
+  m_gauges.clear();
+  m_gauge_events.clear();
+}
+
+unsigned Profiler::getNameId(Category category, const std::string& name) {
+  auto key = std::make_pair(category, name);
+  {
+    boost::shared_lock<boost::shared_mutex> read_lock(m_names_mutex);
+    auto i = m_name_ids.find(key);
+    if (i != m_name_ids.end()) {
+      return i->second;
+    }
+  }
+  boost::unique_lock<boost::shared_mutex> write_lock(m_names_mutex);
+  auto inserted = m_name_ids.emplace(key, m_names.size());
+  if (inserted.second) {
+    m_names.emplace_back(key);
+  }
+  return inserted.first->second;
+}
+
+unsigned Profiler::getNameId(Category category, std::type_index type) {
+  auto key = std::make_pair(category, type);
+  {
+    boost::shared_lock<boost::shared_mutex> read_lock(m_names_mutex);
+    auto i = m_type_ids.find(key);
+    if (i != m_type_ids.end()) {
+      return i->second;
+    }
+  }
+  auto id = getNameId(category, demangle(type.name()));
+  boost::unique_lock<boost::shared_mutex> write_lock(m_names_mutex);
+  m_type_ids.emplace(key, id);
+  return id;
+}
+
+unsigned Profiler::getNameId(Category category, const PropertyId& property_id) {
+  auto key = std::make_pair(category, property_id);
+  {
+    boost::shared_lock<boost::shared_mutex> read_lock(m_names_mutex);
+    auto i = m_property_ids.find(key);
+    if (i != m_property_ids.end()) {
+      return i->second;
+    }
+  }
+  auto name = property_id.getString();
+  name.erase(name.find_last_not_of(' ') + 1);
+  auto id = getNameId(category, name);
+  boost::unique_lock<boost::shared_mutex> write_lock(m_names_mutex);
+  m_property_ids.emplace(key, id);
+  return id;
+}
+
+void Profiler::sample(const std::string& gauge, double value) {
+  if (!isEnabled()) {
+    return;
+  }
+  auto time = now();
+  std::lock_guard<std::mutex> lock(m_gauges_mutex);
+  auto inserted = m_gauge_ids.emplace(gauge, m_gauges.size());
+  if (inserted.second) {
+    m_gauge_names.emplace_back(gauge);
+    m_gauges.emplace_back();
+  }
+  auto& stats = m_gauges[inserted.first->second];
+  stats.m_min = stats.m_samples ? std::min(stats.m_min, value) : value;
+  stats.m_max = stats.m_samples ? std::max(stats.m_max, value) : value;
+  stats.m_sum += value;
+  stats.m_last = value;
+  ++stats.m_samples;
+  if (m_tracing && m_gauge_events.size() < m_max_trace_events) {
+    m_gauge_events.emplace_back(GaugeEvent{inserted.first->second, time, value});
+  }
+}
+
+Profiler::ThreadState& Profiler::getThreadState() {
+  if (s_thread_state.m_generation != s_generation) {
+    std::lock_guard<std::mutex> lock(m_threads_mutex);
+    m_threads.emplace_back();
+    m_threads.back().m_thread_id = m_threads.size();
+    s_thread_state.m_state = &m_threads.back();
+    s_thread_state.m_generation = s_generation;
+  }
+  return *static_cast<ThreadState*>(s_thread_state.m_state);
+}
+
+void Profiler::record(unsigned name_id, int64_t start, int64_t duration, int64_t self) {
+  auto& state = getThreadState();
+  std::lock_guard<std::mutex> lock(state.m_mutex);
+  if (state.m_timers.size() <= name_id) {
+    state.m_timers.resize(name_id + 1);
+  }
+  state.m_timers[name_id].add(duration, self);
+  if (m_tracing && state.m_events.size() < m_max_trace_events) {
+    state.m_events.emplace_back(TraceEvent{name_id, start, duration});
+  }
+}
+
+void Profiler::TimerStats::add(int64_t duration, int64_t self) {
+  m_min = m_calls ? std::min(m_min, duration) : duration;
+  m_max = m_calls ? std::max(m_max, duration) : duration;
+  m_total += duration;
+  m_self += self;
+  ++m_calls;
+  size_t bucket = 0;
+  while (bucket + 1 < HISTOGRAM_BUCKETS && (int64_t(2) << bucket) <= duration) {
+    ++bucket;
+  }
+  ++m_histogram[bucket];
+}
+
+void Profiler::TimerStats::merge(const TimerStats& other) {
+  if (other.m_calls == 0) {
+    return;
+  }
+  m_min = m_calls ? std::min(m_min, other.m_min) : other.m_min;
+  m_max = m_calls ? std::max(m_max, other.m_max) : other.m_max;
+  m_total += other.m_total;
+  m_self += other.m_self;
+  m_calls += other.m_calls;
+  for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+    m_histogram[i] += other.m_histogram[i];
+  }
+}
+
+int64_t Profiler::TimerStats::quantile(double q) const {
+  uint64_t target = static_cast<uint64_t>(std::ceil(q * m_calls)), accumulated = 0;
+  for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+    accumulated += m_histogram[i];
+    if (accumulated >= target && accumulated > 0) {
+      return std::min(m_max, int64_t(2) << i);
+    }
+  }
+  return m_max;
+}
+
+auto Profiler::aggregate() const -> std::vector<AggregatedTimer> {
+  std::vector<TimerStats> merged;
+  {
+    std::lock_guard<std::mutex> threads_lock(m_threads_mutex);
+    for (auto& state : m_threads) {
+      std::lock_guard<std::mutex> state_lock(state.m_mutex);
+      if (merged.size() < state.m_timers.size()) {
+        merged.resize(state.m_timers.size());
+      }
+      for (size_t i = 0; i < state.m_timers.size(); ++i) {
+        merged[i].merge(state.m_timers[i]);
+      }
+    }
+  }
+
+  std::vector<AggregatedTimer> timers;
+  boost::shared_lock<boost::shared_mutex> names_lock(m_names_mutex);
+  for (size_t i = 0; i < merged.size(); ++i) {
+    if (merged[i].m_calls > 0) {
+      timers.emplace_back(AggregatedTimer{m_names[i].first, m_names[i].second, merged[i]});
+    }
+  }
+  std::sort(timers.begin(), timers.end(), [](const AggregatedTimer& a, const AggregatedTimer& b) {
+    return a.m_stats.m_total > b.m_stats.m_total;
+  });
+  return timers;
+}
+
+void Profiler::writeJson(std::ostream& out) const {
+  auto timers = aggregate();
+  size_t threads_nb;
+  {
+    std::lock_guard<std::mutex> lock(m_threads_mutex);
+    threads_nb = m_threads.size();
+  }
+
+  out << "{\n  \"elapsed\": " << toSeconds(now()) << ",\n  \"threads\": " << threads_nb << ",\n  \"timers\": [";
+  for (size_t i = 0; i < timers.size(); ++i) {
+    auto& stats = timers[i].m_stats;
+    out << (i ? "," : "") << "\n    {\"category\": \"" << categoryName(timers[i].m_category)
+        << "\", \"name\": \"" << jsonEscape(timers[i].m_name) << "\", \"calls\": " << stats.m_calls
+        << ", \"total\": " << toSeconds(stats.m_total) << ", \"self\": " << toSeconds(stats.m_self)
+        << ", \"min\": " << toSeconds(stats.m_min) << ", \"max\": " << toSeconds(stats.m_max)
+        << ", \"p50\": " << toSeconds(stats.quantile(0.5)) << ", \"p90\": " << toSeconds(stats.quantile(0.9))
+        << ", \"p99\": " << toSeconds(stats.quantile(0.99)) << "}";
+  }
+  out << "\n  ],\n  \"gauges\": [";
+  std::lock_guard<std::mutex> lock(m_gauges_mutex);
+  for (size_t i = 0; i < m_gauges.size(); ++i) {
+    auto& stats = m_gauges[i];
+    out << (i ? "," : "") << "\n    {\"name\": \"" << jsonEscape(m_gauge_names[i]) << "\", \"samples\": "
+        << stats.m_samples << ", \"mean\": " << stats.m_sum / stats.m_samples << ", \"min\": " << stats.m_min
+        << ", \"max\": " << stats.m_max << ", \"last\": " << stats.m_last << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+void Profiler::writeCsv(std::ostream& out) const {
+  auto timers = aggregate();
+  out << "category,name,count,total,self,min,max,mean,p50,p90,p99\n";
+  for (auto& timer : timers) {
+    auto& stats = timer.m_stats;
+    out << categoryName(timer.m_category) << ',' << csvEscape(timer.m_name) << ',' << stats.m_calls << ','
+        << toSeconds(stats.m_total) << ',' << toSeconds(stats.m_self) << ',' << toSeconds(stats.m_min) << ','
+        << toSeconds(stats.m_max) << ',' << toSeconds(stats.m_total) / stats.m_calls << ','
+        << toSeconds(stats.quantile(0.5)) << ',' << toSeconds(stats.quantile(0.9)) << ','
+        << toSeconds(stats.quantile(0.99)) << '\n';
+  }
+  // Gauges are not durations: only count, min, max and mean apply
+  std::lock_guard<std::mutex> lock(m_gauges_mutex);
+  for (size_t i = 0; i < m_gauges.size(); ++i) {
+    auto& stats = m_gauges[i];
+    out << "gauge," << csvEscape(m_gauge_names[i]) << ',' << stats.m_samples << ",,," << stats.m_min << ','
+        << stats.m_max << ',' << stats.m_sum / stats.m_samples << ",,,\n";
+  }
+}
+
+void Profiler::writeChromeTrace(std::ostream& out) const {
+  std::vector<std::pair<const char*, std::string>> names;
+  {
+    boost::shared_lock<boost::shared_mutex> names_lock(m_names_mutex);
+    for (auto& name : m_names) {
+      names.emplace_back(categoryName(name.first), jsonEscape(name.second));
+    }
+  }
+
+  // Timestamps are in microseconds
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  {
+    std::lock_guard<std::mutex> threads_lock(m_threads_mutex);
+    for (auto& state : m_threads) {
+      std::lock_guard<std::mutex> state_lock(state.m_mutex);
+      for (auto& event : state.m_events) {
+        out << (first ? "" : ",") << "\n{\"name\": \"" << names[event.m_name_id].second << "\", \"cat\": \""
+            << names[event.m_name_id].first << "\", \"ph\": \"X\", \"ts\": "
+            << event.m_start / 1000. << ", \"dur\": " << event.m_duration / 1000. << ", \"pid\": 1, \"tid\": "
+            << state.m_thread_id << "}";
+        first = false;
+      }
+    }
+  }
+  std::lock_guard<std::mutex> gauges_lock(m_gauges_mutex);
+  for (auto& event : m_gauge_events) {
+    out << (first ? "" : ",") << "\n{\"name\": \"" << jsonEscape(m_gauge_names[event.m_gauge_id])
+        << "\", \"ph\": \"C\", \"ts\": " << event.m_time / 1000. << ", \"pid\": 1, \"args\": {\"value\": "
+        << event.m_value << "}}";
+    first = false;
+  }
+  out << "\n]}\n";
+}
+
+void ProfilerScope::start(Profiler& profiler, unsigned name_id) {
+  m_active = true;
+  m_name_id = name_id;
+  profiler.getThreadState().m_children.push_back(0);
+  m_start = profiler.now();
+}
+
+ProfilerScope::~ProfilerScope() {
+  if (!m_active) {
+    return;
+  }
+  auto& profiler = Profiler::getInstance();
+  auto duration = profiler.now() - m_start;
+  auto& state = profiler.getThreadState();
+  int64_t children = 0;
+  if (!state.m_children.empty()) {
+    children = state.m_children.back();
+    state.m_children.pop_back();
+  }
+  if (!state.m_children.empty()) {
+    state.m_children.back() += duration;
+  }
+  profiler.record(m_name_id, m_start, duration, duration - children);
+}
+
+} // end of namespace SourceXtractor
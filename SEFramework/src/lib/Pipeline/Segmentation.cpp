@@ -20,6 +20,8 @@
  * @author mschefer
  */
 
+#include <cassert>
+
 #include "SEFramework/Pipeline/Segmentation.h"
 
 namespace SourceXtractor {
@@ -42,4 +44,9 @@ void Segmentation::processFrame(std::shared_ptr<DetectionImageFrame> frame) cons
   sendProcessSignal(ProcessSourcesEvent(std::make_shared<SelectAllCriteria>()));
 }
 
+void Segmentation::setDetectionRegion(const PixelRectangle& region) {
+  assert(m_labelling != nullptr);
+  m_labelling->setRegion(region);
+}
+
 }
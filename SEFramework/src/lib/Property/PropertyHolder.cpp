@@ -20,6 +20,9 @@
  * @author mschefer
  */
 
+#include <mutex>
+#include <boost/thread/locks.hpp>
+
 #include "SEFramework/Property/PropertyHolder.h"
 
 #include "SEFramework/Property/PropertyNotFoundException.h"
@@ -27,6 +30,7 @@
 namespace SourceXtractor {
 
 const Property& PropertyHolder::getProperty(const PropertyId& property_id) const {
+  boost::shared_lock<boost::shared_mutex> lock(m_mutex);
   auto iter = m_properties.find(property_id);
   if (iter != m_properties.end()) {
     // Returns the property if it is found
@@ -38,15 +42,24 @@ const Property& PropertyHolder::getProperty(const PropertyId& property_id) const
 }
 
 void PropertyHolder::setProperty(std::unique_ptr<Property> property, const PropertyId& property_id) {
-  m_properties[property_id] = std::move(property);
+  std::lock_guard<boost::shared_mutex> lock(m_mutex);
+  auto& slot = m_properties[property_id];
+  if (slot) {
+    // Someone may still hold a reference to the previous value
+    m_retired.emplace_back(std::move(slot));
+  }
+  slot = std::move(property);
 }
 
 bool PropertyHolder::isPropertySet(const PropertyId& property_id) const {
+  boost::shared_lock<boost::shared_mutex> lock(m_mutex);
   return m_properties.find(property_id) != m_properties.end();
 }
 
 void PropertyHolder::clear() {
+  std::lock_guard<boost::shared_mutex> lock(m_mutex);
   m_properties.clear();
+  m_retired.clear();
 }
 
 } // SEFramework namespace
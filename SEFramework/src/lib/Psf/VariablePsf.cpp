@@ -23,15 +23,23 @@
 
 #include <ElementsKernel/Exception.h>
 #include <algorithm>
+#include <cmath>
+#include <set>
 #include "SEFramework/Psf/VariablePsf.h"
 
 
 namespace SourceXtractor {
 
+/// Components that are pixel coordinates, so the cache cell size applies to them
+static const std::set<std::string> s_pixel_components{
+  "X_IMAGE", "Y_IMAGE", "XWIN_IMAGE", "YWIN_IMAGE", "XPEAK_IMAGE", "YPEAK_IMAGE", "XMODEL_IMAGE", "YMODEL_IMAGE"
+};
+
 VariablePsf::VariablePsf(double pixel_sampling, const std::vector<Component> &components,
             const std::vector<int> &group_degrees,
             const std::vector<std::shared_ptr<VectorImage<SeFloat>>> &coefficients):
-  m_pixel_sampling(pixel_sampling), m_components(components), m_group_degrees(group_degrees), m_coefficients(coefficients)
+  m_pixel_sampling(pixel_sampling), m_components(components), m_group_degrees(group_degrees), m_coefficients(coefficients),
+  m_cache_cell_size(0), m_cache_max_entries(0)
 {
   selfTest();
   calculateExponents();
@@ -40,7 +48,7 @@ VariablePsf::VariablePsf(double pixel_sampling, const std::vector<Component> &co
 }
 
 VariablePsf::VariablePsf(double pixel_sampling, const std::shared_ptr<VectorImage<SeFloat>> &constant):
-  m_pixel_sampling(pixel_sampling), m_coefficients{constant}
+  m_pixel_sampling(pixel_sampling), m_coefficients{constant}, m_cache_cell_size(0), m_cache_max_entries(0)
 {
   selfTest();
   calculateExponents();
@@ -63,32 +71,105 @@ const std::vector<std::string>& VariablePsf::getComponents() const {
 }
 
 std::shared_ptr<VectorImage<SeFloat>> VariablePsf::getPsf(const std::vector<double> &values) const
+{
+  // Constant PSF, or no cache
+  if (m_cache_cell_size <= 0 || m_components.empty()) {
+    return computePsf(values);
+  }
+
+  if (values.size() != m_components.size()) {
+    throw Elements::Exception()
+        << "Expecting " << m_components.size() << " values, got " << values.size();
+  }
+
+  // Pixel coordinates are moved to the center of their cell, so the result does not depend on which
+  // source came first. Other components are used as they are.
+  std::vector<double> point(values);
+  for (auto i = 0u; i < values.size(); ++i) {
+    if (m_cache_quantized[i]) {
+      point[i] = (std::floor(values[i] / m_cache_cell_size) + 0.5) * m_cache_cell_size;
+    }
+  }
+
+  std::shared_ptr<const VectorImage<SeFloat>> cached;
+  {
+    boost::shared_lock<boost::shared_mutex> rd_lock(m_cache_mutex);
+    auto it = m_cache.find(point);
+    if (it != m_cache.end()) {
+      cached = it->second;
+    }
+  }
+
+  if (!cached) {
+    cached = computePsf(point);
+
+    boost::lock_guard<boost::shared_mutex> wr_lock(m_cache_mutex);
+    auto inserted = m_cache.emplace(point, cached);
+    if (inserted.second) {
+      m_cache_order.push_back(point);
+      while (m_cache_order.size() > m_cache_max_entries) {
+        m_cache.erase(m_cache_order.front());
+        m_cache_order.pop_front();
+      }
+    }
+  }
+
+  // Callers are free to modify the returned image
+  return VectorImage<SeFloat>::create(*cached);
+}
+
+std::shared_ptr<VectorImage<SeFloat>> VariablePsf::computePsf(const std::vector<double> &values) const
 {
   auto scaled_props = scaleProperties(values);
 
   // Initialize with the constant component
   auto result = VectorImage<SeFloat>::create(*m_coefficients[0]);
+  auto& result_data = result->getData();
+  const size_t npixels = result_data.size();
+
+  // Powers of each scaled component, up to the maximum degree
+  std::vector<std::vector<double>> powers(scaled_props.size());
+  int max_degree = m_group_degrees.empty() ? 0 : *std::max_element(m_group_degrees.begin(), m_group_degrees.end());
+  for (auto j = 0u; j < scaled_props.size(); ++j) {
+    powers[j].resize(max_degree + 1);
+    powers[j][0] = 1.;
+    for (int d = 1; d <= max_degree; ++d) {
+      powers[j][d] = powers[j][d - 1] * scaled_props[j];
+    }
+  }
 
   // Add the rest of the components
+  SeFloat* out = result_data.data();
   for (auto i = 1u; i < m_coefficients.size(); ++i) {
     const auto& exp = m_exponents[i];
-    const auto& coef = m_coefficients[i];
 
     double acc = 1.;
     for (auto j = 0u; j < scaled_props.size(); ++j) {
-      acc *= std::pow(scaled_props[j], exp[j]);
+      acc *= powers[j][exp[j]];
     }
 
-    for (auto x = 0; x < getWidth(); ++x) {
-      for (auto y = 0; y < getHeight(); ++y) {
-        result->at(x, y) += acc * coef->at(x, y);
-      }
+    // Coefficients and result share the same row-major layout, so this is a single contiguous loop
+    const SeFloat* coef = m_coefficients[i]->getData().data();
+    for (size_t p = 0; p < npixels; ++p) {
+      out[p] += acc * coef[p];
     }
   }
 
   return result;
 }
 
+void VariablePsf::setCache(double cell_size, size_t max_bytes) {
+  boost::lock_guard<boost::shared_mutex> wr_lock(m_cache_mutex);
+  m_cache_cell_size = cell_size;
+  m_cache_quantized.resize(m_components.size());
+  for (auto i = 0u; i < m_components.size(); ++i) {
+    m_cache_quantized[i] = (s_pixel_components.count(m_components[i].name) > 0);
+  }
+  m_cache_max_entries = std::max<size_t>(1, max_bytes / (getWidth() * getHeight() * sizeof(SeFloat)));
+  m_cache.clear();
+  m_cache_order.clear();
+}
+
 void VariablePsf::selfTest() {
   // Pre-condition: There is at least a constant component
   if (m_coefficients.size() == 0) {
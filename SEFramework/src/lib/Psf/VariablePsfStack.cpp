@@ -21,12 +21,18 @@
  *      Author: Martin Kuemmel
  */
 #include <algorithm>
+#include <cmath>
 #include <ElementsKernel/Logging.h>
 #include <ElementsKernel/Exception.h>
 #include "SEFramework/Psf/VariablePsfStack.h"
 
 static auto stack_logger = Elements::Logging::getLogger("VarStackPsf");
 
+// Stacks up to this size are read in memory at once
+static const size_t s_max_stack_bytes = 256 * 1024 * 1024;
+// Otherwise, keep up to this much memory of decoded stamps
+static const size_t s_max_stamp_cache_bytes = 64 * 1024 * 1024;
+
 namespace SourceXtractor {
 
 void VariablePsfStack::setup(std::shared_ptr<CCfits::FITS> pFits) {
@@ -86,6 +92,29 @@ void VariablePsfStack::setup(std::shared_ptr<CCfits::FITS> pFits) {
     position_data.column("X", false).read(m_x_values, 0, m_nrows);
     position_data.column("Y", false).read(m_y_values, 0, m_nrows);
 
+    if (m_nrows <= 0) {
+      throw Elements::Exception() << "The stacked PSF file has no positions! File: " << pFits->name();
+    }
+
+    // index the positions, so the closest PSF is found without scanning the whole list
+    std::vector<VariablePsfStackPosition> positions(m_nrows);
+    for (long i = 0; i < m_nrows; ++i) {
+      positions[i] = {m_x_values[i], m_y_values[i], i};
+    }
+    m_position_index.reset(new KdTree<VariablePsfStackPosition>(positions));
+
+    // if the stack is small enough, read it all now, so getPsf never needs to go to the file
+    size_t stack_bytes = psf_data.axis(0) * psf_data.axis(1) * sizeof(SeFloat);
+    if (stack_bytes <= s_max_stack_bytes) {
+      psf_data.read(m_stack_data);
+      m_stack_width = psf_data.axis(0);
+      stack_logger.debug() << "Loaded the full PSF stack in memory (" << stack_bytes << " bytes)";
+    }
+    else {
+      m_max_cached_stamps = std::max<size_t>(1, s_max_stamp_cache_bytes / (m_psf_size * m_psf_size * sizeof(SeFloat)));
+      stack_logger.debug() << "Caching up to " << m_max_cached_stamps << " PSF stamps";
+    }
+
   } catch (CCfits::FitsException& e) {
     throw Elements::Exception() << "Error loading stacked PSF file: " << e.message();
   }
@@ -115,50 +144,78 @@ void VariablePsfStack::selfTest() {
                                 << " NAXIS2: " << naxis1;
 }
 
-std::shared_ptr<VectorImage<SeFloat>> VariablePsfStack::getPsf(const std::vector<double>& values) const {
-  long   index_min_distance = 0;
-  double min_distance       = 1.0e+32;
-
-  // make sure there are only two positions
-  if (values.size() != 2)
-    throw Elements::Exception() << "There can be only two positional value for the stacked PSF!";
-
-  // find the position of minimal distance
-  for (int act_index = 0; act_index < m_nrows; act_index++) {
-    double act_distance = (values[0] - m_x_values[act_index]) * (values[0] - m_x_values[act_index]) +
-                          (values[1] - m_y_values[act_index]) * (values[1] - m_y_values[act_index]);
-    if (act_distance < min_distance) {
-      index_min_distance = act_index;
-      min_distance       = act_distance;
+std::shared_ptr<const std::valarray<SeFloat>> VariablePsfStack::getStamp(long index) const {
+  // cache lookup, multiple threads can do this at the same time
+  {
+    boost::shared_lock<boost::shared_mutex> rd_lock(m_cache_mutex);
+    auto it = m_stamp_cache.find(index);
+    if (it != m_stamp_cache.end()) {
+      return it->second;
     }
   }
-  // give some feedback
-  stack_logger.debug() << "Distance: " << sqrt(min_distance) << " (" << values[0] << "," << values[1] << ")<-->("
-                       << m_x_values[index_min_distance] << "," << m_y_values[index_min_distance]
-                       << ") index: " << index_min_distance;
 
   // get the first and last pixels for the PSF to be extracted
   // NOTE: CCfits has 1-based indices, also the last index is *included* in the reading
   // NOTE: the +0.5 forces a correct cast/ceiling
-  std::vector<long> first_vertex{long(m_gridx_values[index_min_distance]+.5) - long(m_grid_offset),  long(m_gridy_values[index_min_distance]+.5) - long(m_grid_offset)};
+  std::vector<long> first_vertex{long(m_gridx_values[index]+.5) - long(m_grid_offset),  long(m_gridy_values[index]+.5) - long(m_grid_offset)};
   stack_logger.debug() << "First vertex: ( " << first_vertex[0] << ", " << first_vertex[1] << ") First vertex alternative: " <<
-      m_gridx_values[index_min_distance]-m_grid_offset << " " << m_gridy_values[index_min_distance]-m_grid_offset <<
+      m_gridx_values[index]-m_grid_offset << " " << m_gridy_values[index]-m_grid_offset <<
       " grid offset:" << m_grid_offset;
 
   std::vector<long> last_vertex{first_vertex[0] + long(m_psf_size) - 1, first_vertex[1] +long( m_psf_size) - 1};
   std::vector<long> stride{1, 1};
 
   // read out the image
-  std::valarray<SeFloat> stamp_data;
+  auto stamp_data = std::make_shared<std::valarray<SeFloat>>();
   {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_pFits->extension(1).read(stamp_data, first_vertex, last_vertex, stride);
+    m_pFits->extension(1).read(*stamp_data, first_vertex, last_vertex, stride);
   }
 
-  //stack_logger.info() << "DDD ( " << first_vertex[0] << ", " << first_vertex[1] << ") --> ( " << last_vertex[0] << ", " << last_vertex[1] << "): " << stamp_data.size();
+  // store it, evicting the oldest entries if needed
+  boost::lock_guard<boost::shared_mutex> wr_lock(m_cache_mutex);
+  auto inserted = m_stamp_cache.emplace(index, stamp_data);
+  if (inserted.second) {
+    m_stamp_cache_order.push_back(index);
+    while (m_stamp_cache_order.size() > m_max_cached_stamps) {
+      m_stamp_cache.erase(m_stamp_cache_order.front());
+      m_stamp_cache_order.pop_front();
+    }
+  }
+  return inserted.first->second;
+}
+
+std::shared_ptr<VectorImage<SeFloat>> VariablePsfStack::getPsf(const std::vector<double>& values) const {
+  // make sure there are only two positions
+  if (values.size() != 2)
+    throw Elements::Exception() << "There can be only two positional value for the stacked PSF!";
+
+  // find the position of minimal distance
+  auto nearest = m_position_index->findNearest({{values[0], values[1]}});
+  long index_min_distance = nearest.m_index;
+
+  // give some feedback
+  stack_logger.debug() << "Distance: " << std::hypot(values[0] - nearest.m_x, values[1] - nearest.m_y)
+                       << " (" << values[0] << "," << values[1] << ")<-->("
+                       << m_x_values[index_min_distance] << "," << m_y_values[index_min_distance]
+                       << ") index: " << index_min_distance;
+
+  // the whole stack is in memory: copy the stamp rows
+  if (m_stack_data.size() > 0) {
+    long first_x = long(m_gridx_values[index_min_distance] + .5) - long(m_grid_offset) - 1;
+    long first_y = long(m_gridy_values[index_min_distance] + .5) - long(m_grid_offset) - 1;
+    auto psf = VectorImage<SeFloat>::create(m_psf_size, m_psf_size);
+    auto& psf_data = psf->getData();
+    for (int y = 0; y < m_psf_size; ++y) {
+      auto row = std::begin(m_stack_data) + (first_y + y) * m_stack_width + first_x;
+      std::copy(row, row + m_psf_size, psf_data.begin() + y * m_psf_size);
+    }
+    return psf;
+  }
 
   // create and return the psf image
-  return VectorImage<SeFloat>::create(m_psf_size, m_psf_size, std::begin(stamp_data), std::end(stamp_data));
+  auto stamp_data = getStamp(index_min_distance);
+  return VectorImage<SeFloat>::create(m_psf_size, m_psf_size, std::begin(*stamp_data), std::end(*stamp_data));
 }
 
 } // end SExtractor
@@ -20,6 +20,7 @@
  */
 
 #include "SEFramework/Source/SourceGroupWithOnDemandProperties.h"
+#include "SEFramework/Pipeline/Profiler.h"
 #include "SEFramework/Task/GroupTask.h"
 
 namespace SourceXtractor {
@@ -64,7 +65,10 @@ const Property& SourceGroupWithOnDemandProperties::EntangledSource::getProperty(
     }
 
   // Use the task to make the property
-    group_task->computeProperties(m_group);
+    {
+      ProfilerScope scope(Profiler::Category::GROUP_TASK, property_id);
+      group_task->computeProperties(m_group);
+    }
 
     // The property should now be available either in this object or in the group object
     if (m_property_holder.isPropertySet(property_id)) {
@@ -23,6 +23,7 @@
 #include "ElementsKernel/Logging.h"
 
 #include "SEFramework/Source/SourceGroupWithOnDemandProperties.h"
+#include "SEFramework/Pipeline/Profiler.h"
 #include "SEFramework/Task/GroupTask.h"
 
 namespace SourceXtractor {
@@ -91,6 +92,7 @@ const Property& SourceGroupWithOnDemandProperties::getProperty(const PropertyId&
     // If not, get the task for that property, use it to compute the property then return it
     auto task = m_task_provider->getTask<GroupTask>(property_id);
     if (task) {
+      ProfilerScope scope(Profiler::Category::GROUP_TASK, property_id);
       task->computeProperties(const_cast<SourceGroupWithOnDemandProperties&>(*this));
       return m_property_holder.getProperty(property_id);
     }
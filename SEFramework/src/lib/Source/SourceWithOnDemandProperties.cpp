@@ -22,6 +22,7 @@
 
 #include "ElementsKernel/Logging.h"
 
+#include "SEFramework/Pipeline/Profiler.h"
 #include "SEFramework/Task/TaskProvider.h"
 #include "SEFramework/Task/SourceTask.h"
 #include "SEFramework/Property/PropertyNotFoundException.h"
@@ -46,6 +47,7 @@ const Property& SourceWithOnDemandProperties::getProperty(const PropertyId& prop
     // if not, get the task that makes it and execute, we should have it then
     auto task = m_task_provider->getTask<SourceTask>(property_id);
     if (task) {
+      ProfilerScope scope(Profiler::Category::SOURCE_TASK, property_id);
       task->computeProperties(const_cast<SourceWithOnDemandProperties&>(*this));
       return m_property_holder.getProperty(property_id);
     }
@@ -56,4 +56,14 @@ std::shared_ptr<const Task> TaskProvider::getTask(const PropertyId& property_id)
   }
 }
 
+std::vector<PropertyId> TaskProvider::getKnownPropertyIds() const {
+  std::lock_guard<std::mutex> lock(task_provider_mutex);
+  std::vector<PropertyId> ids;
+  ids.reserve(m_tasks.size());
+  for (auto& entry : m_tasks) {
+    ids.emplace_back(entry.first);
+  }
+  return ids;
+}
+
 } // SEFramework namespace
@@ -26,6 +26,7 @@
 #include "SEUtils/TestUtils.h"
 #include <boost/test/unit_test.hpp>
 #include <numeric>
+#include <thread>
 
 using namespace SourceXtractor;
 
@@ -87,4 +88,75 @@ BOOST_AUTO_TEST_CASE(FFT_float_symmetric_double_test) {
 
 //-----------------------------------------------------------------------------
 
+BOOST_AUTO_TEST_CASE(FFT_complex_packed_test) {
+  // Two real signals packed into one complex transform
+  std::vector<float> scratch;
+  auto fwd_plan = FFT<float>::createComplexPlan(4, 3, false, scratch);
+  auto inv_plan = FFT<float>::createComplexPlan(4, 3, true, scratch);
+  BOOST_CHECK_EQUAL(scratch.size(), 2 * 4 * 3);
+
+  std::vector<float> real(12), imag(12);
+  std::iota(real.begin(), real.end(), 0.f);
+  std::iota(imag.rbegin(), imag.rend(), 5.f);
+  for (size_t i = 0; i < real.size(); ++i) {
+    scratch[2 * i] = real[i];
+    scratch[2 * i + 1] = imag[i];
+  }
+
+  FFT<float>::executeComplex(fwd_plan, scratch);
+  // The DC term is the sum of each signal
+  BOOST_CHECK_CLOSE(scratch[0], std::accumulate(real.begin(), real.end(), 0.f), 1e-4);
+  BOOST_CHECK_CLOSE(scratch[1], std::accumulate(imag.begin(), imag.end(), 0.f), 1e-4);
+
+  FFT<float>::executeComplex(inv_plan, scratch);
+  for (size_t i = 0; i < real.size(); ++i) {
+    BOOST_CHECK_SMALL(scratch[2 * i] / 12 - real[i], 1e-4f);
+    BOOST_CHECK_SMALL(scratch[2 * i + 1] / 12 - imag[i], 1e-4f);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(FFT_plan_cache_test) {
+  std::vector<float> scratch;
+  auto plan = FFT<float>::createForwardPlan(6, 5, scratch);
+  BOOST_CHECK_EQUAL(scratch.size(), 2 * 4 * 5);
+
+  // The same plan is shared between threads
+  FFT<float>::plan_ptr_t other_plan;
+  std::thread thread([&other_plan]() {
+    std::vector<float> other_scratch;
+    other_plan = FFT<float>::createForwardPlan(6, 5, other_scratch);
+  });
+  thread.join();
+  BOOST_CHECK_EQUAL(plan.get(), other_plan.get());
+
+  // Different kind, different plan
+  auto inv_plan = FFT<float>::createInversePlan(6, 5, scratch);
+  BOOST_CHECK_NE(plan.get(), inv_plan.get());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(FFT_buffer_pool_test) {
+  auto buffer = FFT<float>::acquireBuffer(100);
+  BOOST_CHECK_EQUAL(buffer.size(), 100);
+  auto data = buffer.data();
+  FFT<float>::releaseBuffer(std::move(buffer));
+
+  // A smaller request reuses the memory
+  auto reused = FFT<float>::acquireBuffer(50);
+  BOOST_CHECK_EQUAL(reused.size(), 50);
+  BOOST_CHECK_EQUAL(reused.data(), data);
+
+  // Nothing left in the pool, so a new buffer
+  auto fresh = FFT<float>::acquireBuffer(50);
+  BOOST_CHECK_NE(fresh.data(), data);
+
+  FFT<float>::releaseBuffer(std::move(reused));
+  FFT<float>::releaseBuffer(std::move(fresh));
+}
+
+//-----------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE_END()
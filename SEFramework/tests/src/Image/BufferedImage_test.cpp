@@ -69,6 +69,28 @@ public:
   }
 };
 
+/**
+ * Source stored in tiles of full rows, like a compressed FITS image with the default tiling
+ */
+template<typename T>
+class RowTiledSourceMock : public ImageSourceMock<T> {
+public:
+  using ImageSourceMock<T>::ImageSourceMock;
+
+  mutable int m_reads = 0;
+
+  std::shared_ptr<ImageTile> getImageTile(int x, int y, int width, int height) const override {
+    ++m_reads;
+    return ImageSourceMock<T>::getImageTile(x, y, width, height);
+  }
+
+  bool getNativeTileSize(int& width, int& height) const override {
+    width = this->getWidth();
+    height = 1;
+    return true;
+  }
+};
+
 struct BufferedImageFixture {
   std::shared_ptr<ImageSource> m_img_source;
 
@@ -228,5 +250,70 @@ BOOST_FIXTURE_TEST_CASE(ChunkCrossMultipleXY_test, BufferedImageFixture) {
 
 //-----------------------------------------------------------------------------
 
+/**
+ * Tiles follow the native geometry of the source, so each native tile is read only once
+ */
+BOOST_FIXTURE_TEST_CASE(NativeTileSize_test, BufferedImageFixture) {
+  auto source = std::make_shared<RowTiledSourceMock<SeFloat>>(VectorImage<SeFloat>::create(
+    8, 8, std::vector<SeFloat>(64, 1.)));
+  auto tile_manager = TileManager::getInstance();
+
+  int tile_width, tile_height;
+  tile_manager->getTileSize(source, tile_width, tile_height);
+  BOOST_CHECK_EQUAL(tile_width, 8);
+  BOOST_CHECK_EQUAL(tile_height, 1);
+
+  auto image = BufferedImage<SeFloat>::create(source);
+  auto chunk = image->getChunk(1, 1, 4, 4);
+  BOOST_CHECK(compareImages(VectorImage<SeFloat>::create(4, 4, std::vector<SeFloat>(16, 1.)), chunk));
+  BOOST_CHECK_EQUAL(source->m_reads, 4);
+
+  image->getChunk(5, 1, 3, 4);
+  BOOST_CHECK_EQUAL(source->m_reads, 4);
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * A source read by full rows switches to strips
+ */
+BOOST_FIXTURE_TEST_CASE(LearnAccessPattern_test, BufferedImageFixture) {
+  auto image = BufferedImage<SeFloat>::create(m_img_source);
+  auto tile_manager = TileManager::getInstance();
+  BOOST_CHECK(tile_manager->getAccessPattern(m_img_source) == TileManager::AccessPattern::UNKNOWN);
+
+  for (int i = 0; i < 256; ++i) {
+    auto chunk = image->getChunk(0, i % 8, 8, 1);
+    BOOST_CHECK_EQUAL(chunk->getValue(3, 0), (i % 8) / 2 * 4 + 1);
+  }
+  BOOST_CHECK(tile_manager->getAccessPattern(m_img_source) == TileManager::AccessPattern::ROWS);
+
+  int tile_width, tile_height;
+  tile_manager->getTileSize(m_img_source, tile_width, tile_height);
+  BOOST_CHECK_EQUAL(tile_width, 8);
+  BOOST_CHECK_EQUAL(tile_height, 1);
+
+  // The content must not change with the geometry
+  auto tile0145 = image->getChunk(1, 1, 2, 2);
+  BOOST_CHECK(compareImages(VectorImage<SeFloat>::create(2, 2, std::vector<SeFloat>{0, 1, 4, 5}), tile0145));
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Declared patterns are not overridden by the learning
+ */
+BOOST_FIXTURE_TEST_CASE(DeclaredAccessPattern_test, BufferedImageFixture) {
+  auto image = BufferedImage<SeFloat>::create(m_img_source);
+  image->setAccessPattern(TileManager::AccessPattern::CUTOUTS);
+
+  for (int i = 0; i < 256; ++i) {
+    image->getChunk(0, i % 8, 8, 1);
+  }
+  BOOST_CHECK(TileManager::getInstance()->getAccessPattern(m_img_source) == TileManager::AccessPattern::CUTOUTS);
+}
+
+//-----------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE_END ()
 
@@ -0,0 +1,148 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/CutoutImage_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "SEFramework/Image/CutoutImage.h"
+#include "SEFramework/Image/ImageAccessor.h"
+#include "SEFramework/Image/VectorImage.h"
+
+#include "SEUtils/TestUtils.h"
+
+using namespace SourceXtractor;
+
+struct CutoutImageFixture {
+  std::shared_ptr<VectorImage<SeFloat>> img = VectorImage<SeFloat>::create(4, 3, std::vector<SeFloat>{
+    1, 2, 3, 4,
+    5, 6, 7, 8,
+    9, 10, 11, 12
+  });
+};
+
+/// Forwards to a VectorImage, counting the chunk requests
+class CountingImage : public Image<SeFloat> {
+public:
+  explicit CountingImage(std::shared_ptr<VectorImage<SeFloat>> img) : m_img(std::move(img)) {}
+
+  std::string getRepr() const override {
+    return "CountingImage";
+  }
+
+  int getWidth() const override {
+    return m_img->getWidth();
+  }
+
+  int getHeight() const override {
+    return m_img->getHeight();
+  }
+
+  std::shared_ptr<ImageChunk<SeFloat>> getChunk(int x, int y, int width, int height) const override {
+    ++m_count;
+    return m_img->getChunk(x, y, width, height);
+  }
+
+  std::shared_ptr<VectorImage<SeFloat>> m_img;
+  mutable int m_count = 0;
+};
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(CutoutImage_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(inside_test, CutoutImageFixture) {
+  auto cutout = CutoutImage<SeFloat>::create(img, 1, 0, 3, 2);
+  BOOST_CHECK_EQUAL(cutout->getWidth(), 4);
+  BOOST_CHECK_EQUAL(cutout->getHeight(), 3);
+  BOOST_CHECK(cutout->isInCutout(2, 1, 2, 1));
+
+  // Changes on the original image are not seen within the cutout
+  img->setValue(3, 1, -1);
+  auto chunk = cutout->getChunk(2, 1, 2, 1);
+  BOOST_CHECK_EQUAL(chunk->getValue(0, 0), 7);
+  BOOST_CHECK_EQUAL(chunk->getValue(1, 0), 8);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(outside_test, CutoutImageFixture) {
+  auto cutout = CutoutImage<SeFloat>::create(img, 1, 0, 3, 2);
+  BOOST_CHECK(!cutout->isInCutout(0, 0, 4, 3));
+
+  auto expected = VectorImage<SeFloat>::create(*img);
+  BOOST_CHECK(compareImages(expected, cutout->getChunk(0, 0, 4, 3)));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(clipped_test, CutoutImageFixture) {
+  auto cutout = CutoutImage<SeFloat>::create(img, -2, -2, 4, 10);
+  BOOST_CHECK_EQUAL(cutout->getCutoutOffset().m_x, 0);
+  BOOST_CHECK_EQUAL(cutout->getCutoutOffset().m_y, 0);
+  BOOST_CHECK_EQUAL(cutout->getCutoutWidth(), 2);
+  BOOST_CHECK_EQUAL(cutout->getCutoutHeight(), 3);
+
+  auto chunk = cutout->getChunk(0, 1, 2, 2);
+  auto expected = VectorImage<SeFloat>::create(2, 2, std::vector<SeFloat>{5, 6, 9, 10});
+  BOOST_CHECK(compareImages(expected, chunk));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(accessor_region_test) {
+  auto full = VectorImage<SeFloat>::create(100, 80);
+  for (int y = 0; y < full->getHeight(); ++y) {
+    for (int x = 0; x < full->getWidth(); ++x) {
+      full->setValue(x, y, x + y * 1000);
+    }
+  }
+  auto counting = std::make_shared<CountingImage>(full);
+
+  // Narrower than the default accessor read, and touching the right and bottom edges
+  auto cutout = CutoutImage<SeFloat>::create(counting, 90, 70, 99, 79);
+  BOOST_CHECK_EQUAL(counting->m_count, 1);
+
+  auto min_coord = cutout->getCutoutOffset();
+  PixelCoordinate max_coord(min_coord.m_x + cutout->getCutoutWidth() - 1,
+                            min_coord.m_y + cutout->getCutoutHeight() - 1);
+  ImageAccessor<SeFloat> accessor(cutout, min_coord, max_coord);
+
+  for (int x = max_coord.m_x; x >= min_coord.m_x; --x) {
+    for (int y = max_coord.m_y; y >= min_coord.m_y; --y) {
+      BOOST_CHECK_EQUAL(accessor.getValue(x, y), x + y * 1000);
+    }
+  }
+  for (int y = min_coord.m_y; y <= max_coord.m_y; ++y) {
+    for (int x = min_coord.m_x; x <= max_coord.m_x; ++x) {
+      BOOST_CHECK_EQUAL(accessor.getValue(x, y), x + y * 1000);
+    }
+  }
+  BOOST_CHECK_EQUAL(counting->m_count, 1);
+
+  // Outside the stamp the accessor falls back to the wrapped image
+  BOOST_CHECK_EQUAL(accessor.getValue(10, 5), 5010);
+  BOOST_CHECK_EQUAL(counting->m_count, 2);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
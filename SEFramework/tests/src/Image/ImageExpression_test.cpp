@@ -0,0 +1,104 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/ImageExpression_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "SEFramework/Image/ImageExpression.h"
+#include "SEFramework/Image/ProcessedImage.h"
+#include "SEFramework/Image/ThresholdedImage.h"
+#include "SEFramework/Image/VectorImage.h"
+
+#include "SEUtils/TestUtils.h"
+
+using namespace SourceXtractor;
+
+struct ImageExpressionFixture {
+  std::shared_ptr<VectorImage<SeFloat>> img;
+  std::shared_ptr<VectorImage<SeFloat>> var;
+
+  ImageExpressionFixture() : img{
+    VectorImage<SeFloat>::create(4, 3,
+                                 std::vector<SeFloat>{
+                                   1, 2, 3, 4,
+                                   5, 6, 7, 8,
+                                   9, 10, 11, 12
+                                 })
+  }, var{
+    VectorImage<SeFloat>::create(4, 3,
+                                 std::vector<SeFloat>{
+                                   1, 4, 9, 16,
+                                   1, 4, 9, 16,
+                                   0.25, 0.5, 2, 4
+                                 })
+  } {
+  }
+};
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(ImageExpression_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(subtractConstant, ImageExpressionFixture) {
+  auto background = ConstantImage<SeFloat>::create(4, 3, 2.);
+  auto expected = SubtractImage<SeFloat>::create(img, background);
+  auto expr = createExpressionImage(ImageExpr::image(img) - ImageExpr::image(background));
+
+  BOOST_CHECK_EQUAL(expr->getWidth(), 4);
+  BOOST_CHECK_EQUAL(expr->getHeight(), 3);
+  BOOST_CHECK(compareImages(expected, expr));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(threshold, ImageExpressionFixture) {
+  auto expected = ThresholdedImage<SeFloat>::create(img, var, 1.5);
+  auto expr = createExpressionImage(ImageExpr::image(img) - sqrt(ImageExpr::image(var)) * SeFloat(1.5));
+  BOOST_CHECK(compareImages(expected, expr));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(fusedChain, ImageExpressionFixture) {
+  auto background = ConstantImage<SeFloat>::create(4, 3, 0.5);
+  auto expected = SnrImage<SeFloat>::create(SubtractImage<SeFloat>::create(img, background), var);
+  auto expr = createExpressionImage((ImageExpr::image(img) - ImageExpr::image(background)) / sqrt(ImageExpr::image(var)));
+  BOOST_CHECK(compareImages(expected, expr));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(subChunk, ImageExpressionFixture) {
+  auto expr = createExpressionImage(max(ImageExpr::image(img) - SeFloat(6), SeFloat(0)));
+  auto chunk = expr->getChunk(1, 1, 3, 2);
+  auto expected = VectorImage<SeFloat>::create(3, 2, std::vector<SeFloat>{
+    0, 1, 2,
+    4, 5, 6
+  });
+  BOOST_CHECK(compareImages(expected, chunk));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
@@ -140,6 +140,18 @@ BOOST_FIXTURE_TEST_CASE( deblending_test_b, DeblendingFixture ) {
 
 //-----------------------------------------------------------------------------
 
+BOOST_FIXTURE_TEST_CASE( deblending_apply_steps_empty_test, DeblendingFixture ) {
+  Deblending deblending({example_deblend_step, example_deblend_step, example_deblend_step});
+  deblending.addObserver(test_group_observer);
+
+  auto result = deblending.applySteps(std::move(source_group));
+
+  BOOST_CHECK(result == nullptr);
+  BOOST_CHECK(test_group_observer->m_groups.empty());
+}
+
+//-----------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE_END ()
 
 
@@ -0,0 +1,133 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Pipeline/Profiler_test.cpp
+ * @date 10/19/26
+ */
+
+#include <sstream>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+
+#include "SEFramework/Pipeline/Profiler.h"
+
+using namespace SourceXtractor;
+
+struct ProfilerFixture {
+  ProfilerFixture() {
+    Profiler::getInstance().reset();
+  }
+
+  ~ProfilerFixture() {
+    Profiler::getInstance().reset();
+  }
+
+  static void busy(std::chrono::milliseconds duration) {
+    std::this_thread::sleep_for(duration);
+  }
+};
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (Profiler_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE (disabled_test, ProfilerFixture) {
+  {
+    ProfilerScope scope(Profiler::Category::STAGE, "outer");
+  }
+  Profiler::getInstance().sample("queue", 5);
+
+  std::ostringstream csv;
+  Profiler::getInstance().writeCsv(csv);
+  BOOST_CHECK_EQUAL(csv.str(), "category,name,count,total,self,min,max,mean,p50,p90,p99\n");
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE (nested_test, ProfilerFixture) {
+  Profiler::getInstance().enable(true);
+  {
+    ProfilerScope outer(Profiler::Category::STAGE, "outer");
+    busy(std::chrono::milliseconds(5));
+    for (int i = 0; i < 2; ++i) {
+      ProfilerScope inner(Profiler::Category::SOURCE_TASK, "inner");
+      busy(std::chrono::milliseconds(20));
+    }
+  }
+
+  std::ostringstream csv;
+  Profiler::getInstance().writeCsv(csv);
+  std::istringstream lines(csv.str());
+  std::string header, first, second, extra;
+  std::getline(lines, header);
+  std::getline(lines, first);
+  std::getline(lines, second);
+  BOOST_CHECK(!std::getline(lines, extra));
+
+  // Sorted by total time
+  BOOST_CHECK_EQUAL(first.substr(0, first.find(',', 6)), "stage,outer");
+  BOOST_CHECK_EQUAL(second.substr(0, second.find(',', 12)), "source_task,inner");
+
+  // The time spent on the inner scope is not part of the self time of the outer
+  double total, self;
+  char comma;
+  std::istringstream outer_values(first.substr(first.find(",1,") + 3));
+  outer_values >> total >> comma >> self;
+  BOOST_CHECK_GE(total, 0.045);
+  BOOST_CHECK_LT(self, 0.02);
+  BOOST_CHECK_GE(self, 0.005);
+
+  std::ostringstream trace;
+  Profiler::getInstance().writeChromeTrace(trace);
+  BOOST_CHECK_NE(trace.str().find("\"name\": \"inner\", \"cat\": \"source_task\", \"ph\": \"X\""), std::string::npos);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE (threads_and_gauges_test, ProfilerFixture) {
+  Profiler::getInstance().enable(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < 100; ++i) {
+        ProfilerScope scope(Profiler::Category::GROUP_TASK, "work");
+        Profiler::getInstance().sample("queue", t);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::ostringstream json;
+  Profiler::getInstance().writeJson(json);
+  BOOST_CHECK_NE(json.str().find("\"threads\": 4"), std::string::npos);
+  BOOST_CHECK_NE(json.str().find("\"category\": \"group_task\", \"name\": \"work\", \"calls\": 400"), std::string::npos);
+  BOOST_CHECK_NE(json.str().find("\"name\": \"queue\", \"samples\": 400, \"mean\": 1.5, \"min\": 0, \"max\": 3"),
+                 std::string::npos);
+
+  // Nothing traced
+  std::ostringstream trace;
+  Profiler::getInstance().writeChromeTrace(trace);
+  BOOST_CHECK_EQUAL(trace.str(), "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n]}\n");
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
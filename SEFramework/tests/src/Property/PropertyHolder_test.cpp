@@ -130,6 +130,23 @@ BOOST_FIXTURE_TEST_CASE( isPropertySet_test, ObjectWithPropertiesFixture ) {
   BOOST_CHECK(!object.isPropertySet(PropertyId::create<SimpleStringProperty>(1)));
 }
 
+BOOST_FIXTURE_TEST_CASE( overwriteKeepsReference_test, ObjectWithPropertiesFixture ) {
+  object.setProperty(std::unique_ptr<SimpleStringProperty>(new SimpleStringProperty(test_string)),
+      PropertyId::create<SimpleStringProperty>());
+  auto& first = dynamic_cast<const SimpleStringProperty&>(
+      object.getProperty(PropertyId::create<SimpleStringProperty>()));
+
+  // A concurrent computation may set the same property again
+  object.setProperty(std::unique_ptr<SimpleStringProperty>(new SimpleStringProperty(test_string_2)),
+      PropertyId::create<SimpleStringProperty>());
+
+  // The old reference is still valid, but the new value is returned from now on
+  BOOST_CHECK_EQUAL(first.m_str, test_string);
+  auto& second = dynamic_cast<const SimpleStringProperty&>(
+      object.getProperty(PropertyId::create<SimpleStringProperty>()));
+  BOOST_CHECK_EQUAL(second.m_str, test_string_2);
+}
+
 //-----------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END ()
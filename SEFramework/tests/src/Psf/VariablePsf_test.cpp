@@ -230,4 +230,36 @@ BOOST_AUTO_TEST_CASE(x_y_cubic_fractional) {
   checkEqual(psf, cubic_expected);
 }
 
+// With the cache enabled, the PSF is evaluated at the center of the cell
+BOOST_AUTO_TEST_CASE(x_y_cached) {
+  VariablePsf reference{1, {{"X_IMAGE", 0, 50., 5.}, {"Y_IMAGE", 1, 20., 3.}}, {2, 1}, {constant, x, x2, y, xy, x2y}};
+  VariablePsf cached{1, {{"X_IMAGE", 0, 50., 5.}, {"Y_IMAGE", 1, 20., 3.}}, {2, 1}, {constant, x, x2, y, xy, x2y}};
+  cached.setCache(4., 1024);
+
+  auto expected = reference.getPsf({102., 22.});
+
+  auto psf1 = cached.getPsf({100.5, 20.1});
+  checkEqual(psf1, expected);
+
+  // Same cell, modifying the previous result must not affect the cached one
+  psf1->at(0, 0) = -1.;
+  auto psf2 = cached.getPsf({103.9, 23.9});
+  checkEqual(psf2, expected);
+
+  // Different cell
+  auto psf3 = cached.getPsf({104., 22.});
+  checkEqual(psf3, reference.getPsf({106., 22.}));
+}
+
+// Only the pixel coordinates are moved to the center of their cell
+BOOST_AUTO_TEST_CASE(x_mag_cached) {
+  VariablePsf reference{1, {{"X_IMAGE", 0, 50., 5.}, {"MAG_AUTO", 1, 20., 3.}}, {2, 1}, {constant, x, x2, y, xy, x2y}};
+  VariablePsf cached{1, {{"X_IMAGE", 0, 50., 5.}, {"MAG_AUTO", 1, 20., 3.}}, {2, 1}, {constant, x, x2, y, xy, x2y}};
+  cached.setCache(4., 1024);
+
+  checkEqual(cached.getPsf({100.5, 20.1}), reference.getPsf({102., 20.1}));
+  checkEqual(cached.getPsf({103.9, 23.9}), reference.getPsf({102., 23.9}));
+  checkEqual(cached.getPsf({100.5, 20.1}), reference.getPsf({102., 20.1}));
+}
+
 BOOST_AUTO_TEST_SUITE_END ()
@@ -30,6 +30,7 @@
 #include "SEImplementation/Configuration/WeightImageConfig.h"
 
 #include "SEFramework/Background/BackgroundAnalyzer.h"
+#include "SEImplementation/Background/BackgroundCache.h"
 
 namespace SourceXtractor {
 
@@ -43,12 +44,21 @@ public:
   std::shared_ptr<BackgroundAnalyzer> createBackgroundAnalyzer() const;
   std::shared_ptr<BackgroundAnalyzer> createBackgroundAnalyzer(WeightImageConfig::WeightType weight_type) const;
 
+  /**
+   * @param cache_identity
+   *    Identifies the image and weight that are going to be analyzed, so the result can be cached
+   *    if --background-cache-dir is set. See BackgroundCache::fileIdentity.
+   */
+  std::shared_ptr<BackgroundAnalyzer> createBackgroundAnalyzer(WeightImageConfig::WeightType weight_type,
+                                                               const std::string& cache_identity) const;
+
   void initialize(const UserValues& args) override;
 
 private:
   std::vector<int> m_cell_size;
   std::vector<int> m_smoothing_box;
   WeightImageConfig::WeightType m_weight_type;
+  std::shared_ptr<BackgroundCache> m_cache;
 };
 
 }
@@ -0,0 +1,110 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * BackgroundCache.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_BACKGROUND_BACKGROUNDCACHE_H_
+#define _SEIMPLEMENTATION_BACKGROUND_BACKGROUNDCACHE_H_
+
+#include <memory>
+#include <string>
+
+#include "SEFramework/Image/Image.h"
+#include "SEFramework/Image/VectorImage.h"
+
+namespace SourceXtractor {
+
+/**
+ * Result of the background estimation, before it is interpolated to the full image size
+ */
+struct BackgroundMeshes {
+  /// Background level per cell
+  std::shared_ptr<VectorImage<SeFloat>> m_mode;
+  /// Background RMS per cell
+  std::shared_ptr<VectorImage<SeFloat>> m_sigma;
+  /// If true, m_sigma is used as variance map. Otherwise, the median RMS is used for the whole image
+  bool m_use_sigma_map;
+  SeFloat m_scaling, m_median, m_median_sigma;
+};
+
+/**
+ * @class BackgroundCache
+ * @brief On-disk cache of background meshes
+ *
+ * @details
+ *  Each entry is a file named after a hash of its key, that is also stored inside
+ *  so collisions can be detected. The key is built from the identity of the input files
+ *  (path, size, modification time, HDU...), the background parameters and, optionally, a
+ *  checksum of a sample of the pixels.
+ *  Entries are written into a temporary file first and then renamed, so the same directory can
+ *  be shared by concurrent jobs.
+ */
+class BackgroundCache {
+public:
+
+  /**
+   * Constructor
+   * @param directory
+   *    Where the entries are stored. It is created if it does not exist.
+   * @param checksum
+   *    If true, a sample of the image and weight pixels is part of the key
+   */
+  BackgroundCache(const std::string& directory, bool checksum);
+
+  /**
+   * @return
+   *    A string identifying a file on disk: absolute path, size and modification time.
+   *    An HDU selector as in image.fits[1] is kept on the identity, but ignored to find the file.
+   *    An empty path gives an empty identity.
+   */
+  static std::string fileIdentity(const std::string& path);
+
+  /**
+   * @return
+   *    A string identifying the pixels of an HDU (or a layer of a data cube) after scaling
+   */
+  static std::string imageIdentity(const std::string& path, int hdu, int layer, double scaling);
+
+  /**
+   * Complete the identity of the inputs and the parameters with the pixel checksum, if enabled
+   */
+  std::string makeKey(const std::string& identity, const Image<SeFloat>& image,
+                      const std::shared_ptr<Image<SeFloat>>& weight) const;
+
+  /**
+   * @return true if the entry was found and loaded into meshes
+   */
+  bool load(const std::string& key, BackgroundMeshes& meshes) const;
+
+  /**
+   * Store the meshes. Failures are reported, but not considered an error.
+   */
+  void store(const std::string& key, const BackgroundMeshes& meshes) const;
+
+private:
+  std::string m_directory;
+  bool m_checksum;
+
+  std::string getEntryPath(const std::string& key) const;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_BACKGROUND_BACKGROUNDCACHE_H_ */
@@ -21,14 +21,24 @@
 #include "SEFramework/Frame/Frame.h"
 #include "SEFramework/Image/Image.h"
 #include "SEFramework/Background/BackgroundAnalyzer.h"
+#include "SEImplementation/Background/BackgroundCache.h"
 #include "SEImplementation/Configuration/WeightImageConfig.h"
 
 namespace SourceXtractor {
 
 class SEBackgroundLevelAnalyzer : public BackgroundAnalyzer {
 public:
+  /**
+   * Constructor
+   * @param cache
+   *    If not null, the background meshes are looked up here before being computed, and stored afterwards
+   * @param cache_identity
+   *    Identifies the input image and weight (i.e. files, HDUs, scaling). Required for the cache to be used.
+   */
   SEBackgroundLevelAnalyzer(const std::vector<int>& cell_size, const std::vector<int>& smoothing_box,
-                            const WeightImageConfig::WeightType weight_type);
+                            const WeightImageConfig::WeightType weight_type,
+                            std::shared_ptr<BackgroundCache> cache = nullptr,
+                            const std::string& cache_identity = "");
 
   virtual ~SEBackgroundLevelAnalyzer() = default;
 
@@ -41,6 +51,17 @@ private:
   std::array<int, 2> m_smoothing_box;
 
   WeightImageConfig::WeightType m_weight_type;
+
+  std::shared_ptr<BackgroundCache> m_cache;
+  std::string m_cache_identity;
+
+  BackgroundMeshes computeMeshes(std::shared_ptr<DetectionImage> image, std::shared_ptr<WeightImage> variance_map,
+                                 std::shared_ptr<Image<unsigned char>> mask,
+                                 WeightImage::PixelType variance_threshold) const;
+
+  std::string getCacheKey(const DetectionImage& image, const std::shared_ptr<WeightImage>& variance_map,
+                          const std::shared_ptr<Image<unsigned char>>& mask,
+                          WeightImage::PixelType variance_threshold) const;
 };
 
 } // end of namespace SourceXtractor
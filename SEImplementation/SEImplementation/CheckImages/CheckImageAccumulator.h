@@ -0,0 +1,208 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckImageAccumulator.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_CHECKIMAGES_CHECKIMAGEACCUMULATOR_H_
+#define _SEIMPLEMENTATION_CHECKIMAGES_CHECKIMAGEACCUMULATOR_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "SEFramework/Image/VectorImage.h"
+#include "SEFramework/Image/WriteableImage.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CheckImageAccumulator
+ * @brief Composes stamps produced by the measurement workers into a check image
+ *
+ * @details
+ *  Workers render their contribution (model stamp, aperture mask, fitting window...) into a
+ *  private VectorImage, without holding any lock, and hand it over with addStamp.
+ *  A single compositor thread merges the staged stamps into the target image in batches,
+ *  so the target - which normally is a WriteableBufferedImage, not safe for concurrent writes -
+ *  only has one writer, and workers never serialize on it.
+ *
+ *  The number of staged pixels is bounded: if the compositor falls behind, addStamp blocks.
+ */
+template <typename T>
+class CheckImageAccumulator {
+public:
+
+  enum class Operation {
+    /// Add the stamp to the existing pixel values
+    ADD,
+    /// Overwrite the target with the stamp pixels that are not zero
+    PAINT
+  };
+
+  /**
+   * Constructor
+   * @param target
+   *    Image where the stamps are composed
+   * @param max_staged_pixels
+   *    Maximum number of pixels waiting to be composed before addStamp blocks
+   */
+  explicit CheckImageAccumulator(std::shared_ptr<WriteableImage<T>> target,
+                                 size_t max_staged_pixels = 16 * 1024 * 1024)
+    : m_target(std::move(target)), m_max_staged_pixels(max_staged_pixels), m_staged_pixels(0),
+      m_composing(false), m_stop(false) {
+    m_compositor = std::thread(&CheckImageAccumulator::compositorLoop, this);
+  }
+
+  /**
+   * Destructor. Composes any pending stamp before returning.
+   */
+  ~CheckImageAccumulator() {
+    {
+      std::lock_guard<std::mutex> lock(m_queue_mutex);
+      m_stop = true;
+    }
+    m_new_stamp.notify_all();
+    m_compositor.join();
+  }
+
+  /**
+   * Stage a stamp to be merged into the target image
+   * @param x
+   *    Position of the stamp left column on the target image. May be out of bounds.
+   * @param y
+   *    Position of the stamp top row on the target image. May be out of bounds.
+   * @param stamp
+   *    Pixel values. Ownership is transferred to the accumulator.
+   * @param operation
+   *    How to merge the stamp with the existing values
+   */
+  void addStamp(int x, int y, std::shared_ptr<VectorImage<T>> stamp, Operation operation = Operation::ADD) {
+    size_t npixels = stamp->getWidth() * stamp->getHeight();
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    // Let always one stamp through, even if it is bigger than the limit
+    m_composed.wait(lock, [this, npixels]() {
+      return m_staged_pixels == 0 || m_staged_pixels + npixels <= m_max_staged_pixels;
+    });
+    m_staged.emplace_back(StagedStamp{x, y, std::move(stamp), operation});
+    m_staged_pixels += npixels;
+    lock.unlock();
+    m_new_stamp.notify_one();
+  }
+
+  /**
+   * Block until all the staged stamps have been composed into the target
+   */
+  void flush() {
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    m_composed.wait(lock, [this]() {
+      return m_staged.empty() && !m_composing;
+    });
+  }
+
+  const std::shared_ptr<WriteableImage<T>>& getTarget() const {
+    return m_target;
+  }
+
+private:
+  struct StagedStamp {
+    int m_x, m_y;
+    std::shared_ptr<VectorImage<T>> m_stamp;
+    Operation m_operation;
+  };
+
+  std::shared_ptr<WriteableImage<T>> m_target;
+  size_t m_max_staged_pixels, m_staged_pixels;
+  std::deque<StagedStamp> m_staged;
+  bool m_composing, m_stop;
+
+  std::mutex m_queue_mutex;
+  std::condition_variable m_new_stamp, m_composed;
+  std::thread m_compositor;
+
+  void compositorLoop() {
+    std::deque<StagedStamp> batch;
+    while (true) {
+      size_t batch_pixels = 0;
+      {
+        std::unique_lock<std::mutex> lock(m_queue_mutex);
+        m_new_stamp.wait(lock, [this]() { return m_stop || !m_staged.empty(); });
+        if (m_staged.empty() && m_stop) {
+          break;
+        }
+        std::swap(batch, m_staged);
+        m_composing = true;
+      }
+
+      {
+        // Other users may still go through LockedWriteableImage
+        std::lock_guard<std::mutex> write_lock(m_target->m_write_mutex);
+        for (auto& staged : batch) {
+          compose(staged);
+          batch_pixels += staged.m_stamp->getWidth() * staged.m_stamp->getHeight();
+        }
+      }
+      batch.clear();
+
+      {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_staged_pixels -= batch_pixels;
+        m_composing = false;
+      }
+      m_composed.notify_all();
+    }
+  }
+
+  void compose(const StagedStamp& staged) {
+    const auto& stamp = *staged.m_stamp;
+    int x_start = std::max(0, staged.m_x);
+    int y_start = std::max(0, staged.m_y);
+    int x_end = std::min(m_target->getWidth(), staged.m_x + stamp.getWidth());
+    int y_end = std::min(m_target->getHeight(), staged.m_y + stamp.getHeight());
+    if (x_start >= x_end || y_start >= y_end) {
+      return;
+    }
+
+    auto chunk = m_target->getChunk(x_start, y_start, x_end - x_start, y_end - y_start);
+    for (int y = y_start; y < y_end; ++y) {
+      for (int x = x_start; x < x_end; ++x) {
+        T value = stamp.getValue(x - staged.m_x, y - staged.m_y);
+        switch (staged.m_operation) {
+          case Operation::ADD:
+            if (value != 0) {
+              m_target->setValue(x, y, chunk->getValue(x - x_start, y - y_start) + value);
+            }
+            break;
+          case Operation::PAINT:
+            if (value != 0) {
+              m_target->setValue(x, y, value);
+            }
+            break;
+        }
+      }
+    }
+  }
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_CHECKIMAGES_CHECKIMAGEACCUMULATOR_H_ */
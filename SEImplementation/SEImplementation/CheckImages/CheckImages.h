@@ -39,6 +39,7 @@
 #include "SEFramework/Frame/Frame.h"
 
 #include "SEImplementation/Image/LockedWriteableImage.h"
+#include "SEImplementation/CheckImages/CheckImageAccumulator.h"
 
 
 namespace SourceXtractor {
@@ -121,6 +122,19 @@ public:
 
   std::shared_ptr<WriteableImage<MeasurementImage::PixelType>> getPsfImage(unsigned int frame_number);
 
+  /**
+   * The accumulators let measurement workers stage their stamps without locking the check image.
+   * They are composed into the same images returned by the getters above, and flushed by saveImages.
+   * @return nullptr if the check image is not enabled
+   */
+  std::shared_ptr<CheckImageAccumulator<int>> getMeasurementAutoApertureAccumulator(unsigned int frame_number);
+
+  std::shared_ptr<CheckImageAccumulator<int>> getMeasurementApertureAccumulator(unsigned int frame_number);
+
+  std::shared_ptr<CheckImageAccumulator<MeasurementImage::PixelType>> getModelFittingAccumulator(unsigned int frame_number);
+
+  std::shared_ptr<CheckImageAccumulator<int>> getFittingWindowAccumulator(unsigned int frame_number);
+
   std::shared_ptr<WriteableImage<float>> getMLDetectionImage(unsigned int plane_number, size_t index);
 
   void addBackgroundCheckImage(std::shared_ptr<Image<SeFloat>> background_image) {
@@ -170,6 +184,26 @@ private:
 
   static std::unique_ptr<CheckImages> m_instance;
 
+  // These must be called with m_access_mutex held
+  std::shared_ptr<WriteableImage<int>> getOrCreateMeasurementAutoApertureImage(unsigned int frame_number);
+  std::shared_ptr<WriteableImage<int>> getOrCreateMeasurementApertureImage(unsigned int frame_number);
+  std::shared_ptr<WriteableImage<MeasurementImage::PixelType>> getOrCreateModelFittingImage(unsigned int frame_number);
+  std::shared_ptr<WriteableImage<int>> getOrCreateFittingWindowImage(unsigned int frame_number);
+
+  template <typename T>
+  static std::shared_ptr<CheckImageAccumulator<T>> getOrCreateAccumulator(
+      std::map<unsigned int, std::shared_ptr<CheckImageAccumulator<T>>>& accumulators,
+      unsigned int frame_number, const std::shared_ptr<WriteableImage<T>>& image) {
+    if (image == nullptr) {
+      return nullptr;
+    }
+    auto i = accumulators.find(frame_number);
+    if (i == accumulators.end()) {
+      i = accumulators.emplace(frame_number, std::make_shared<CheckImageAccumulator<T>>(image)).first;
+    }
+    return i->second;
+  }
+
   struct FrameInfo {
     std::string m_label;
     int m_width, m_height;
@@ -191,6 +225,11 @@ private:
   std::map<unsigned int, std::shared_ptr<WriteableImage<int>>> m_check_image_fitting_window;
   std::vector<std::map<unsigned int, std::shared_ptr<WriteableImage<float>>>> m_check_image_ml_detection;
 
+  std::map<unsigned int, std::shared_ptr<CheckImageAccumulator<int>>> m_measurement_aperture_accumulators;
+  std::map<unsigned int, std::shared_ptr<CheckImageAccumulator<int>>> m_measurement_auto_aperture_accumulators;
+  std::map<unsigned int, std::shared_ptr<CheckImageAccumulator<MeasurementImage::PixelType>>> m_model_fitting_accumulators;
+  std::map<unsigned int, std::shared_ptr<CheckImageAccumulator<int>>> m_fitting_window_accumulators;
+
   std::vector<std::shared_ptr<DetectionImage>> m_detection_images;
   std::vector<std::shared_ptr<Image<SeFloat>>> m_background_images;
   std::vector<std::shared_ptr<Image<SeFloat>>> m_filtered_images;
@@ -0,0 +1,77 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointConfig.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_CONFIGURATION_CHECKPOINTCONFIG_H_
+#define _SEIMPLEMENTATION_CONFIGURATION_CHECKPOINTCONFIG_H_
+
+#include "Configuration/Configuration.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CheckpointConfig
+ * @brief Where and how often the completed groups are persisted, so an interrupted run can be resumed
+ *
+ * @details
+ *  A run restarted with the same configuration and checkpoint directory replays the segmentation,
+ *  but does not measure again the groups already written to a checkpoint.
+ *  The configuration is summarized by a hash of the option values, leaving out those that do not
+ *  change the results (threading, caching, logging...), so a mismatch can be detected.
+ */
+class CheckpointConfig : public Euclid::Configuration::Configuration {
+public:
+  explicit CheckpointConfig(long manager_id);
+
+  virtual ~CheckpointConfig() = default;
+
+  std::map<std::string, OptionDescriptionList> getProgramOptions() override;
+
+  void initialize(const UserValues& args) override;
+
+  /// True if a checkpoint directory has been set
+  bool isEnabled() const {
+    return !m_directory.empty();
+  }
+
+  const std::string& getDirectory() const {
+    return m_directory;
+  }
+
+  /// Minimum number of seconds between checkpoints
+  double getInterval() const {
+    return m_interval;
+  }
+
+  /// Hash of the options that affect the results
+  const std::string& getConfigurationHash() const {
+    return m_configuration_hash;
+  }
+
+private:
+  std::string m_directory;
+  double m_interval;
+  std::string m_configuration_hash;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_CONFIGURATION_CHECKPOINTCONFIG_H_ */
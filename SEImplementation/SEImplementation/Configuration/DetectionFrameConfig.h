@@ -20,6 +20,8 @@
 
 #include "Configuration/Configuration.h"
 #include "SEFramework/Frame/Frame.h"
+#include "SEImplementation/Configuration/DetectionImageConfig.h"
+#include "SEImplementation/Configuration/WeightImageConfig.h"
 
 namespace SourceXtractor {
 
@@ -47,6 +49,10 @@ class DetectionFrameConfig : public Euclid::Configuration::Configuration {
     return m_frames;
   }
 
+  /// Identifies the pixels of a detection image extension and its weight, for the background cache
+  static std::string getBackgroundIdentity(const DetectionImageConfig& detection_image_config,
+                                           const WeightImageConfig& weight_image_config, size_t index);
+
 private:
   std::vector<std::shared_ptr<DetectionImageFrame>> m_frames;
 };
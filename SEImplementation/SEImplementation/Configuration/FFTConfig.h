@@ -0,0 +1,58 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * FFTConfig.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_CONFIGURATION_FFTCONFIG_H_
+#define _SEIMPLEMENTATION_CONFIGURATION_FFTCONFIG_H_
+
+#include "Configuration/Configuration.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class FFTConfig
+ * @brief Configures the FFTW planner rigor, and loads the FFTW wisdom saved by previous runs
+ */
+class FFTConfig : public Euclid::Configuration::Configuration {
+public:
+  explicit FFTConfig(long manager_id);
+
+  virtual ~FFTConfig() = default;
+
+  std::map<std::string, OptionDescriptionList> getProgramOptions() override;
+
+  void initialize(const UserValues& args) override;
+
+  /// Path where the wisdom is persisted. Empty if disabled.
+  const std::string& getWisdomFile() const {
+    return m_wisdom_file;
+  }
+
+  /// Save the wisdom accumulated during this run, if enabled
+  void saveWisdom() const;
+
+private:
+  std::string m_wisdom_file;
+};
+
+}
+
+#endif /* _SEIMPLEMENTATION_CONFIGURATION_FFTCONFIG_H_ */
@@ -67,6 +67,9 @@ public:
     int m_weight_layer;
 
     bool m_psf_renormalize;
+
+    /// Identifies the image and weight pixels, for the background cache
+    std::string m_background_identity;
   };
 
   explicit MeasurementImageConfig(long manager_id);
@@ -66,6 +66,7 @@ public:
   double getMetaIterationStop() const { return m_meta_iteration_stop; }
   FlexibleModelFittingIterativeTask::WindowType getWindowType() const { return m_window_type; }
   double getEllipseScale() const { return m_ellipse_scale; }
+  bool getBatchConvolution() const { return m_batch_convolution; }
 
 private:
   std::string m_least_squares_engine;
@@ -78,6 +79,7 @@ private:
   FlexibleModelFittingIterativeTask::WindowType m_window_type
       { FlexibleModelFittingIterativeTask::WindowType::RECTANGLE };
   double m_ellipse_scale { 3.0 };
+  bool m_batch_convolution { false };
   
   std::map<int, std::shared_ptr<FlexibleModelFittingParameter>> m_parameters;
   std::map<int, std::shared_ptr<FlexibleModelFittingModel>> m_models;
@@ -51,8 +51,25 @@ public:
     return m_max_queue_size;
   }
 
+  /// Memory budget, in bytes, for the groups being measured. 0 means no limit.
+  size_t getMaxQueueMemory() const {
+    return m_max_queue_memory;
+  }
+
+  /// Number of waiting groups considered when choosing the next one to measure
+  unsigned getScheduleWindow() const {
+    return m_schedule_window;
+  }
+
+  /// Minimum number of sources for a group to be measured across frames in parallel. 0 means never.
+  unsigned getBandParallelSources() const {
+    return m_band_parallel_sources;
+  }
+
 private:
   int m_threads_nb, m_max_queue_size;
+  size_t m_max_queue_memory;
+  unsigned m_schedule_window, m_band_parallel_sources;
   std::shared_ptr<Euclid::ThreadPool> m_thread_pool;
 };
 
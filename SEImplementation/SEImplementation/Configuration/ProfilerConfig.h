@@ -0,0 +1,63 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ProfilerConfig.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_CONFIGURATION_PROFILERCONFIG_H_
+#define _SEIMPLEMENTATION_CONFIGURATION_PROFILERCONFIG_H_
+
+#include "Configuration/Configuration.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class ProfilerConfig
+ * @brief Enables the Profiler if a profile or a trace has been requested
+ */
+class ProfilerConfig : public Euclid::Configuration::Configuration {
+public:
+  explicit ProfilerConfig(long manager_id);
+
+  virtual ~ProfilerConfig() = default;
+
+  std::map<std::string, OptionDescriptionList> getProgramOptions() override;
+
+  void initialize(const UserValues& args) override;
+
+  /// Where to write the aggregated profile. CSV if the extension is .csv, JSON otherwise. Empty if disabled.
+  const std::string& getProfileFile() const {
+    return m_profile_file;
+  }
+
+  /// Where to write the Chrome trace-event file. Empty if disabled.
+  const std::string& getTraceFile() const {
+    return m_trace_file;
+  }
+
+  /// Write the requested files
+  void writeProfile() const;
+
+private:
+  std::string m_profile_file, m_trace_file;
+};
+
+}
+
+#endif /* _SEIMPLEMENTATION_CONFIGURATION_PROFILERCONFIG_H_ */
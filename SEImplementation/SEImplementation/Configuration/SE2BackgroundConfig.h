@@ -47,9 +47,21 @@ public:
     return m_smoothing_box;
   }
 
+  /// Directory where the background meshes are cached. Empty if caching is disabled.
+  const std::string& getCacheDirectory() const {
+    return m_cache_dir;
+  }
+
+  /// If true, a sample of the pixel values is part of the cache key
+  bool getCacheChecksum() const {
+    return m_cache_checksum;
+  }
+
 private:
   std::vector<int> m_cell_size;
   std::vector<int> m_smoothing_box;
+  std::string m_cache_dir;
+  bool m_cache_checksum;
 };
 
 } /* namespace SourceXtractor */
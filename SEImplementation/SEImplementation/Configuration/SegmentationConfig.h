@@ -56,6 +56,7 @@ public:
 
   std::map<std::string, Configuration::OptionDescriptionList> getProgramOptions() override;
   void preInitialize(const UserValues& args) override;
+  void initialize(const UserValues& args) override;
 
   Algorithm getAlgorithmOption() const {
     return m_selected_algorithm;
@@ -94,6 +95,7 @@ private:
 
   Algorithm m_selected_algorithm;
   std::shared_ptr<DetectionImageFrame::ImageFilter> m_filter;
+  unsigned m_filter_threads;
 
   int m_lutz_window_size;
   int m_bfs_max_delta;
@@ -0,0 +1,73 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ShardConfig.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_CONFIGURATION_SHARDCONFIG_H_
+#define _SEIMPLEMENTATION_CONFIGURATION_SHARDCONFIG_H_
+
+#include "Configuration/Configuration.h"
+#include "SEUtils/PixelRectangle.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class ShardConfig
+ * @brief Restricts the processing to a rectangular region of the detection image
+ *
+ * @details
+ *  A large image can be split into shards processed by independent processes. Each one detects
+ *  sources on its core region, plus a margin around it, so sources crossing the core border are
+ *  complete as long as they fit in the margin (the segmentation cuts them at its edge). Only the sources with their centroid inside the core are written to the catalog, so
+ *  the catalogs of adjacent shards do not overlap.
+ */
+class ShardConfig : public Euclid::Configuration::Configuration {
+public:
+  explicit ShardConfig(long manager_id);
+
+  virtual ~ShardConfig() = default;
+
+  std::map<std::string, OptionDescriptionList> getProgramOptions() override;
+
+  void initialize(const UserValues& args) override;
+
+  /// True if a shard region has been set
+  bool isEnabled() const {
+    return m_enabled;
+  }
+
+  /// Region owned by this shard, in 0-based pixel coordinates of the detection image
+  const PixelRectangle& getCoreRegion() const {
+    return m_core;
+  }
+
+  int getMargin() const {
+    return m_margin;
+  }
+
+private:
+  bool m_enabled;
+  PixelRectangle m_core;
+  int m_margin;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_CONFIGURATION_SHARDCONFIG_H_ */
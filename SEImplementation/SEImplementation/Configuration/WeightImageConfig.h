@@ -75,12 +75,21 @@ public:
     return m_symmetry_usage;
   }
 
+  const std::string& getWeightImagePath() const {
+    return m_weight_image_path;
+  }
+
+  WeightImage::PixelType getWeightScaling() const {
+    return m_weight_scaling;
+  }
+
   static std::shared_ptr<WeightImage> convertWeightMap(std::shared_ptr<WeightImage> weight_image, WeightType weight_type, WeightImage::PixelType scaling = 1);
 
 private:
 
   std::vector<std::shared_ptr<WeightImage>> m_weight_images;
   std::vector<WeightImage::PixelType> m_scaled_weight_thresholds;
+  std::string m_weight_image_path;
 
   WeightType m_weight_type;
   bool m_absolute_weight;
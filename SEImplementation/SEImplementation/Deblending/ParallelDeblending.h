@@ -0,0 +1,57 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ParallelDeblending.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_DEBLENDING_PARALLELDEBLENDING_H_
+#define _SEIMPLEMENTATION_DEBLENDING_PARALLELDEBLENDING_H_
+
+#include "SEFramework/Pipeline/Deblending.h"
+#include "SEImplementation/Prefetcher/OrderedStage.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class ParallelDeblending
+ * @brief Applies the deblending steps to each group on the thread pool
+ *
+ * @details
+ *  Groups are independent, so their deblending (i.e. the cleaning, which evaluates
+ *  a model of every neighbour over each pixel) can run concurrently, and overlap with segmentation
+ *  and grouping. Groups are released to the measurement following the order they were received.
+ */
+class ParallelDeblending : public OrderedStage<SourceGroupInterface> {
+public:
+
+  ParallelDeblending(std::shared_ptr<Deblending> deblending, const std::shared_ptr<Euclid::ThreadPool>& thread_pool,
+                     unsigned max_queue_size);
+
+  virtual ~ParallelDeblending();
+
+protected:
+  std::vector<std::unique_ptr<SourceGroupInterface>> process(std::unique_ptr<SourceGroupInterface> group) const override;
+
+private:
+  std::shared_ptr<Deblending> m_deblending;
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEIMPLEMENTATION_DEBLENDING_PARALLELDEBLENDING_H_
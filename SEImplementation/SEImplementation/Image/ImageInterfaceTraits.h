@@ -106,6 +106,12 @@ typedef enum  {INTERP_NEARESTNEIGHBOUR, INTERP_BILINEAR, INTERP_LANCZOS2,
 float interpolate_pix(float *pix, float x, float y,
                              int xsize, int ysize, interpenum interptype);
 
+/// Fill kernel with the interpolation weights for the fractional position pos
+void make_kernel(float pos, float *kernel, interpenum interptype);
+
+void shiftResizeLancszosFast(const ImageInterfaceTypePtr& source, ImageInterfaceTypePtr& window,
+                             double scale_factor, double x_shift, double y_shift);
+
 } // end of namespace SExtractor
 
 #endif /* _SEIMPLEMENTATION_IMAGE_IMAGEINTERFACETRAITS_H_ */
@@ -0,0 +1,86 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * LanczosResampler.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_IMAGE_LANCZOSRESAMPLER_H_
+#define _SEIMPLEMENTATION_IMAGE_LANCZOSRESAMPLER_H_
+
+#include <memory>
+#include <vector>
+
+#include "SEFramework/Image/VectorImage.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class LanczosResampler
+ * @brief Adds an image into another one, scaled and shifted with a Lanczos4 kernel
+ *
+ * @details
+ *  The Lanczos kernel is separable, so for a given scale, sub-pixel shift and size the
+ *  weights only depend on the output row or column. They are computed once into a
+ *  table per axis, and kept on a per-thread cache: during a fit, most of the evaluations
+ *  (i.e. the derivatives with respect to anything but the position) place the stamps
+ *  at the very same positions.
+ *
+ *  The source is resampled one output row at a time: first vertically, over contiguous
+ *  source rows, and then horizontally, accumulating directly into the target image.
+ *  Only the output rows and columns that fall within the target are computed.
+ */
+class LanczosResampler {
+public:
+
+  /// Number of taps of the kernel
+  static constexpr int TAPS = 8;
+
+  /// Weights along one axis
+  struct AxisWeights {
+    /// First source pixel for each output pixel, or -1 if the output pixel is left empty
+    std::vector<int> m_first;
+    /// TAPS weights for each output pixel
+    std::vector<float> m_weights;
+  };
+
+  /**
+   * Get the weights to resample one axis
+   * @param scale_factor
+   *    Size of an output pixel in source pixels
+   * @param shift
+   *    Sub-pixel shift, in output pixels
+   * @param source_size
+   *    Number of source pixels along the axis
+   * @param output_size
+   *    Number of output pixels along the axis
+   */
+  static std::shared_ptr<const AxisWeights> getWeights(double scale_factor, double shift,
+                                                       int source_size, int output_size);
+
+  /**
+   * Add source into target, scaled by scale_factor and centered at (x, y). The result is corrected
+   * by the scaling so the integral of the added image is preserved.
+   */
+  static void addImage(VectorImage<SeFloat>& target, const VectorImage<SeFloat>& source,
+                       double scale_factor, double x, double y);
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_IMAGE_LANCZOSRESAMPLER_H_ */
@@ -0,0 +1,75 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * GroupCostModel.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_MEASUREMENT_GROUPCOSTMODEL_H_
+#define _SEIMPLEMENTATION_MEASUREMENT_GROUPCOSTMODEL_H_
+
+#include <cstddef>
+#include <mutex>
+
+namespace SourceXtractor {
+
+/**
+ * @class GroupCostModel
+ * @brief Predicts the relative cost of measuring a group
+ *
+ * @details
+ *  The cost is modeled as `source_cost * sources + pixel_cost * pixels`, where pixels is the total
+ *  number of pixels of the sources of the group. Initially, a source is considered as expensive
+ *  as `source_weight` pixels. Once enough measurements have been reported with update(),
+ *  both coefficients are fitted by least squares to the observed times.
+ *
+ *  Only the relative order of the estimations is meaningful, so they can be used to schedule
+ *  the most expensive groups first.
+ */
+class GroupCostModel {
+public:
+
+  /**
+   * Constructor
+   * @param source_weight
+   *    Initial cost of a source, relative to the cost of a pixel
+   * @param min_samples
+   *    Number of measured groups required before fitting the coefficients
+   */
+  explicit GroupCostModel(double source_weight = 1000., size_t min_samples = 32);
+
+  /// Estimated cost of a group
+  double estimate(size_t sources, size_t pixels) const;
+
+  /// Report the time it took to measure a group. Safe to call from multiple threads.
+  void update(size_t sources, size_t pixels, double seconds);
+
+private:
+  const size_t m_min_samples;
+  double m_source_cost, m_pixel_cost;
+
+  // Accumulated normal equations for the least squares fit
+  size_t m_samples;
+  double m_ss, m_sp, m_pp, m_st, m_pt;
+
+  mutable std::mutex m_mutex;
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEIMPLEMENTATION_MEASUREMENT_GROUPCOSTMODEL_H_
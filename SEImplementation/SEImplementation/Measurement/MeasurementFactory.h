@@ -27,6 +27,7 @@
 #include "SEFramework/Output/Output.h"
 #include "SEFramework/Pipeline/Measurement.h"
 #include "SEFramework/Configuration/Configurable.h"
+#include "SEFramework/Task/TaskProvider.h"
 #include "AlexandriaKernel/ThreadPool.h"
 
 namespace SourceXtractor {
@@ -40,8 +41,11 @@ class MeasurementFactory : public Configurable {
 
 public:
 
-  explicit MeasurementFactory(std::shared_ptr<OutputRegistry> output_registry)
-      : m_output_registry(output_registry), m_threads_nb(0), m_max_queue(0) {}
+  explicit MeasurementFactory(std::shared_ptr<OutputRegistry> output_registry,
+                              std::shared_ptr<const TaskProvider> task_provider = nullptr)
+      : m_output_registry(output_registry), m_task_provider(task_provider), m_threads_nb(0), m_max_queue(0),
+        m_max_queue_memory(0), m_frames_nb(1), m_schedule_window(1), m_band_parallel_sources(0),
+        m_ordered_output(false) {}
 
   std::unique_ptr<Measurement> getMeasurement() const;
 
@@ -53,9 +57,12 @@ public:
 private:
   std::vector<std::string> m_output_properties;
   std::shared_ptr<OutputRegistry> m_output_registry;
+  std::shared_ptr<const TaskProvider> m_task_provider;
   std::shared_ptr<Euclid::ThreadPool> m_thread_pool;
 
   unsigned int m_threads_nb, m_max_queue;
+  size_t m_max_queue_memory, m_frames_nb, m_schedule_window, m_band_parallel_sources;
+  bool m_ordered_output;
 };
 
 }
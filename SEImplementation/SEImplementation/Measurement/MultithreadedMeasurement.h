@@ -29,22 +29,83 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <set>
 #include "AlexandriaKernel/ThreadPool.h"
-#include "AlexandriaKernel/Semaphore.h"
 #include "SEFramework/Pipeline/Measurement.h"
+#include "SEFramework/Task/TaskProvider.h"
+#include "SEImplementation/Measurement/GroupCostModel.h"
 
 namespace SourceXtractor {
 
+/**
+ * @class MultithreadedMeasurement
+ * @brief Measures the groups on the thread pool
+ *
+ * @details
+ *  Groups are admitted while the number of groups in flight is below max_queue_size, and their
+ *  estimated memory footprint fits within max_queue_bytes. Otherwise receiveSource blocks,
+ *  applying back-pressure to the upstream stages. A group is always admitted if nothing else
+ *  is in flight, even if it is bigger than the limit.
+ *
+ *  Admitted groups are not necessarily measured in the order they arrive: when a worker becomes
+ *  free, it picks the most expensive group among the schedule_window oldest groups waiting
+ *  (longest-processing-time-first), so a big blend does not end up being the last one to start.
+ *  Only groups that arrived less than schedule_window groups after the oldest one not yet released
+ *  are eligible, so a cheap group can not be indefinitely passed over, and the groups finished
+ *  ahead of it remain bounded.
+ *  The cost is predicted by a GroupCostModel, refined with the measured times.
+ *  A window of 1 measures the groups in order of arrival.
+ *
+ *  With ordered_output, the measured groups are released in the order they arrived. A group counts
+ *  against the limits until it has been released, including while it waits for its predecessors.
+ *
+ *  Groups with at least band_parallel_sources sources are, in addition, measured across
+ *  measurement frames in parallel: the measurement frame properties (images, cutouts, coordinates...)
+ *  are fanned out to the thread pool, one band per frame, and gathered back before the group is
+ *  converted into rows and released. The properties derived from them are computed afterwards, as usual.
+ */
 class MultithreadedMeasurement : public Measurement {
 public:
 
   using SourceToRowConverter = std::function<Euclid::Table::Row(const SourceInterface&)>;
+
+  /**
+   * Constructor
+   * @param source_to_row
+   *    Triggers the measurement of a source
+   * @param thread_pool
+   *    Worker threads
+   * @param max_queue_size
+   *    Maximum number of groups in flight
+   * @param max_queue_bytes
+   *    Maximum estimated memory used by the groups in flight. 0 means no limit.
+   * @param frames_nb
+   *    Number of measurement frames, used to estimate the footprint of a group
+   * @param schedule_window
+   *    Number of waiting groups considered when choosing which one to measure next
+   * @param task_provider
+   *    Used to know which properties have been requested so far, and thus which ones can be
+   *    computed per band. If null, groups are never split.
+   * @param band_parallel_sources
+   *    Minimum number of sources a group needs to have to be measured band-parallel. 0 disables it.
+   * @param ordered_output
+   *    Release the groups in the same order they were received
+   */
   MultithreadedMeasurement(SourceToRowConverter source_to_row, const std::shared_ptr<Euclid::ThreadPool>& thread_pool,
-                           unsigned max_queue_size)
+                           unsigned max_queue_size, size_t max_queue_bytes = 0, size_t frames_nb = 1,
+                           size_t schedule_window = 1, std::shared_ptr<const TaskProvider> task_provider = nullptr,
+                           size_t band_parallel_sources = 0, bool ordered_output = false)
       : m_source_to_row(source_to_row),
         m_thread_pool(thread_pool),
         m_group_counter(0),
-        m_input_done(false), m_abort_raised(false), m_semaphore(max_queue_size) {}
+        m_input_done(false), m_abort_raised(false),
+        m_max_queue_size(max_queue_size), m_max_queue_bytes(max_queue_bytes), m_frames_nb(frames_nb),
+        m_queued_groups(0), m_queued_bytes(0), m_schedule_window(std::max<size_t>(1, schedule_window)),
+        m_task_provider(std::move(task_provider)), m_band_parallel_sources(band_parallel_sources),
+        m_ordered_output(ordered_output), m_next_output(0) {}
 
   ~MultithreadedMeasurement() override;
 
@@ -55,10 +116,37 @@ public:
   void stopThreads() override;
   void synchronizeThreads() override;
 
+  /**
+   * Rough estimation of the memory required to measure a group: pixel lists, detection stamps
+   * and the cutouts of each measurement frame, over the bounding box of each source.
+   */
+  static size_t estimateFootprint(const SourceGroupInterface& group, size_t frames_nb);
+
 private:
+  struct QueuedGroup {
+    int m_order_number;
+    size_t m_footprint;
+    size_t m_sources, m_pixels;
+    std::unique_ptr<SourceGroupInterface> m_group;
+  };
+
   static void outputThreadStatic(MultithreadedMeasurement* measurement);
   void outputThreadLoop();
 
+  /// Blocks until the group fits within the limits
+  void admit(int order_number, size_t footprint);
+  /// Returns the footprint of a released group to the budget
+  void release(int order_number, size_t footprint);
+  /// Order number of the oldest group admitted and not yet released
+  int oldestUnreleased();
+  void notifyQueueProgress();
+
+  /// Called from a worker: measure the most expensive group within the schedule window
+  void measureNext();
+
+  /// Compute the per-band properties of a big group on the thread pool, and wait for them
+  void measureBands(SourceGroupInterface& group, size_t sources);
+
   SourceToRowConverter m_source_to_row;
   std::shared_ptr<Euclid::ThreadPool> m_thread_pool;
   std::unique_ptr<std::thread> m_output_thread;
@@ -67,9 +155,29 @@ private:
   std::atomic_bool m_input_done, m_abort_raised;
 
   std::condition_variable m_new_output;
-  std::list<std::pair<int, std::unique_ptr<SourceGroupInterface>>> m_output_queue;
+  std::map<int, QueuedGroup> m_output_queue;
   std::mutex m_output_queue_mutex;
-  Euclid::Semaphore m_semaphore;
+
+  // Admission control
+  const size_t m_max_queue_size, m_max_queue_bytes, m_frames_nb;
+  size_t m_queued_groups, m_queued_bytes;
+  std::set<int> m_unreleased;
+  std::mutex m_admission_mutex;
+  std::condition_variable m_admission_released;
+
+  // Scheduling
+  const size_t m_schedule_window;
+  GroupCostModel m_cost_model;
+  std::list<QueuedGroup> m_pending;
+  std::mutex m_pending_mutex;
+
+  // Band-parallel measurement
+  std::shared_ptr<const TaskProvider> m_task_provider;
+  const size_t m_band_parallel_sources;
+
+  // Ordered output
+  const bool m_ordered_output;
+  int m_next_output;
 };
 
 }
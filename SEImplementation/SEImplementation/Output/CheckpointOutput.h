@@ -0,0 +1,115 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointOutput.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_OUTPUT_CHECKPOINTOUTPUT_H_
+#define _SEIMPLEMENTATION_OUTPUT_CHECKPOINTOUTPUT_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "SEImplementation/Output/FlushableOutput.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CheckpointOutput
+ * @brief Persists periodically the rows written and the groups they come from, so a run can be resumed
+ *
+ * @details
+ *  Every checkpoint writes the rows generated since the previous one as a FITS table into the
+ *  checkpoint directory, and then appends to the `completed` index the keys of the groups they belong to.
+ *  Groups are identified by their detection frame and footprint, which do not depend on the order
+ *  in which they are processed.
+ *
+ *  When created over a directory with a previous checkpoint, the saved rows are written again
+ *  to the output, frame by frame, and isCompleted can be used to skip the groups they come from.
+ *  The configuration must be the same as in the interrupted run: its hash is stored next to the
+ *  index, and resuming with a different one is refused.
+ */
+class CheckpointOutput : public Output {
+public:
+  /**
+   * Constructor
+   * @param output
+   *    Output receiving the groups
+   * @param rows_output
+   *    Output that finally writes the rows. It may be the same as `output`, or wrapped by it.
+   * @param directory
+   *    Checkpoint directory
+   * @param interval
+   *    Minimum number of seconds between checkpoints
+   * @param configuration_hash
+   *    Identifies the configuration of the run
+   */
+  CheckpointOutput(std::shared_ptr<Output> output, std::shared_ptr<FlushableOutput> rows_output,
+                   const std::string& directory, double interval, const std::string& configuration_hash);
+
+  virtual ~CheckpointOutput() = default;
+
+  void receiveSource(std::unique_ptr<SourceGroupInterface> source_group) override;
+
+  void outputSource(const SourceInterface& source) override;
+
+  size_t flush() override;
+
+  void nextPart() override;
+
+  /// True if the group was saved by a previous run. Can be called from any thread.
+  bool isCompleted(const SourceGroupInterface& group) const;
+
+  /// Number of groups saved by a previous run
+  size_t getRestoredGroupCount() const {
+    return m_restored_count;
+  }
+
+  /// Identifier of the group, stable between runs with the same configuration
+  static uint64_t getGroupKey(const SourceGroupInterface& group);
+
+private:
+  std::shared_ptr<Output> m_output;
+  std::shared_ptr<FlushableOutput> m_rows_output;
+  std::string m_directory;
+  std::chrono::duration<double> m_interval;
+
+  /// Groups restored from the previous run, by frame
+  std::map<size_t, std::set<uint64_t>> m_restored;
+  /// Catalog parts written by the previous run, by frame
+  std::map<size_t, std::vector<std::string>> m_restored_parts;
+  size_t m_restored_count;
+
+  std::atomic<size_t> m_frame;
+  size_t m_part_nb;
+  std::vector<Euclid::Table::Row> m_pending_rows;
+  std::vector<uint64_t> m_pending_groups;
+  std::chrono::steady_clock::time_point m_last_checkpoint;
+
+  void restore(const std::string& configuration_hash);
+  void replayParts();
+  void checkpoint();
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_OUTPUT_CHECKPOINTOUTPUT_H_ */
@@ -0,0 +1,73 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CoreRegionOutput.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_OUTPUT_COREREGIONOUTPUT_H_
+#define _SEIMPLEMENTATION_OUTPUT_COREREGIONOUTPUT_H_
+
+#include "SEUtils/PixelRectangle.h"
+#include "SEFramework/Output/Output.h"
+#include "SEImplementation/Plugin/PixelCentroid/PixelCentroid.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CoreRegionOutput
+ * @brief Forwards to the wrapped output only the sources with the pixel centroid inside the core region
+ *
+ * @details
+ *  The limits are at the pixel borders, so the core regions of adjacent shards
+ *  do not share any coordinate, and every source is written by exactly one shard.
+ */
+class CoreRegionOutput : public Output {
+public:
+  CoreRegionOutput(std::shared_ptr<Output> output, const PixelRectangle& core)
+    : m_output(std::move(output)),
+      m_min_x(core.getTopLeft().m_x - .5), m_min_y(core.getTopLeft().m_y - .5),
+      m_max_x(core.getBottomRight().m_x + .5), m_max_y(core.getBottomRight().m_y + .5) {
+  }
+
+  virtual ~CoreRegionOutput() = default;
+
+  void outputSource(const SourceInterface& source) override {
+    const auto& centroid = source.getProperty<PixelCentroid>();
+    double x = centroid.getCentroidX(), y = centroid.getCentroidY();
+    if (x >= m_min_x && x < m_max_x && y >= m_min_y && y < m_max_y) {
+      m_output->outputSource(source);
+    }
+  }
+
+  size_t flush() override {
+    return m_output->flush();
+  }
+
+  void nextPart() override {
+    m_output->nextPart();
+  }
+
+private:
+  std::shared_ptr<Output> m_output;
+  double m_min_x, m_min_y, m_max_x, m_max_y;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_OUTPUT_COREREGIONOUTPUT_H_ */
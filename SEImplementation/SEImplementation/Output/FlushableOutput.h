@@ -18,6 +18,7 @@ class FlushableOutput : public Output {
 
 public:
   using SourceToRowConverter = std::function<Euclid::Table::Row(const SourceInterface&)>;
+  using RowObserver = std::function<void(const Euclid::Table::Row&)>;
 
   FlushableOutput(SourceToRowConverter source_to_row, size_t flush_size)
       : m_source_to_row(source_to_row), m_flush_size(flush_size), m_total_rows_written(0) {
@@ -35,18 +36,33 @@ public:
   }
 
   void outputSource(const SourceInterface& source) override {
-    m_rows.emplace_back(m_source_to_row(source));
+    auto row = m_source_to_row(source);
+    if (m_row_observer) {
+      m_row_observer(row);
+    }
+    outputRow(std::move(row));
+  }
+
+  /// Write a row that has already been converted, i.e. when restoring a checkpoint
+  void outputRow(Euclid::Table::Row row) {
+    m_rows.emplace_back(std::move(row));
     if (m_flush_size > 0 && m_rows.size() % m_flush_size == 0) {
       flush();
     }
   }
 
+  /// The observer is called with every row generated from a source
+  void setRowObserver(RowObserver observer) {
+    m_row_observer = std::move(observer);
+  }
+
 protected:
   virtual void writeRows(const std::vector<Euclid::Table::Row>& rows) = 0;
 
 private:
   SourceToRowConverter m_source_to_row;
   size_t m_flush_size;
+  RowObserver m_row_observer;
 
   std::vector<Euclid::Table::Row> m_rows {};
   size_t m_total_rows_written;
@@ -23,6 +23,7 @@
 #ifndef _SEIMPLEMENTATION_OUTPUT_OUTPUTFACTORY_H
 #define _SEIMPLEMENTATION_OUTPUT_OUTPUTFACTORY_H
 
+#include "SEUtils/PixelRectangle.h"
 #include "SEImplementation/Configuration/OutputConfig.h"
 #include "SEFramework/Output/Output.h"
 #include "SEFramework/Configuration/Configurable.h"
@@ -39,7 +40,8 @@ class OutputFactory : public Configurable {
 public:
 
   explicit OutputFactory(std::shared_ptr<OutputRegistry> output_registry)
-    : m_output_registry(output_registry), m_flush_size(100), m_output_format(OutputConfig::OutputFileFormat::ASCII) {
+    : m_output_registry(output_registry), m_flush_size(100), m_output_format(OutputConfig::OutputFileFormat::ASCII),
+      m_checkpoint_interval(0) {
   }
 
   /// Destructor
@@ -59,6 +61,14 @@ private:
   OutputConfig::OutputFileFormat m_output_format;
   std::string m_output_filename;
 
+  /// If set, only the sources within this region of the detection image are written
+  PixelRectangle m_core_region;
+
+  /// If set, the measured groups are saved periodically into this directory
+  std::string m_checkpoint_dir;
+  double m_checkpoint_interval;
+  std::string m_checkpoint_configuration;
+
 }; /* End of OutputFactory class */
 
 } /* namespace SourceXtractor */
@@ -62,7 +62,8 @@ private:
       const std::vector<PixelCoordinate>& pixel_coords,
       std::shared_ptr<VectorImage<DetectionImage::PixelType>> image,
       const std::vector<std::shared_ptr<MultiThresholdNode>>& source_nodes,
-      const PixelCoordinate& offset
+      const PixelCoordinate& offset,
+      boost::random::mt19937& rng
       ) const;
 
   std::shared_ptr<SourceFactory> m_source_factory;
@@ -70,7 +71,6 @@ private:
   unsigned int m_thresholds_nb;
   unsigned int m_min_deblend_area;
   unsigned int m_seed;
-  boost::random::mt19937 m_rng;
 };
 
 
@@ -0,0 +1,60 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ParallelPartition.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PARTITION_PARALLELPARTITION_H_
+#define _SEIMPLEMENTATION_PARTITION_PARALLELPARTITION_H_
+
+#include "SEFramework/Pipeline/Partition.h"
+#include "SEImplementation/Prefetcher/OrderedStage.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class ParallelPartition
+ * @brief Applies the partition steps to each detected source on the thread pool
+ *
+ * @details
+ *  Partitioning a large source (i.e. multi-threshold deblending) may be expensive.
+ *  This stage runs the partition of each source on a worker thread, so the segmentation does not need to wait.
+ *  The resulting sources, and the ProcessSourcesEvent, are released following the detection order.
+ *
+ *  Partition steps must be safe to be called concurrently, and must number the sources they split
+ *  after the detection (see SourceId), so the ids do not depend on the order the workers finish.
+ */
+class ParallelPartition : public OrderedStage<SourceInterface> {
+public:
+
+  ParallelPartition(std::shared_ptr<Partition> partition, const std::shared_ptr<Euclid::ThreadPool>& thread_pool,
+                    unsigned max_queue_size);
+
+  virtual ~ParallelPartition();
+
+protected:
+  std::vector<std::unique_ptr<SourceInterface>> process(std::unique_ptr<SourceInterface> source) const override;
+
+private:
+  std::shared_ptr<Partition> m_partition;
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEIMPLEMENTATION_PARTITION_PARALLELPARTITION_H_
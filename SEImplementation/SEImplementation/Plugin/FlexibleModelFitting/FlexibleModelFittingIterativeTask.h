@@ -63,7 +63,8 @@ public:
       double meta_iteration_stop=0.0001,
       size_t max_fit_size=100,
       WindowType window_type = WindowType::RECTANGLE,
-      double ellipse_scale=3.0
+      double ellipse_scale=3.0,
+      bool batch_convolution=false
       );
 
   virtual ~FlexibleModelFittingIterativeTask();
@@ -154,6 +155,7 @@ private:
   std::vector<bool> m_should_renormalize;
   WindowType m_window_type { WindowType::RECTANGLE };
   double m_ellipse_scale = 3.0;
+  bool m_batch_convolution = false;
 };
 
 }
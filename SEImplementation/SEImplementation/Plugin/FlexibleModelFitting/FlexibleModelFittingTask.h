@@ -46,7 +46,8 @@ public:
       std::vector<std::shared_ptr<FlexibleModelFittingParameter>> parameters,
       std::vector<std::shared_ptr<FlexibleModelFittingFrame>> frames,
       std::vector<std::shared_ptr<FlexibleModelFittingPrior>> priors,
-      double scale_factor=1.0
+      double scale_factor=1.0,
+      bool batch_convolution=false
       );
 
   virtual ~FlexibleModelFittingTask();
@@ -86,6 +87,7 @@ private:
   std::vector<std::shared_ptr<FlexibleModelFittingPrior>> m_priors;
 
   double m_scale_factor;
+  bool m_batch_convolution;
 };
 
 }
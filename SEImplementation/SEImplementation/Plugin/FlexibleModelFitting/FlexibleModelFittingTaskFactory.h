@@ -54,6 +54,7 @@ private:
   double m_meta_iteration_stop { 0.0001 };
   FlexibleModelFittingIterativeTask::WindowType m_window_type { FlexibleModelFittingIterativeTask::WindowType::RECTANGLE };
   double m_ellipse_scale { 3.0 };
+  bool m_batch_convolution { false };
 
   std::vector<std::shared_ptr<FlexibleModelFittingParameter>> m_parameters;
   std::vector<std::shared_ptr<FlexibleModelFittingFrame>> m_frames;
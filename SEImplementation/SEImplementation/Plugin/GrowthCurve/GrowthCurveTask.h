@@ -18,10 +18,14 @@
 #ifndef _SEIMPLEMENTATION_PLUGIN_GROWTHCURVE_GROWTHCURVETASK_H_
 #define _SEIMPLEMENTATION_PLUGIN_GROWTHCURVE_GROWTHCURVETASK_H_
 
+#include "SEUtils/Types.h"
 #include "SEFramework/Task/SourceTask.h"
 
 namespace SourceXtractor {
 
+/// The growth curve extends up to this many times the semi-major axis, or the Kron radius if larger
+static const SeFloat GROWTH_NSIG = 6.;
+
 class GrowthCurveTask : public SourceTask {
 public:
   virtual ~GrowthCurveTask() = default;
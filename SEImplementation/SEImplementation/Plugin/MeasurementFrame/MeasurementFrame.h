@@ -47,6 +47,7 @@ protected:
   friend class MeasurementFrameCoordinatesTask;
   friend class MeasurementFrameInfoTask;
   friend class MeasurementFrameImagesTask;
+  friend class MeasurementFrameCutoutTask;
 
 private:
   std::shared_ptr<MeasurementImageFrame> m_measurement_frame;
@@ -0,0 +1,100 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutout.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUT_H_
+#define _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUT_H_
+
+#include <ElementsKernel/Exception.h>
+
+#include "SEFramework/Frame/Frame.h"
+#include "SEFramework/Image/CutoutImage.h"
+#include "SEFramework/Image/ImageAccessor.h"
+#include "SEFramework/Property/Property.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class MeasurementFrameCutout
+ * @brief Stamps of the subtracted image and variance map around a source, on a measurement frame
+ *
+ * @details
+ *  The stamps are materialized once, large enough for the photometry plugins (apertures,
+ *  auto and growth curve, vignets), which read from them instead of going each through the tile cache.
+ *  Reads outside the stamps are still possible, and served by the frame images.
+ *  The buffers are released together with the source, when its group leaves the measurement.
+ */
+class MeasurementFrameCutout : public Property {
+public:
+  virtual ~MeasurementFrameCutout() = default;
+
+  /**
+   * Constructor
+   * @param frame
+   *    Measurement frame
+   * @param min_coord, max_coord
+   *    Corners of the stamp, inclusive. Clipped to the frame boundaries.
+   */
+  MeasurementFrameCutout(const std::shared_ptr<MeasurementImageFrame>& frame, PixelCoordinate min_coord,
+                         PixelCoordinate max_coord)
+    : m_image(CutoutImage<SeFloat>::create(frame->getSubtractedImage(), min_coord.m_x, min_coord.m_y,
+                                           max_coord.m_x - min_coord.m_x + 1, max_coord.m_y - min_coord.m_y + 1)),
+      m_variance(CutoutImage<SeFloat>::create(frame->getVarianceMap(), min_coord.m_x, min_coord.m_y,
+                                              max_coord.m_x - min_coord.m_x + 1, max_coord.m_y - min_coord.m_y + 1)) {
+  }
+
+  /// Subtracted image, with the stamp materialized
+  const std::shared_ptr<CutoutImage<SeFloat>>& getImage() const {
+    return m_image;
+  }
+
+  /// Variance map, with the stamp materialized
+  const std::shared_ptr<CutoutImage<SeFloat>>& getVarianceMap() const {
+    return m_variance;
+  }
+
+  /// Same as MeasurementFrameImages::getLockedImage, for the layers available on the cutout.
+  /// Reads within the stamp are all served by its buffer.
+  std::shared_ptr<ImageAccessor<SeFloat>> getLockedImage(FrameImageLayer layer) const {
+    switch (layer) {
+      case LayerSubtractedImage:
+        return createAccessor(m_image);
+      case LayerVarianceMap:
+        return createAccessor(m_variance);
+      default:
+        throw Elements::Exception() << "Layer " << layer << " is not available on the measurement cutout";
+    }
+  }
+
+private:
+  static std::shared_ptr<ImageAccessor<SeFloat>> createAccessor(const std::shared_ptr<CutoutImage<SeFloat>>& cutout) {
+    auto min_coord = cutout->getCutoutOffset();
+    PixelCoordinate max_coord(min_coord.m_x + cutout->getCutoutWidth() - 1,
+                              min_coord.m_y + cutout->getCutoutHeight() - 1);
+    return std::make_shared<ImageAccessor<SeFloat>>(cutout, min_coord, max_coord);
+  }
+
+  std::shared_ptr<CutoutImage<SeFloat>> m_image, m_variance;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUT_H_ */
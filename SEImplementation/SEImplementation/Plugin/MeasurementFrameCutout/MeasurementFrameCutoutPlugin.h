@@ -0,0 +1,40 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutPlugin.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTPLUGIN_H_
+#define _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTPLUGIN_H_
+
+#include "SEFramework/Plugin/Plugin.h"
+
+namespace SourceXtractor {
+
+class MeasurementFrameCutoutPlugin : public Plugin {
+public:
+  virtual ~MeasurementFrameCutoutPlugin() = default;
+
+  void registerPlugin(PluginAPI& plugin_api) override;
+  std::string getIdString() const override;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTPLUGIN_H_ */
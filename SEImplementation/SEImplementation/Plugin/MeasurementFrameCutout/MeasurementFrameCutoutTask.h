@@ -0,0 +1,67 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutTask.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASK_H_
+#define _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASK_H_
+
+#include <array>
+
+#include "SEUtils/Types.h"
+#include "SEFramework/Task/SourceTask.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class MeasurementFrameCutoutTask
+ * @brief Materializes the stamp used by the photometry plugins for a source on a measurement frame
+ */
+class MeasurementFrameCutoutTask : public SourceTask {
+public:
+  virtual ~MeasurementFrameCutoutTask() = default;
+
+  /**
+   * Constructor
+   * @param instance
+   *    Measurement frame
+   * @param max_aperture
+   *    Largest aperture diameter configured for this frame, on the detection frame
+   * @param kron_factor, kron_minrad
+   *    Auto photometry configuration
+   * @param vignet_size
+   *    Vignet size, on the measurement frame
+   */
+  MeasurementFrameCutoutTask(unsigned instance, SeFloat max_aperture, SeFloat kron_factor, SeFloat kron_minrad,
+                             std::array<int, 2> vignet_size)
+    : m_instance(instance), m_max_aperture(max_aperture), m_kron_factor(kron_factor), m_kron_minrad(kron_minrad),
+      m_vignet_size(vignet_size) {}
+
+  void computeProperties(SourceInterface& source) const override;
+
+private:
+  unsigned m_instance;
+  SeFloat m_max_aperture, m_kron_factor, m_kron_minrad;
+  std::array<int, 2> m_vignet_size;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASK_H_ */
@@ -0,0 +1,59 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutTaskFactory.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASKFACTORY_H_
+#define _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASKFACTORY_H_
+
+#include <array>
+#include <map>
+
+#include "SEUtils/Types.h"
+#include "SEFramework/Task/TaskFactory.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class MeasurementFrameCutoutTaskFactory
+ * @brief Produces MeasurementFrameCutoutTask, sized after the photometry configuration
+ */
+class MeasurementFrameCutoutTaskFactory : public TaskFactory {
+public:
+  MeasurementFrameCutoutTaskFactory() : m_kron_factor(0), m_kron_minrad(0), m_vignet_size{{0, 0}} {}
+
+  virtual ~MeasurementFrameCutoutTaskFactory() = default;
+
+  void reportConfigDependencies(Euclid::Configuration::ConfigManager& manager) const override;
+
+  void configure(Euclid::Configuration::ConfigManager& manager) override;
+
+  // TaskFactory implementation
+  std::shared_ptr<Task> createTask(const PropertyId& property_id) const override;
+
+private:
+  std::map<unsigned, SeFloat> m_max_aperture;
+  SeFloat m_kron_factor, m_kron_minrad;
+  std::array<int, 2> m_vignet_size;
+};
+
+} // end of namespace SourceXtractor
+
+#endif /* _SEIMPLEMENTATION_PLUGIN_MEASUREMENTFRAMECUTOUT_MEASUREMENTFRAMECUTOUTTASKFACTORY_H_ */
@@ -41,24 +41,24 @@ public:
     // FIXME is it correct to use filtered values?
     const auto& pixel_values = source.getProperty<DetectionFramePixelValues>().getFilteredValues();
 
-    auto& coordinates = source.getProperty<PixelCoordinateList>().getCoordinateList();
+    auto& coordinates = source.getProperty<PixelCoordinateList>();
 
     DetectionImage::PixelType peak_value = std::numeric_limits<DetectionImage::PixelType>::min();
     DetectionImage::PixelType min_value = std::numeric_limits<DetectionImage::PixelType>::max();
 
-    unsigned int index=0;
+    auto coordinate = coordinates.begin();
     int peak_value_x=-1;
     int peak_value_y=-1;
     for (auto value = pixel_values.begin(); value!=pixel_values.end(); ++value){
     //for(unsigned i : indices(pixel_values)) {
 	if (*value>peak_value){
 	    peak_value = *value;
-	    peak_value_x = coordinates[index].m_x;
-	    peak_value_y = coordinates[index].m_y;
+	    peak_value_x = coordinate->m_x;
+	    peak_value_y = coordinate->m_y;
 	}
 	if (*value<min_value)
 	  min_value=*value;
-	index++;
+	++coordinate;
     }
     //std::cout << "Value: " << peak_value << "x/y: " << peak_value_x << " " << peak_value_y<< std::endl;
     source.setProperty<PeakValue>(min_value, peak_value, peak_value_x, peak_value_y);
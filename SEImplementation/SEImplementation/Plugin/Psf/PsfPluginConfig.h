@@ -33,7 +33,7 @@ class PsfPluginConfig: public Euclid::Configuration::Configuration {
 public:
   virtual ~PsfPluginConfig() = default;
 
-  explicit PsfPluginConfig(long manager_id): Configuration(manager_id) {}
+  explicit PsfPluginConfig(long manager_id): Configuration(manager_id), m_cache_cell_size(0), m_cache_max_bytes(0) {}
 
   std::map<std::string, OptionDescriptionList> getProgramOptions() override;
 
@@ -42,11 +42,18 @@ public:
 
   const std::shared_ptr<Psf>& getPsf() const;
 
+  /// Read a PSF file, and configure it with the options given by the user (i.e. cache)
+  std::shared_ptr<Psf> loadPsf(const std::string &filename, int hdu_number = 1) const;
+
   static std::shared_ptr<Psf> readPsf(const std::string &filename, int hdu_number = 1);
   static std::shared_ptr<Psf> generateGaussianPsf(SeFloat fwhm, SeFloat pixel_sampling);
 
 private:
   std::shared_ptr<Psf> m_vpsf;
+  double m_cache_cell_size;
+  size_t m_cache_max_bytes;
+
+  void setupCache(const std::shared_ptr<Psf>& psf) const;
 };
 
 } // end SourceXtractor
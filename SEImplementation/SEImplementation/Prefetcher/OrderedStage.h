@@ -0,0 +1,297 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * OrderedStage.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_PREFETCHER_ORDEREDSTAGE_H_
+#define _SEIMPLEMENTATION_PREFETCHER_ORDEREDSTAGE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ElementsKernel/Exception.h>
+#include <ElementsKernel/Logging.h>
+
+#include "AlexandriaKernel/memory_tools.h"
+#include "AlexandriaKernel/ThreadPool.h"
+#include "AlexandriaKernel/Semaphore.h"
+#include "SEFramework/Pipeline/PipelineStage.h"
+#include "SEFramework/Pipeline/Profiler.h"
+
+namespace SourceXtractor {
+
+/**
+ * Unlock/lock an existing lock using RAII
+ */
+template<typename Lock>
+struct ReverseLock {
+  explicit ReverseLock(Lock& lock) : m_lock(lock) {
+    m_lock.unlock();
+  }
+
+  ~ReverseLock() {
+    m_lock.lock();
+  }
+
+private:
+  Lock& m_lock;
+};
+
+/**
+ * @class OrderedStage
+ * @brief Pipeline stage that processes its input on a thread pool, but passes the results
+ * downstream in the same order the input was received
+ *
+ * @details
+ *  Each received object is processed independently on a worker thread by the process() method,
+ *  which can return any number of results. A single output thread releases the results
+ *  following the order of reception.
+ *
+ *  ProcessSourcesEvent are synchronization points: an event is only passed along once everything
+ *  received before it has been released, and nothing received after is released before the event.
+ *
+ *  The number of objects in flight is bounded: receiveSource blocks when the limit is reached.
+ *
+ *  When the Profiler is enabled, the time spent on process() is accounted as "<name>.process",
+ *  and the number of objects in flight is sampled as "<name>.queue".
+ *
+ *  Derived classes must call wait() on their destructor, so no worker uses process() once
+ *  the derived object is gone.
+ *
+ * @tparam In
+ *  Type received from the previous stage
+ * @tparam Out
+ *  Type sent to the next stage
+ */
+template <typename In, typename Out = In>
+class OrderedStage : public PipelineReceiver<In>, public PipelineEmitter<Out> {
+public:
+
+  /**
+   * Constructor
+   * @param thread_pool
+   *    Alexandria thread pool
+   * @param max_queue_size
+   *    Maximum number of objects being processed, or waiting to be released
+   * @param logger_name
+   *    Name used for logging
+   */
+  OrderedStage(const std::shared_ptr<Euclid::ThreadPool>& thread_pool, unsigned max_queue_size,
+               const std::string& logger_name)
+    : m_thread_pool(thread_pool), m_logger(Elements::Logging::getLogger(logger_name)),
+      m_process_scope(logger_name + ".process"), m_queue_gauge(logger_name + ".queue"),
+      m_next_sequence(0), m_stop(false), m_semaphore(max_queue_size) {
+    m_output_thread = Euclid::make_unique<std::thread>(&OrderedStage::outputLoop, this);
+  }
+
+  virtual ~OrderedStage() {
+    wait();
+  }
+
+  /**
+   * Queue the processing of the received object in the thread pool.
+   * Once it is done, and everything received before is done, the results will be passed along.
+   */
+  void receiveSource(std::unique_ptr<In> message) override {
+    m_semaphore.acquire();
+
+    uint64_t sequence;
+    size_t in_flight;
+    {
+      std::lock_guard<std::mutex> queue_lock(m_queue_mutex);
+      sequence = m_next_sequence++;
+      m_received.emplace_back(EventType::SOURCE, sequence);
+      in_flight = m_received.size();
+    }
+    Profiler::getInstance().sample(m_queue_gauge, in_flight);
+
+    auto lambda = [this, sequence, message = std::move(message)]() mutable {
+      std::vector<std::unique_ptr<Out>> results;
+      {
+        ProfilerScope scope(Profiler::Category::STAGE, m_process_scope);
+        results = process(std::move(message));
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_finished.emplace(sequence, std::move(results));
+      }
+      m_new_output.notify_one();
+    };
+    auto lambda_copyable = [lambda = std::make_shared<decltype(lambda)>(std::move(lambda))](){
+      (*lambda)();
+    };
+    m_thread_pool->submit(lambda_copyable);
+  }
+
+  /**
+   * Handle ProcessSourcesEvent. All objects received prior to this message need to
+   * be processed before the event, and objects coming after, are passed along.
+   */
+  void receiveProcessSignal(const ProcessSourcesEvent& message) override {
+    {
+      std::lock_guard<std::mutex> output_lock(m_queue_mutex);
+      m_received.emplace_back(EventType::PROCESS_SOURCE);
+      m_event_queue.emplace_back(message);
+    }
+    m_new_output.notify_one();
+    m_logger.debug() << "ProcessSourceEvent received";
+  }
+
+  /**
+   * Wait for the pending work to be released, and stop the output thread.
+   * Calling it more than once is harmless.
+   */
+  void wait() {
+    if (!m_output_thread->joinable()) {
+      return;
+    }
+    m_stop = true;
+    m_new_output.notify_one();
+    m_output_thread->join();
+  }
+
+  /**
+   * Wait until the queue is empty but don't stop the thread
+   */
+  void synchronize() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> output_lock(m_queue_mutex);
+        if (m_received.empty()) {
+          break;
+        }
+        else if (m_thread_pool->checkForException(false)) {
+          m_logger.fatal() << "An exception was thrown from a worker thread";
+          m_thread_pool->checkForException(true);
+        }
+        else if (m_thread_pool->activeThreads() == 0) {
+          throw Elements::Exception() << "No active threads and the queue is not empty! Please, report this as a bug";
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+  }
+
+protected:
+
+  /**
+   * Called from the worker threads for each received object
+   * @return
+   *    The objects to pass downstream. May be empty.
+   */
+  virtual std::vector<std::unique_ptr<Out>> process(std::unique_ptr<In> message) const = 0;
+
+private:
+  struct EventType {
+    enum Type {
+      SOURCE, PROCESS_SOURCE
+    } m_event_type;
+    uint64_t m_sequence;
+
+    explicit EventType(Type type, uint64_t sequence = 0)
+      : m_event_type(type), m_sequence(sequence) {}
+  };
+
+  /// Pointer to the pool of worker threads
+  std::shared_ptr<Euclid::ThreadPool> m_thread_pool;
+  Elements::Logging m_logger;
+  /// Names used for profiling
+  const std::string m_process_scope, m_queue_gauge;
+  /// Orchestration thread
+  std::unique_ptr<std::thread> m_output_thread;
+  /// Notifies there is a new object done processing
+  std::condition_variable m_new_output;
+  /// Finished objects, by order of reception
+  std::map<uint64_t, std::vector<std::unique_ptr<Out>>> m_finished;
+  /// Queue of received ProcessSourceEvent, order preserved
+  std::deque<ProcessSourcesEvent> m_event_queue;
+  /// Queue of type of received events. Used to pass downstream events respecting the received order
+  std::deque<EventType> m_received;
+  uint64_t m_next_sequence;
+
+  std::mutex m_queue_mutex;
+
+  /// Termination condition for the output loop
+  std::atomic_bool m_stop;
+
+  /// Keep the queue under control
+  Euclid::Semaphore m_semaphore;
+
+  void outputLoop() {
+    m_logger.debug() << "Starting output loop";
+
+    while (m_thread_pool->activeThreads() > 0) {
+      std::unique_lock<std::mutex> output_lock(m_queue_mutex);
+
+      // Wait for something new
+      m_new_output.wait_for(output_lock, std::chrono::milliseconds(1000));
+
+      // Process the output queue
+      // This is, release results when the front of the received has been processed
+      while (!m_received.empty()) {
+        auto next = m_received.front();
+        // If the front is a ProcessSourceEvent, everything received before is done,
+        // so pass downstream
+        if (next.m_event_type == EventType::PROCESS_SOURCE) {
+          auto event = m_event_queue.front();
+          m_event_queue.pop_front();
+          m_logger.debug() << "ProcessSourceEvent released";
+          {
+            ReverseLock<decltype(output_lock)> release_lock(output_lock);
+            this->sendProcessSignal(event);
+          }
+          m_received.pop_front();
+          continue;
+        }
+        // Find if the matching object is done
+        auto processed = m_finished.find(next.m_sequence);
+        // If not, we can't keep going, so exit here
+        if (processed == m_finished.end()) {
+          break;
+        }
+        // If it is, send the results downstream
+        auto results = std::move(processed->second);
+        m_finished.erase(processed);
+        {
+          ReverseLock<decltype(output_lock)> release_lock(output_lock);
+          for (auto& result : results) {
+            this->sendSource(std::move(result));
+          }
+        }
+        m_received.pop_front();
+        m_semaphore.release();
+      }
+
+      if (m_stop && m_received.empty()) {
+        break;
+      }
+    }
+    m_logger.debug() << "Stopping output loop";
+  }
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEIMPLEMENTATION_PREFETCHER_ORDEREDSTAGE_H_
@@ -18,11 +18,8 @@
 #ifndef _SEIMPLEMENTATION_MEASUREMENT_PREFETCHER_H_
 #define _SEIMPLEMENTATION_MEASUREMENT_PREFETCHER_H_
 
-#include <condition_variable>
-#include "AlexandriaKernel/ThreadPool.h"
-#include "AlexandriaKernel/Semaphore.h"
 #include "SEFramework/Source/SourceInterface.h"
-#include "SEFramework/Pipeline/PipelineStage.h"
+#include "SEImplementation/Prefetcher/OrderedStage.h"
 
 namespace SourceXtractor {
 
@@ -34,10 +31,10 @@ namespace SourceXtractor {
  * The pre-fetcher *must* handle also ProcessSourcesEvent, as they are synchronization points.
  * When one is received, only sources detected *before* the event will be passed along. Everyone
  * else will have to wait until there are no more soures prior to the event being processed.
- * Then, they will be released and sent along.
+ * Then, they will be released and sent along. This ordering is implemented by OrderedStage.
  *
  */
-class Prefetcher : public PipelineReceiver<SourceInterface>, public PipelineEmitter<SourceInterface> {
+class Prefetcher : public OrderedStage<SourceInterface> {
 public:
 
   /**
@@ -52,20 +49,6 @@ public:
    */
   virtual ~Prefetcher();
 
-  /**
-   * Trigger multi-threaded measurements on the source interface.
-   * Once they are done, the message will be passed along.
-   * @param message
-   */
-  void receiveSource(std::unique_ptr<SourceInterface> source) override;
-
-  /**
-   * Handle ProcessSourcesEvent. All sources received prior to this message need to
-   * be processed before sources coming after are passed along.
-   * @param message
-   */
-  void receiveProcessSignal(const ProcessSourcesEvent& event) override;
-
   /**
    * Tell the prefetcher to compute this property
    * @tparam Container
@@ -80,56 +63,17 @@ public:
     }
   }
 
+protected:
   /**
-   * Wait for the multi-threaded computation to finish.
-   * This must be done as the segmentation may be completely finished, and the measurement
-   * queue empty, but some sources may still be here due to some compute-heavy property
-   */
-  void wait();
-
-  /**
-   * Wait until the queue is empty but don't stop the thread
+   * Compute the requested properties. Called from the worker threads.
    */
-
-  void synchronize();
-
+  std::vector<std::unique_ptr<SourceInterface>> process(std::unique_ptr<SourceInterface> source) const override;
 
 private:
-  struct EventType {
-    enum Type {
-      SOURCE, PROCESS_SOURCE
-    } m_event_type;
-    intptr_t m_source_addr;
-
-    explicit EventType(Type type, intptr_t source_addr = -1)
-      : m_event_type(type), m_source_addr(source_addr) {}
-  };
-
-  /// Pointer to the pool of worker threads
-  std::shared_ptr<Euclid::ThreadPool> m_thread_pool;
   /// Properties to prefetch
   std::set<PropertyId> m_prefetch_set;
-  /// Orchestration thread
-  std::unique_ptr<std::thread> m_output_thread;
-  /// Notifies there is a new source done processing
-  std::condition_variable m_new_output;
-  /// Finished sources
-  std::map<intptr_t, std::unique_ptr<SourceInterface>> m_finished_sources;
-  /// Queue of received ProcessSourceEvent, order preserved
-  std::deque<ProcessSourcesEvent> m_event_queue;
-  /// Queue of type of received events. Used to pass downstream events respecting the received order
-  std::deque<EventType> m_received;
-
-  std::mutex m_queue_mutex;
-
-  /// Termination condition for the output loop
-  std::atomic_bool m_stop;
-
-  /// Keep the queue under control
-  Euclid::Semaphore m_semaphore;
 
   void requestProperty(const PropertyId& property_id);
-  void outputLoop();
 };
 
 } // end of namespace SourceXtractor
@@ -26,31 +26,164 @@
 #include "SEFramework/Property/Property.h"
 
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace SourceXtractor {
 
+/**
+ * @struct PixelSpan
+ * @brief Run of consecutive pixels on a single row, from m_x_start (included) to m_x_end (excluded)
+ */
+struct PixelSpan {
+  int m_y, m_x_start, m_x_end;
+
+  PixelSpan(int y, int x_start, int x_end) : m_y(y), m_x_start(x_start), m_x_end(x_end) {}
+
+  int size() const {
+    return m_x_end - m_x_start;
+  }
+};
+
+/**
+ * Append a pixel to a list of spans, extending the last span if the pixel is contiguous to it
+ */
+inline void appendPixel(std::vector<PixelSpan>& spans, const PixelCoordinate& pixel) {
+  if (!spans.empty() && spans.back().m_y == pixel.m_y && spans.back().m_x_end == pixel.m_x) {
+    ++spans.back().m_x_end;
+  }
+  else {
+    spans.emplace_back(pixel.m_y, pixel.m_x, pixel.m_x + 1);
+  }
+}
+
+/**
+ * @class PixelCoordinateList
+ * @brief Pixels belonging to a detected source
+ *
+ * @details
+ *  Pixels are stored as runs over rows (spans), which is how the segmentation finds them.
+ *  Iterating the list visits the individual pixels in the same order they were added.
+ *  getCoordinateList() is kept for consumers that need a contiguous vector of coordinates,
+ *  and is only expanded the first time it is called.
+ */
 class PixelCoordinateList : public Property {
   
 public:
-  
-  explicit PixelCoordinateList(std::vector<PixelCoordinate> coordinate_list)
-      : m_coordinate_list(std::move(coordinate_list)) {
+
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PixelCoordinate;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PixelCoordinate*;
+    using reference = const PixelCoordinate&;
+
+    const_iterator() = default;
+
+    const_iterator(std::vector<PixelSpan>::const_iterator span, std::vector<PixelSpan>::const_iterator span_end)
+      : m_span(span), m_span_end(span_end) {
+      if (m_span != m_span_end) {
+        m_current = PixelCoordinate(m_span->m_x_start, m_span->m_y);
+      }
+    }
+
+    reference operator*() const {
+      return m_current;
+    }
+
+    pointer operator->() const {
+      return &m_current;
+    }
+
+    const_iterator& operator++() {
+      if (++m_current.m_x >= m_span->m_x_end) {
+        if (++m_span != m_span_end) {
+          m_current = PixelCoordinate(m_span->m_x_start, m_span->m_y);
+        }
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      auto copy = *this;
+      ++(*this);
+      return copy;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return m_span == other.m_span && (m_span == m_span_end || m_current.m_x == other.m_current.m_x);
+    }
+
+    bool operator!=(const const_iterator& other) const {
+      return !(*this == other);
+    }
+
+  private:
+    std::vector<PixelSpan>::const_iterator m_span, m_span_end;
+    PixelCoordinate m_current;
+  };
+
+  explicit PixelCoordinateList(const std::vector<PixelCoordinate>& coordinate_list)
+      : m_size(coordinate_list.size()), m_expanded(std::make_shared<Expanded>()) {
+    for (auto& pixel : coordinate_list) {
+      appendPixel(m_spans, pixel);
+    }
+  }
+
+  explicit PixelCoordinateList(std::vector<PixelSpan> spans)
+      : m_spans(std::move(spans)), m_size(0), m_expanded(std::make_shared<Expanded>()) {
+    for (auto& span : m_spans) {
+      m_size += span.size();
+    }
   }
 
   virtual ~PixelCoordinateList() = default;
-  
+
+  const std::vector<PixelSpan>& getSpans() const {
+    return m_spans;
+  }
+
+  /// Number of pixels
+  size_t size() const {
+    return m_size;
+  }
+
+  const_iterator begin() const {
+    return const_iterator(m_spans.begin(), m_spans.end());
+  }
+
+  const_iterator end() const {
+    return const_iterator(m_spans.end(), m_spans.end());
+  }
+
   const std::vector<PixelCoordinate>& getCoordinateList() const {
-    return m_coordinate_list;
+    std::call_once(m_expanded->m_flag, [this]() {
+      m_expanded->m_coordinates.reserve(m_size);
+      m_expanded->m_coordinates.assign(begin(), end());
+    });
+    return m_expanded->m_coordinates;
   }
 
   bool contains(const PixelCoordinate& coord) const {
-    return std::find(m_coordinate_list.begin(), m_coordinate_list.end(), coord) != m_coordinate_list.end();
+    return std::any_of(m_spans.begin(), m_spans.end(), [&coord](const PixelSpan& span) {
+      return span.m_y == coord.m_y && coord.m_x >= span.m_x_start && coord.m_x < span.m_x_end;
+    });
   }
   
 private:
 
-  std::vector<PixelCoordinate> m_coordinate_list;
+  struct Expanded {
+    std::once_flag m_flag;
+    std::vector<PixelCoordinate> m_coordinates;
+  };
+
+  std::vector<PixelSpan> m_spans;
+  size_t m_size;
+  // Shared between copies, as the spans can not change
+  std::shared_ptr<Expanded> m_expanded;
   
 }; /* End of PixelCoordinateList class */
 
@@ -29,18 +29,29 @@
 
 namespace SourceXtractor {
 
+/**
+ * @class SourceId
+ * @brief Identifies a source, and the detection it comes from
+ *
+ * @details
+ *  Detection ids are only allocated by the segmentation, so they follow the detection order.
+ *  A source that has not been split keeps its detection id as source id. The sources split from
+ *  a detection are numbered after it, so their ids do not depend on other detections being
+ *  partitioned concurrently. Therefore, a source is identified by both ids, not by its source id alone.
+ */
 class SourceId : public Property {
 
 public:
 
-  explicit SourceId(unsigned int detection_id)
-      : m_source_id(getNewId()), m_detection_id(detection_id) {
-  }
-
+  /// Allocates a new detection id
   SourceId()
       : m_source_id(getNewId()), m_detection_id(m_source_id) {
   }
 
+  SourceId(unsigned int source_id, unsigned int detection_id)
+      : m_source_id(source_id), m_detection_id(detection_id) {
+  }
+
   virtual ~SourceId() = default;
 
   unsigned int getSourceId() const {
@@ -41,15 +41,20 @@ public:
   void labelImage(Segmentation::LabellingListener& listener, std::shared_ptr<const DetectionImageFrame> frame) override;
 
 private:
+  /// Pixels outside the region are considered visited, so sources do not grow beyond it
   class VisitedMap {
   public:
-    VisitedMap(int width, int height) : m_width(width), m_height(height), m_visited(width * height, false) {}
+    explicit VisitedMap(const PixelRectangle& region)
+      : m_offset(region.getTopLeft()), m_width(region.getWidth()), m_height(region.getHeight()),
+        m_visited(m_width * m_height, false) {}
 
     void markVisited(PixelCoordinate pc) {
+      pc -= m_offset;
       m_visited[pc.m_x + pc.m_y * m_width] = true;
     }
 
     bool wasVisited(PixelCoordinate pc) const {
+      pc -= m_offset;
       if (pc.m_x >= 0 && pc.m_x < m_width && pc.m_y >= 0 && pc.m_y < m_height) {
         return m_visited[pc.m_x + pc.m_y * m_width];
       } else {
@@ -58,6 +63,7 @@ private:
     }
 
   private:
+    PixelCoordinate m_offset;
     int m_width, m_height;
     std::vector<bool> m_visited;
   };
@@ -36,8 +36,13 @@ namespace SourceXtractor {
 class BackgroundConvolution : public DetectionImageFrame::ImageFilter {
 
 public:
-  BackgroundConvolution(std::shared_ptr<Image<SeFloat>> convolution_filter, bool must_normalize)
-    : m_convolution_filter(VectorImage<SeFloat>::create(*convolution_filter)) {
+  /**
+   * @param prefetch_threads
+   *    Threads used to filter tiles ahead of the segmentation, when the DFT is used. 0 disables the prefetching.
+   */
+  BackgroundConvolution(std::shared_ptr<Image<SeFloat>> convolution_filter, bool must_normalize,
+                        unsigned prefetch_threads = 0)
+    : m_convolution_filter(VectorImage<SeFloat>::create(*convolution_filter)), m_prefetch_threads(prefetch_threads) {
     if (must_normalize) {
       normalize();
     }
@@ -45,12 +50,17 @@ public:
 
   std::shared_ptr<DetectionImage>
   processImage(std::shared_ptr<DetectionImage> image, std::shared_ptr<DetectionImage> variance,
-               SeFloat threshold) const;
+               SeFloat threshold) const override;
+
+  std::pair<std::shared_ptr<DetectionImage>, std::shared_ptr<DetectionImage>>
+  processImageAndVariance(std::shared_ptr<DetectionImage> image, std::shared_ptr<DetectionImage> variance,
+                          SeFloat threshold) const override;
 
 private:
   void normalize();
 
   std::shared_ptr<VectorImage<SeFloat>> m_convolution_filter;
+  unsigned m_prefetch_threads;
 };
 
 }
@@ -25,10 +25,9 @@
 #ifndef _SEIMPLEMENTATION_SEGMENTATION_BGDFTCONVOLUTIONIMAGESOURCE_H_
 #define _SEIMPLEMENTATION_SEGMENTATION_BGDFTCONVOLUTIONIMAGESOURCE_H_
 
-#include "SEFramework/Convolution/DFT.h"
-#include "SEFramework/Image/PaddedImage.h"
 #include "SEFramework/Image/VectorImage.h"
 #include "SEFramework/Image/ProcessingImageSource.h"
+#include "SEImplementation/Segmentation/MaskedDFTFilter.h"
 
 namespace SourceXtractor {
 /**
@@ -41,13 +40,13 @@ public:
                               std::shared_ptr<DetectionImage> variance, SeFloat threshold,
                               std::shared_ptr<VectorImage<SeFloat>> kernel);
 
-protected:
-
-  // Constant padded
-  using PaddedType = PaddedImage<DetectionImage::PixelType>;
+  /**
+   * Expose one of the outputs of a filter shared with other image sources
+   * (i.e. the filtered image and the filtered variance)
+   */
+  BgDFTConvolutionImageSource(std::shared_ptr<MaskedDFTFilter> filter, MaskedDFTFilter::Output output);
 
-  // Discrete Fourier Transform convolution, which is faster for big kernels
-  using ConvolutionType = DFTConvolution<DetectionImage::PixelType, PaddedType>;
+protected:
 
   std::string getRepr() const override;
 
@@ -56,9 +55,8 @@ protected:
                     int start_x, int start_y, int width, int height) const override;
 
 private:
-  std::shared_ptr<DetectionImage> m_variance;
-  DetectionImage::PixelType m_threshold;
-  ConvolutionType m_convolution;
+  std::shared_ptr<MaskedDFTFilter> m_filter;
+  MaskedDFTFilter::Output m_output;
 };
 
 } // end namespace SourceXtractor
@@ -31,6 +31,7 @@
 #include "SEFramework/Source/SourceWithOnDemandProperties.h"
 #include "SEFramework/Pipeline/Segmentation.h"
 #include "SEFramework/Image/Image.h"
+#include "SEImplementation/Property/PixelCoordinateList.h"
 
 namespace SourceXtractor {
 
@@ -41,12 +42,34 @@ public:
 
     int start;
     int end;
-    std::vector<PixelCoordinate> pixel_list;
+    std::vector<PixelSpan> pixel_spans;
+    size_t pixel_count;
 
-    PixelGroup() : start(-1), end(-1) {}
+    PixelGroup() : start(-1), end(-1), pixel_count(0) {}
+
+    void addPixel(const PixelCoordinate& pixel) {
+      appendPixel(pixel_spans, pixel);
+      ++pixel_count;
+    }
 
     void merge_pixel_list(PixelGroup& other) {
-      pixel_list.insert(pixel_list.end(), other.pixel_list.begin(), other.pixel_list.end());
+      if (pixel_spans.empty()) {
+        pixel_spans = std::move(other.pixel_spans);
+      } else {
+        pixel_spans.insert(pixel_spans.end(), other.pixel_spans.begin(), other.pixel_spans.end());
+      }
+      pixel_count += other.pixel_count;
+      other.pixel_spans.clear();
+      other.pixel_count = 0;
+    }
+
+    size_t size() const {
+      return pixel_count;
+    }
+
+    /// First pixel of the group
+    PixelCoordinate front() const {
+      return PixelCoordinate(pixel_spans.front().m_x_start, pixel_spans.front().m_y);
     }
   };
 
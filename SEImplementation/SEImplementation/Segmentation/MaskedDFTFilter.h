@@ -0,0 +1,147 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MaskedDFTFilter.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEIMPLEMENTATION_SEGMENTATION_MASKEDDFTFILTER_H_
+#define _SEIMPLEMENTATION_SEGMENTATION_MASKEDDFTFILTER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <boost/thread/shared_mutex.hpp>
+
+#include "SEFramework/Image/ImageTile.h"
+#include "SEFramework/Image/VectorImage.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class MaskedDFTFilter
+ * @brief Filters the detection image, and optionally its variance, using the Discrete Fourier Transform
+ *
+ * @details
+ *  Pixels with a variance above the threshold are masked out. The masked image is convolved with the kernel,
+ *  and divided by the convolution of the mask, so the result is normalized by the kernel weights actually used.
+ *  The variance map, when requested, is filtered the same way.
+ *
+ *  The masked image and the mask (or the masked image and the masked variance, plus the mask on a real transform)
+ *  are packed into a single complex transform, so a tile costs one forward and one inverse transform instead
+ *  of one pair per convolved plane. The kernel transform is computed once per padded tile geometry.
+ *
+ *  When the variance is filtered too, both outputs for a tile are computed at once, and kept until the other
+ *  one is requested. If prefetch threads are enabled, requesting a tile schedules the filtering of the tile
+ *  right below, so the next tile row is ready by the time the segmentation reaches it.
+ */
+class MaskedDFTFilter {
+public:
+
+  enum class Output {
+    IMAGE = 0, VARIANCE = 1
+  };
+
+  /**
+   * Constructor
+   * @param image
+   *    Image to filter
+   * @param variance
+   *    Variance map, used for the mask
+   * @param threshold
+   *    Pixels with a variance greater or equal are masked out
+   * @param kernel
+   *    Convolution kernel
+   * @param filter_variance
+   *    If true, the variance map is filtered too
+   * @param prefetch_threads
+   *    Number of threads filtering tiles ahead of the requests. 0 disables the prefetching.
+   */
+  MaskedDFTFilter(std::shared_ptr<Image<SeFloat>> image, std::shared_ptr<Image<SeFloat>> variance,
+                  SeFloat threshold, std::shared_ptr<VectorImage<SeFloat>> kernel,
+                  bool filter_variance = false, unsigned prefetch_threads = 0);
+
+  virtual ~MaskedDFTFilter();
+
+  /**
+   * Fill the tile with the requested output
+   */
+  void generateTile(Output output, ImageTileWithType<SeFloat>& tile, int x, int y, int width, int height);
+
+  const std::shared_ptr<Image<SeFloat>>& getImage() const {
+    return m_image;
+  }
+
+  const std::shared_ptr<Image<SeFloat>>& getVariance() const {
+    return m_variance;
+  }
+
+private:
+  struct FilteredTile {
+    std::vector<SeFloat> m_outputs[2];
+  };
+
+  using TileKey = std::tuple<int, int, int, int>;
+  using TilePromise = std::promise<std::shared_ptr<const FilteredTile>>;
+  using TileFuture = std::shared_future<std::shared_ptr<const FilteredTile>>;
+
+  struct StashEntry {
+    TileFuture m_future;
+    /// Set while nobody has started the filtering
+    std::shared_ptr<TilePromise> m_pending;
+    bool m_consumed[2];
+  };
+
+  std::shared_ptr<Image<SeFloat>> m_image, m_variance;
+  SeFloat m_threshold;
+  std::shared_ptr<VectorImage<SeFloat>> m_kernel;
+  bool m_filter_variance;
+
+  /// Kernel transforms, by padded width and height
+  mutable boost::shared_mutex m_kernel_mutex;
+  mutable std::map<std::pair<int, int>, std::shared_ptr<const std::vector<SeFloat>>> m_kernel_transforms;
+
+  /// Filtered tiles not consumed yet
+  std::mutex m_stash_mutex;
+  std::map<TileKey, StashEntry> m_stash;
+  std::deque<TileKey> m_stash_order;
+
+  /// Prefetching
+  std::deque<TileKey> m_prefetch_queue;
+  std::condition_variable m_prefetch_cv;
+  bool m_stop;
+  std::vector<std::thread> m_prefetch_threads;
+
+  std::shared_ptr<const std::vector<SeFloat>> getKernelTransform(int padded_width, int padded_height) const;
+  std::shared_ptr<const FilteredTile> filter(const TileKey& key) const;
+  static void run(const MaskedDFTFilter* filter, const TileKey& key, TilePromise& promise);
+  /// Must be called with m_stash_mutex locked
+  void schedulePrefetch(const TileKey& key);
+  void trimStash();
+  void prefetchLoop();
+};
+
+} // end of namespace SourceXtractor
+
+#endif // _SEIMPLEMENTATION_SEGMENTATION_MASKEDDFTFILTER_H_
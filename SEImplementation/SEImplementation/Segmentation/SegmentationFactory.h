@@ -29,6 +29,7 @@
 #include "SEFramework/Pipeline/Segmentation.h"
 
 #include "SEImplementation/Configuration/SegmentationConfig.h"
+#include "SEImplementation/Configuration/ShardConfig.h"
 #include "SEImplementation/Plugin/AssocMode/AssocModeConfig.h"
 
 
@@ -69,6 +70,9 @@ private:
 
   std::vector<std::vector<AssocModeConfig::CatalogEntry>> m_catalogs;
 
+  /// Core region of the shard plus its margin. Empty if not sharded.
+  PixelRectangle m_detection_region;
+
 }; /* End of SegmentationFactory class */
 
 } /* namespace SourceXtractor */
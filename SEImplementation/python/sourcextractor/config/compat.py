@@ -130,3 +130,8 @@ def set_ellipse_scale(ellipse_scale):
     global_measurement_config.model_fitting.set_ellipse_scale(ellipse_scale)
 
 
+@_compat_doc_helper(copy_doc_from=ModelFitting.use_batch_convolution)
+def use_batch_convolution(use):
+    global_measurement_config.model_fitting.use_batch_convolution(use)
+
+
@@ -1061,7 +1061,8 @@ class ModelFitting:
         self.params_dict = {"max_iterations": 200, "modified_chi_squared_scale": 10, "engine": "",
                             "use_iterative_fitting": True, "meta_iterations": 5,
                             "deblend_factor": 0.95, "meta_iteration_stop": 0.0001,
-                            "window_type": WindowType.RECTANGLE, "ellipse_scale": 3.0
+                            "window_type": WindowType.RECTANGLE, "ellipse_scale": 3.0,
+                            "batch_convolution": False
                             }
 
     def _set_model_to_frames(self, group, model):
@@ -1255,6 +1256,19 @@ class ModelFitting:
         """
         self.params_dict["ellipse_scale"] = ellipse_scale
 
+    def use_batch_convolution(self, batch_convolution):
+        """
+        Parameters
+        ----------
+
+        batch_convolution : boolean
+            rasterize all the extended models of a frame into a single image, and convolve it
+            only once with the PSF, instead of convolving each model separately. Only applies to the
+            frames with the same pixel scale as their PSF, and is off by default
+
+        """
+        self.params_dict["batch_convolution"] = batch_convolution
+
 
 def print_model_fitting_info(group, show_params=False, prefix='', file=sys.stderr):
     """
@@ -35,9 +35,15 @@ std::shared_ptr<BackgroundAnalyzer> BackgroundAnalyzerFactory::createBackgroundA
 
 std::shared_ptr<BackgroundAnalyzer> BackgroundAnalyzerFactory::createBackgroundAnalyzer(
     WeightImageConfig::WeightType weight_type) const {
+  return createBackgroundAnalyzer(weight_type, "");
+}
+
+std::shared_ptr<BackgroundAnalyzer> BackgroundAnalyzerFactory::createBackgroundAnalyzer(
+    WeightImageConfig::WeightType weight_type, const std::string& cache_identity) const {
   // make a SE2 background if cell size and smoothing box are given
   if (m_cell_size.size() > 0 && m_smoothing_box.size() > 0) {
-      return std::make_shared<SEBackgroundLevelAnalyzer>(m_cell_size, m_smoothing_box, weight_type);
+      return std::make_shared<SEBackgroundLevelAnalyzer>(m_cell_size, m_smoothing_box, weight_type,
+                                                         m_cache, cache_identity);
   } else {
     // make a simple background
     return std::make_shared<SimpleBackgroundAnalyzer>();
@@ -56,6 +62,10 @@ void BackgroundAnalyzerFactory::initialize(const UserValues&) {
   m_cell_size = se2background_config.getCellSize();
   m_smoothing_box = se2background_config.getSmoothingBox();
   m_weight_type = weight_image_config.getWeightType();
+  if (!se2background_config.getCacheDirectory().empty()) {
+    m_cache = std::make_shared<BackgroundCache>(se2background_config.getCacheDirectory(),
+                                                se2background_config.getCacheChecksum());
+  }
 }
 
 }
@@ -0,0 +1,260 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * BackgroundCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include <ElementsKernel/Exception.h>
+#include <ElementsKernel/Logging.h>
+
+#include "SEImplementation/Background/BackgroundCache.h"
+
+namespace fs = boost::filesystem;
+
+namespace SourceXtractor {
+
+static Elements::Logging logger = Elements::Logging::getLogger("BackgroundCache");
+
+static const char CACHE_MAGIC[] = "SEBKG001";
+static const int CHECKSUM_SAMPLES = 32;
+
+namespace {
+
+/// 64 bits FNV-1a
+class Hasher {
+public:
+  void update(const void* data, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      m_hash ^= bytes[i];
+      m_hash *= 1099511628211ULL;
+    }
+  }
+
+  uint64_t digest() const {
+    return m_hash;
+  }
+
+private:
+  uint64_t m_hash = 14695981039346656037ULL;
+};
+
+void sampleImage(Hasher& hasher, const Image<SeFloat>& image) {
+  int width = image.getWidth(), height = image.getHeight();
+  hasher.update(&width, sizeof(width));
+  hasher.update(&height, sizeof(height));
+  int nrows = std::min(height, CHECKSUM_SAMPLES);
+  int ncols = std::min(width, CHECKSUM_SAMPLES);
+  for (int i = 0; i < nrows; ++i) {
+    int y = (2 * i + 1) * height / (2 * nrows);
+    auto row = image.getChunk(0, y, width, 1);
+    for (int j = 0; j < ncols; ++j) {
+      SeFloat v = row->getValue((2 * j + 1) * width / (2 * ncols), 0);
+      hasher.update(&v, sizeof(v));
+    }
+  }
+}
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void readValue(std::istream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+void writeMesh(std::ostream& out, const VectorImage<SeFloat>& mesh) {
+  int32_t width = mesh.getWidth(), height = mesh.getHeight();
+  writeValue(out, width);
+  writeValue(out, height);
+  out.write(reinterpret_cast<const char*>(mesh.getData().data()), sizeof(SeFloat) * width * height);
+}
+
+std::shared_ptr<VectorImage<SeFloat>> readMesh(std::istream& in) {
+  int32_t width = 0, height = 0;
+  readValue(in, width);
+  readValue(in, height);
+  if (!in || width <= 0 || height <= 0) {
+    throw Elements::Exception() << "Invalid mesh size";
+  }
+  auto mesh = VectorImage<SeFloat>::create(width, height);
+  in.read(reinterpret_cast<char*>(mesh->getData().data()), sizeof(SeFloat) * width * height);
+  return mesh;
+}
+
+} // end of anonymous namespace
+
+BackgroundCache::BackgroundCache(const std::string& directory, bool checksum)
+  : m_directory(directory), m_checksum(checksum) {
+  boost::system::error_code err;
+  fs::create_directories(m_directory, err);
+  if (err) {
+    throw Elements::Exception() << "Can not create the background cache directory " << m_directory
+                                << ": " << err.message();
+  }
+}
+
+std::string BackgroundCache::fileIdentity(const std::string& path) {
+  if (path.empty()) {
+    return path;
+  }
+  // Remove the HDU selector, if any (i.e. image.fits[1])
+  std::string file_path = path, hdu_selector;
+  auto bracket = path.rfind('[');
+  if (bracket != std::string::npos && path.back() == ']') {
+    file_path = path.substr(0, bracket);
+    hdu_selector = path.substr(bracket);
+  }
+
+  boost::system::error_code err;
+  auto absolute = fs::absolute(file_path);
+  auto size = fs::file_size(absolute, err);
+  if (err) {
+    return absolute.string() + hdu_selector;
+  }
+  auto mtime = fs::last_write_time(absolute, err);
+  std::ostringstream identity;
+  identity << absolute.string() << hdu_selector << ':' << size << ':' << mtime;
+  return identity.str();
+}
+
+std::string BackgroundCache::imageIdentity(const std::string& path, int hdu, int layer, double scaling) {
+  if (path.empty()) {
+    return path;
+  }
+  std::ostringstream identity;
+  identity << fileIdentity(path) << '[' << hdu << ',' << layer << "]*" << std::setprecision(17) << scaling;
+  return identity.str();
+}
+
+std::string BackgroundCache::makeKey(const std::string& identity, const Image<SeFloat>& image,
+                                     const std::shared_ptr<Image<SeFloat>>& weight) const {
+  if (!m_checksum) {
+    return identity;
+  }
+  Hasher hasher;
+  sampleImage(hasher, image);
+  if (weight) {
+    sampleImage(hasher, *weight);
+  }
+  std::ostringstream key;
+  key << identity << ";checksum=" << std::hex << std::setw(16) << std::setfill('0') << hasher.digest();
+  return key.str();
+}
+
+std::string BackgroundCache::getEntryPath(const std::string& key) const {
+  Hasher hasher;
+  hasher.update(key.data(), key.size());
+  std::ostringstream name;
+  name << std::hex << std::setw(16) << std::setfill('0') << hasher.digest() << ".bkg";
+  return (fs::path(m_directory) / name.str()).string();
+}
+
+bool BackgroundCache::load(const std::string& key, BackgroundMeshes& meshes) const {
+  auto path = getEntryPath(key);
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+
+  try {
+    char magic[sizeof(CACHE_MAGIC)] = {0};
+    in.read(magic, sizeof(CACHE_MAGIC));
+    if (!in || std::string(magic) != CACHE_MAGIC) {
+      throw Elements::Exception() << "Unknown format";
+    }
+
+    uint32_t key_size = 0;
+    readValue(in, key_size);
+    std::string stored_key(key_size, '\0');
+    in.read(&stored_key[0], key_size);
+    if (!in || stored_key != key) {
+      // Hash collision, or a broken entry
+      return false;
+    }
+
+    BackgroundMeshes loaded;
+    uint8_t use_sigma_map = 0;
+    readValue(in, use_sigma_map);
+    loaded.m_use_sigma_map = use_sigma_map != 0;
+    readValue(in, loaded.m_scaling);
+    readValue(in, loaded.m_median);
+    readValue(in, loaded.m_median_sigma);
+    loaded.m_mode = readMesh(in);
+    loaded.m_sigma = readMesh(in);
+    if (!in) {
+      throw Elements::Exception() << "Truncated file";
+    }
+    meshes = std::move(loaded);
+  }
+  catch (const std::exception& e) {
+    logger.warn() << "Ignoring background cache entry " << path << ": " << e.what();
+    return false;
+  }
+
+  logger.info() << "Background loaded from " << path;
+  return true;
+}
+
+void BackgroundCache::store(const std::string& key, const BackgroundMeshes& meshes) const {
+  auto path = getEntryPath(key);
+  // Write into a unique temporary, and move it into place once complete
+  auto tmp_path = fs::path(path + "." + fs::unique_path().string() + ".tmp");
+
+  {
+    std::ofstream out(tmp_path.string(), std::ios::binary);
+    out.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    writeValue(out, static_cast<uint32_t>(key.size()));
+    out.write(key.data(), key.size());
+    writeValue(out, static_cast<uint8_t>(meshes.m_use_sigma_map));
+    writeValue(out, meshes.m_scaling);
+    writeValue(out, meshes.m_median);
+    writeValue(out, meshes.m_median_sigma);
+    writeMesh(out, *meshes.m_mode);
+    writeMesh(out, *meshes.m_sigma);
+    out.close();
+    if (!out) {
+      boost::system::error_code err;
+      fs::remove(tmp_path, err);
+      logger.warn() << "Failed to write the background cache entry " << path;
+      return;
+    }
+  }
+
+  boost::system::error_code err;
+  fs::rename(tmp_path, path, err);
+  if (err) {
+    fs::remove(tmp_path, err);
+    logger.warn() << "Failed to store the background cache entry " << path << ": " << err.message();
+    return;
+  }
+  logger.debug() << "Background stored into " << path;
+}
+
+} // end of namespace SourceXtractor
@@ -15,6 +15,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <iomanip>
+#include <sstream>
+
 #include "SEImplementation/Background/SE/SEBackgroundLevelAnalyzer.h"
 
 #include "SEFramework/Image/ConstantImage.h"
@@ -31,8 +34,10 @@ namespace SourceXtractor {
 
 SEBackgroundLevelAnalyzer::SEBackgroundLevelAnalyzer(const std::vector<int>& cell_size,
                                                      const std::vector<int>& smoothing_box,
-                                                     const WeightImageConfig::WeightType weight_type)
-  : m_weight_type(weight_type) {
+                                                     const WeightImageConfig::WeightType weight_type,
+                                                     std::shared_ptr<BackgroundCache> cache,
+                                                     const std::string& cache_identity)
+  : m_weight_type(weight_type), m_cache(std::move(cache)), m_cache_identity(cache_identity) {
   assert(cell_size.size() > 0 && cell_size.size() < 3);
   assert(smoothing_box.size() > 0 && smoothing_box.size() < 3);
   m_cell_size[0] = cell_size.front();
@@ -76,10 +81,78 @@ static float getMedian(const VectorImage<DetectionImage::PixelType>& img) {
   return (v[nitems / 2] + v[nitems / 2 - 1]) / 2;
 }
 
+std::string SEBackgroundLevelAnalyzer::getCacheKey(const DetectionImage& image,
+                                                   const std::shared_ptr<WeightImage>& variance_map,
+                                                   const std::shared_ptr<Image<unsigned char>>& mask,
+                                                   WeightImage::PixelType variance_threshold) const {
+  if (!m_cache || m_cache_identity.empty()) {
+    return "";
+  }
+  // An arbitrary mask can not be identified, so only an empty one is supported
+  if (mask) {
+    auto constant_mask = std::dynamic_pointer_cast<ConstantImage<unsigned char>>(mask);
+    if (!constant_mask || constant_mask->getConstantValue() != 0) {
+      return "";
+    }
+  }
+
+  std::ostringstream identity;
+  identity << m_cache_identity << ";size=" << image.getWidth() << "x" << image.getHeight()
+           << ";cell=" << m_cell_size[0] << "x" << m_cell_size[1]
+           << ";smooth=" << m_smoothing_box[0] << "x" << m_smoothing_box[1]
+           << ";weight_type=" << static_cast<int>(m_weight_type)
+           << ";variance=" << (variance_map != nullptr)
+           << ";threshold=" << std::setprecision(9) << variance_threshold;
+  return m_cache->makeKey(identity.str(), image, variance_map);
+}
+
 BackgroundModel SEBackgroundLevelAnalyzer::analyzeBackground(
   std::shared_ptr<DetectionImage> image, std::shared_ptr<WeightImage> variance_map,
   std::shared_ptr<Image<unsigned char>> mask, WeightImage::PixelType variance_threshold) const {
 
+  BackgroundMeshes meshes;
+  auto cache_key = getCacheKey(*image, variance_map, mask, variance_threshold);
+  if (cache_key.empty() || !m_cache->load(cache_key, meshes)) {
+    meshes = computeMeshes(image, variance_map, mask, variance_threshold);
+    if (!cache_key.empty()) {
+      m_cache->store(cache_key, meshes);
+    }
+  }
+
+  std::shared_ptr<Image<DetectionImage::PixelType>> final_bg, final_var;
+
+  if (meshes.m_use_sigma_map) {
+    // Transform RMS to variance
+    final_var = MultiplyImage<DetectionImage::PixelType>::create(meshes.m_sigma, meshes.m_sigma);
+    final_var = BufferedImage<DetectionImage::PixelType>::create(
+      std::make_shared<ScaledImageSource<DetectionImage::PixelType>>(
+        final_var, image->getWidth(), image->getHeight(),
+        ScaledImageSource<DetectionImage::PixelType>::InterpolationType::BICUBIC
+      )
+    );
+  }
+  else {
+    final_var = ConstantImage<DetectionImage::PixelType>::create(image->getWidth(), image->getHeight(),
+                                                                 meshes.m_median_sigma * meshes.m_median_sigma);
+  }
+
+  bck_model_logger.info() << "Background for image: " << image->getRepr() << " median: " << meshes.m_median
+                          << " rms: " << meshes.m_median_sigma << "!";
+
+  final_bg = BufferedImage<DetectionImage::PixelType>::create(
+    std::make_shared<ScaledImageSource<DetectionImage::PixelType>>(
+      meshes.m_mode, image->getWidth(), image->getHeight(),
+      ScaledImageSource<DetectionImage::PixelType>::InterpolationType::BICUBIC
+    )
+  );
+
+  return BackgroundModel(final_bg, final_var, meshes.m_scaling, meshes.m_median_sigma);
+}
+
+BackgroundMeshes SEBackgroundLevelAnalyzer::computeMeshes(
+  std::shared_ptr<DetectionImage> image, std::shared_ptr<WeightImage> variance_map,
+  std::shared_ptr<Image<unsigned char>> mask, WeightImage::PixelType variance_threshold) const {
+
   const auto mask_value = std::numeric_limits<DetectionImage::PixelType>::lowest();
 
   if (mask != nullptr) {
@@ -130,8 +203,6 @@ BackgroundModel SEBackgroundLevelAnalyzer::analyzeBackground(
 
   SeFloat scaling = 99999;
 
-  std::shared_ptr<Image<DetectionImage::PixelType>> final_bg, final_var;
-
   if (variance_map) {
     // Create histogram model for the variance image
     auto weight = histo.getVarianceModeImage();
@@ -142,31 +213,9 @@ BackgroundModel SEBackgroundLevelAnalyzer::analyzeBackground(
     std::tie(weight, weight_var) = MedianFilter<WeightImage::PixelType>(m_smoothing_box)(*weight, *weight_var);
     // Compute scaling
     scaling = computeScaling(var, weight);
-    // Transform RMS to variance
-    final_var = MultiplyImage<DetectionImage::PixelType>::create(var, var);
-    final_var = BufferedImage<DetectionImage::PixelType>::create(
-      std::make_shared<ScaledImageSource<DetectionImage::PixelType>>(
-        final_var, image->getWidth(), image->getHeight(),
-        ScaledImageSource<DetectionImage::PixelType>::InterpolationType::BICUBIC
-      )
-    );
   }
-  else {
-    final_var = ConstantImage<DetectionImage::PixelType>::create(image->getWidth(), image->getHeight(),
-                                                                 median_sigma * median_sigma);
-  }
-
-  bck_model_logger.info() << "Background for image: " << image->getRepr() << " median: " << median
-                          << " rms: " << median_sigma << "!";
-
-  final_bg = BufferedImage<DetectionImage::PixelType>::create(
-    std::make_shared<ScaledImageSource<DetectionImage::PixelType>>(
-      mode, image->getWidth(), image->getHeight(),
-      ScaledImageSource<DetectionImage::PixelType>::InterpolationType::BICUBIC
-    )
-  );
 
-  return BackgroundModel(final_bg, final_var, scaling, median_sigma);
+  return BackgroundMeshes{mode, var, variance_map != nullptr, scaling, median, median_sigma};
 }
 
 } // end of namespace SourceXtractor
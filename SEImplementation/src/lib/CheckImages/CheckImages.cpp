@@ -172,9 +172,7 @@ void CheckImages::configure(Euclid::Configuration::ConfigManager& manager) {
   }
 }
 
-std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementAutoApertureImage(unsigned int frame_number) {
-  std::lock_guard<std::mutex> lock{m_access_mutex};
-
+std::shared_ptr<WriteableImage<int>> CheckImages::getOrCreateMeasurementAutoApertureImage(unsigned int frame_number) {
   if (m_auto_aperture_filename.empty()) {
     return nullptr;
   }
@@ -196,12 +194,10 @@ std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementAutoApertureImag
           frame_info.m_coordinate_system
         ))).first;
   }
-  return LockedWriteableImage<int>::create(i->second);
+  return i->second;
 }
 
-std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementApertureImage(unsigned int frame_number) {
-  std::lock_guard<std::mutex> lock{m_access_mutex};
-
+std::shared_ptr<WriteableImage<int>> CheckImages::getOrCreateMeasurementApertureImage(unsigned int frame_number) {
   if (m_aperture_filename.empty()) {
     return nullptr;
   }
@@ -223,13 +219,11 @@ std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementApertureImage(un
           frame_info.m_coordinate_system
         ))).first;
   }
-  return LockedWriteableImage<int>::create(i->second);
+  return i->second;
 }
 
 std::shared_ptr<WriteableImage<MeasurementImage::PixelType>>
-CheckImages::getModelFittingImage(unsigned int frame_number) {
-  std::lock_guard<std::mutex> lock{m_access_mutex};
-
+CheckImages::getOrCreateModelFittingImage(unsigned int frame_number) {
   if (m_model_fitting_image_filename.empty() && m_residual_filename.empty()) {
     return nullptr;
   }
@@ -258,13 +252,10 @@ CheckImages::getModelFittingImage(unsigned int frame_number) {
     }
     i = m_check_image_model_fitting.emplace(std::make_pair(frame_number, writeable_image)).first;
   }
-  return LockedWriteableImage<MeasurementImage::PixelType>::create(i->second);
+  return i->second;
 }
 
-std::shared_ptr<WriteableImage<int>>
-CheckImages::getFittingWindowImage(unsigned int frame_number) {
-  std::lock_guard<std::mutex> lock{m_access_mutex};
-
+std::shared_ptr<WriteableImage<int>> CheckImages::getOrCreateFittingWindowImage(unsigned int frame_number) {
   if (m_fitting_window_image_filename.empty()) {
     return nullptr;
   }
@@ -284,9 +275,61 @@ CheckImages::getFittingWindowImage(unsigned int frame_number) {
     );
     i = m_check_image_fitting_window.emplace(std::make_pair(frame_number, writeable_image)).first;
   }
-  return LockedWriteableImage<int>::create(i->second);
+  return i->second;
+}
+
+std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementAutoApertureImage(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  auto image = getOrCreateMeasurementAutoApertureImage(frame_number);
+  return image ? LockedWriteableImage<int>::create(image) : nullptr;
+}
+
+std::shared_ptr<WriteableImage<int>> CheckImages::getMeasurementApertureImage(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  auto image = getOrCreateMeasurementApertureImage(frame_number);
+  return image ? LockedWriteableImage<int>::create(image) : nullptr;
 }
 
+std::shared_ptr<WriteableImage<MeasurementImage::PixelType>>
+CheckImages::getModelFittingImage(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  auto image = getOrCreateModelFittingImage(frame_number);
+  return image ? LockedWriteableImage<MeasurementImage::PixelType>::create(image) : nullptr;
+}
+
+std::shared_ptr<WriteableImage<int>> CheckImages::getFittingWindowImage(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  auto image = getOrCreateFittingWindowImage(frame_number);
+  return image ? LockedWriteableImage<int>::create(image) : nullptr;
+}
+
+std::shared_ptr<CheckImageAccumulator<int>>
+CheckImages::getMeasurementAutoApertureAccumulator(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  return getOrCreateAccumulator(m_measurement_auto_aperture_accumulators, frame_number,
+                                getOrCreateMeasurementAutoApertureImage(frame_number));
+}
+
+std::shared_ptr<CheckImageAccumulator<int>>
+CheckImages::getMeasurementApertureAccumulator(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  return getOrCreateAccumulator(m_measurement_aperture_accumulators, frame_number,
+                                getOrCreateMeasurementApertureImage(frame_number));
+}
+
+std::shared_ptr<CheckImageAccumulator<MeasurementImage::PixelType>>
+CheckImages::getModelFittingAccumulator(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  return getOrCreateAccumulator(m_model_fitting_accumulators, frame_number,
+                                getOrCreateModelFittingImage(frame_number));
+}
+
+std::shared_ptr<CheckImageAccumulator<int>>
+CheckImages::getFittingWindowAccumulator(unsigned int frame_number) {
+  std::lock_guard<std::mutex> lock{m_access_mutex};
+  return getOrCreateAccumulator(m_fitting_window_accumulators, frame_number,
+                                getOrCreateFittingWindowImage(frame_number));
+}
 
 std::shared_ptr<WriteableImage<MeasurementImage::PixelType>> CheckImages::getPsfImage(unsigned int frame_number) {
   std::lock_guard<std::mutex> lock{m_access_mutex};
@@ -345,6 +388,12 @@ std::shared_ptr<WriteableImage<MeasurementImage::PixelType>>
 void CheckImages::saveImages() {
   std::lock_guard<std::mutex> lock(m_access_mutex);
 
+  // Wait for the pending stamps, and stop the compositors
+  m_measurement_auto_aperture_accumulators.clear();
+  m_measurement_aperture_accumulators.clear();
+  m_model_fitting_accumulators.clear();
+  m_fitting_window_accumulators.clear();
+
   auto detection_images_nb = m_coordinate_systems.size();
   for (size_t i = 0; i < detection_images_nb; i++) {
     // if possible, save the background image
@@ -40,7 +40,7 @@ void DetectionIdCheckImage::handleMessage(const SourceInterface& source) {
     const auto& source_id = source.getProperty<SourceId>().getDetectionId();
 
     // iterate over the pixels and set the detection_id value
-    for (auto& coord : coordinates.getCoordinateList()) {
+    for (auto& coord : coordinates) {
       check_image->setValue(coord.m_x, coord.m_y, source_id);
     }
   }
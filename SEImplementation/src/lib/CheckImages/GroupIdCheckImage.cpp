@@ -43,7 +43,7 @@ void GroupIdCheckImage::handleMessage(const SourceGroupInterface& group) {
       auto& coordinates = source.getProperty<PixelCoordinateList>();
 
       // iterate over the pixels and set the group_id value
-      for (auto& coord : coordinates.getCoordinateList()) {
+      for (auto& coord : coordinates) {
         check_image->setValue(coord.m_x, coord.m_y, group_id);
       }
     }
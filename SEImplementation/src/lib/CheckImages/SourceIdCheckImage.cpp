@@ -41,7 +41,7 @@ void SourceIdCheckImage::handleMessage(const SourceGroupInterface& group) {
       const auto& source_id = source.getProperty<SourceID>().getId();
 
       // iterate over the pixels and set the source-id value
-      for (auto& coord : coordinates.getCoordinateList()) {
+      for (auto& coord : coordinates) {
         check_image->setValue(coord.m_x, coord.m_y, source_id);
       }
     }
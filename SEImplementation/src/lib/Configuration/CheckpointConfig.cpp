@@ -0,0 +1,133 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointConfig.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <typeindex>
+#include <boost/filesystem.hpp>
+#include "SEImplementation/Configuration/CheckpointConfig.h"
+
+using namespace Euclid::Configuration;
+namespace po = boost::program_options;
+
+namespace SourceXtractor {
+
+static const std::string CHECKPOINT_DIR {"checkpoint-dir"};
+static const std::string CHECKPOINT_INTERVAL {"checkpoint-interval"};
+
+/// Options that do not change the results, so they can differ between the interrupted run and the resumed one
+static const std::vector<std::string> IGNORED_PREFIXES {
+  "checkpoint-", "thread-", "tile-", "progress-", "profile-", "log-", "fft-", "segmentation-filter-threads"
+};
+
+template <typename T>
+static void writeValue(std::ostream& out, const boost::any& value) {
+  out << boost::any_cast<T>(value);
+}
+
+template <typename T>
+static void writeValueMultiple(std::ostream& out, const boost::any& value) {
+  for (const auto& v : boost::any_cast<std::vector<T>>(value)) {
+    out << v << ',';
+  }
+}
+
+static std::string hashConfiguration(const Euclid::Configuration::Configuration::UserValues& args) {
+  typedef std::function<void(std::ostream&, const boost::any&)> WriterFunction;
+  static std::map<std::type_index, WriterFunction> writers{
+    {typeid(bool), &writeValue<bool>},
+    {typeid(int), &writeValue<int>},
+    {typeid(unsigned), &writeValue<unsigned>},
+    {typeid(long), &writeValue<long>},
+    {typeid(double), &writeValue<double>},
+    {typeid(std::string), &writeValue<std::string>},
+    {typeid(std::vector<std::string>), &writeValueMultiple<std::string>},
+    {typeid(std::vector<int>), &writeValueMultiple<int>},
+    {typeid(std::vector<double>), &writeValueMultiple<double>}
+  };
+
+  std::ostringstream serialized;
+  serialized << std::setprecision(17);
+  for (const auto& arg : args) {
+    auto ignored = std::any_of(IGNORED_PREFIXES.begin(), IGNORED_PREFIXES.end(), [&arg](const std::string& prefix) {
+      return arg.first.compare(0, prefix.size(), prefix) == 0;
+    });
+    if (ignored || arg.second.empty()) {
+      continue;
+    }
+    serialized << arg.first << '=';
+    auto writer = writers.find(arg.second.value().type());
+    if (writer != writers.end()) {
+      writer->second(serialized, arg.second.value());
+    }
+    else {
+      serialized << '<' << arg.second.value().type().name() << '>';
+    }
+    serialized << '\n';
+  }
+
+  // 64 bits FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : serialized.str()) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  std::ostringstream hex;
+  hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return hex.str();
+}
+
+CheckpointConfig::CheckpointConfig(long manager_id) : Configuration(manager_id), m_interval(600) {
+}
+
+auto CheckpointConfig::getProgramOptions() -> std::map<std::string, OptionDescriptionList> {
+  return { {"Checkpoint", {
+      {CHECKPOINT_DIR.c_str(), po::value<std::string>()->default_value(""),
+          "Directory where the measured groups are saved. A run restarted with the same directory "
+          "and configuration skips the groups already saved"},
+      {CHECKPOINT_INTERVAL.c_str(), po::value<double>()->default_value(600),
+          "Minimum number of seconds between checkpoints. A checkpoint is always done at the end of each frame"},
+  }}};
+}
+
+void CheckpointConfig::initialize(const UserValues& args) {
+  m_directory = args.at(CHECKPOINT_DIR).as<std::string>();
+  m_interval = args.at(CHECKPOINT_INTERVAL).as<double>();
+  m_configuration_hash = hashConfiguration(args);
+
+  if (m_interval < 0) {
+    throw Elements::Exception() << "Invalid " << CHECKPOINT_INTERVAL << " value: " << m_interval;
+  }
+  if (m_directory.empty()) {
+    return;
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(m_directory, ec);
+  if (ec) {
+    throw Elements::Exception() << "Can not create the checkpoint directory " << m_directory << ": " << ec.message();
+  }
+}
+
+} // end of namespace SourceXtractor
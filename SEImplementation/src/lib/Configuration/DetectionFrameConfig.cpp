@@ -25,6 +25,7 @@
 #include "SEFramework/Image/ProcessedImage.h"
 
 #include "SEImplementation/Background/BackgroundAnalyzerFactory.h"
+#include "SEImplementation/Background/BackgroundCache.h"
 #include "SEImplementation/Configuration/BackgroundConfig.h"
 #include "SEImplementation/Configuration/DetectionImageConfig.h"
 #include "SEImplementation/Configuration/WeightImageConfig.h"
@@ -45,6 +46,18 @@ DetectionFrameConfig::DetectionFrameConfig(long manager_id) : Configuration(mana
   declareDependency<BackgroundAnalyzerFactory>();
 }
 
+std::string DetectionFrameConfig::getBackgroundIdentity(const DetectionImageConfig& detection_image_config,
+                                                        const WeightImageConfig& weight_image_config, size_t index) {
+  auto flux_scale = detection_image_config.getOriginalFluxScale(index);
+  // An absolute weight is scaled with the flux
+  double weight_scaling = weight_image_config.getWeightScaling();
+  if (weight_image_config.isWeightAbsolute()) {
+    weight_scaling *= flux_scale * flux_scale;
+  }
+  return BackgroundCache::imageIdentity(detection_image_config.getDetectionImagePath(), index, 0, flux_scale) + ";" +
+         BackgroundCache::imageIdentity(weight_image_config.getWeightImagePath(), index, 0, weight_scaling);
+}
+
 void DetectionFrameConfig::initialize(const UserValues& ) {
 
   for (size_t i=0; i<getDependency<DetectionImageConfig>().getExtensionsNb(); i++) {
@@ -64,7 +77,9 @@ void DetectionFrameConfig::initialize(const UserValues& ) {
         detection_image_saturation, interpolation_gap);
     detection_frame->setLabel(boost::filesystem::path(detection_image_path).stem().string());
 
-    auto background_analyzer = getDependency<BackgroundAnalyzerFactory>().createBackgroundAnalyzer();
+    auto background_analyzer = getDependency<BackgroundAnalyzerFactory>().createBackgroundAnalyzer(
+        getDependency<WeightImageConfig>().getWeightType(),
+        getBackgroundIdentity(getDependency<DetectionImageConfig>(), getDependency<WeightImageConfig>(), i));
     auto background_model = background_analyzer->analyzeBackground(detection_frame->getOriginalImage(), weight_image,
         ConstantImage<unsigned char>::create(detection_image->getWidth(), detection_image->getHeight(), false), detection_frame->getVarianceThreshold());
 
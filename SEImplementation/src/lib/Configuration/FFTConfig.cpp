@@ -0,0 +1,83 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * FFTConfig.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <map>
+#include <boost/filesystem/operations.hpp>
+
+#include <ElementsKernel/Logging.h>
+
+#include "SEFramework/FFT/FFT.h"
+#include "SEImplementation/Configuration/FFTConfig.h"
+
+using namespace Euclid::Configuration;
+namespace po = boost::program_options;
+
+namespace SourceXtractor {
+
+static const std::string FFT_PLANNER {"fft-planner"};
+static const std::string FFT_WISDOM_FILE {"fft-wisdom-file"};
+
+static Elements::Logging logger = Elements::Logging::getLogger("FFTConfig");
+
+FFTConfig::FFTConfig(long manager_id) : Configuration(manager_id) {}
+
+auto FFTConfig::getProgramOptions() -> std::map<std::string, OptionDescriptionList> {
+  return { {"FFT", {
+      {FFT_PLANNER.c_str(), po::value<std::string>()->default_value("ESTIMATE"),
+          "FFTW planner rigor: ESTIMATE, MEASURE, PATIENT or EXHAUSTIVE. Slower planning gives faster transforms"},
+      {FFT_WISDOM_FILE.c_str(), po::value<std::string>()->default_value(""),
+          "Load the FFTW wisdom from this file if it exists, and save it at the end of the run"},
+  }}};
+}
+
+void FFTConfig::initialize(const UserValues& args) {
+  static const std::map<std::string, unsigned> planners{
+    {"ESTIMATE", FFTW_ESTIMATE}, {"MEASURE", FFTW_MEASURE},
+    {"PATIENT", FFTW_PATIENT}, {"EXHAUSTIVE", FFTW_EXHAUSTIVE}
+  };
+
+  auto planner_name = args.at(FFT_PLANNER).as<std::string>();
+  auto planner = planners.find(planner_name);
+  if (planner == planners.end()) {
+    throw Elements::Exception() << "Invalid " << FFT_PLANNER << " value: " << planner_name;
+  }
+  fftSetPlannerFlags(planner->second);
+
+  m_wisdom_file = args.at(FFT_WISDOM_FILE).as<std::string>();
+  if (!m_wisdom_file.empty() && boost::filesystem::exists(m_wisdom_file)) {
+    if (fftImportWisdom(m_wisdom_file)) {
+      logger.info() << "FFTW wisdom loaded from " << m_wisdom_file;
+    }
+    else {
+      logger.warn() << "Could not load the FFTW wisdom from " << m_wisdom_file;
+    }
+  }
+}
+
+void FFTConfig::saveWisdom() const {
+  if (!m_wisdom_file.empty()) {
+    fftExportWisdom(m_wisdom_file);
+    logger.info() << "FFTW wisdom saved into " << m_wisdom_file;
+  }
+}
+
+} // SourceXtractor namespace
@@ -49,7 +49,8 @@ void MeasurementFrameConfig::initialize(const UserValues&) {
         image_info.m_saturation_level,
         false);
 
-    auto background_analyzer = background_analyzer_factory.createBackgroundAnalyzer(image_info.m_weight_type);
+    auto background_analyzer = background_analyzer_factory.createBackgroundAnalyzer(
+        image_info.m_weight_type, image_info.m_background_identity);
     auto background_model = background_analyzer->analyzeBackground(
         image_info.m_measurement_image,
         image_info.m_weight_image,
@@ -39,6 +39,8 @@
 #include <SEImplementation/Configuration/WeightImageConfig.h>
 #include <SEImplementation/Configuration/PythonConfig.h>
 #include <SEImplementation/Configuration/DetectionImageConfig.h>
+#include <SEImplementation/Configuration/DetectionFrameConfig.h>
+#include <SEImplementation/Background/BackgroundCache.h>
 #include <SEImplementation/PythonConfig/PyMeasurementImage.h>
 
 #include <SEImplementation/Configuration/MeasurementImageConfig.h>
@@ -82,7 +84,10 @@ void validateImagePaths(const PyMeasurementImage& image) {
 
 std::shared_ptr<MeasurementImage> createMeasurementImage(
     std::shared_ptr<FitsImageSource> fits_image_source, double flux_scale) {
-  std::shared_ptr<MeasurementImage> image = BufferedImage<DetectionImage::PixelType>::create(fits_image_source);
+  auto buffered_image = BufferedImage<DetectionImage::PixelType>::create(fits_image_source);
+  // Measurement images are only read around the sources
+  buffered_image->setAccessPattern(TileManager::AccessPattern::CUTOUTS);
+  std::shared_ptr<MeasurementImage> image = buffered_image;
   if (flux_scale != 1.) {
     image = MultiplyImage<MeasurementImage::PixelType>::create(image, flux_scale);
   }
@@ -222,6 +227,15 @@ void MeasurementImageConfig::initialize(const UserValues&) {
 
       info.m_psf_renormalize = py_image.psf_renormalize;
 
+      // An absolute weight is scaled with the flux
+      double weight_scaling = py_image.weight_scaling;
+      if (py_image.weight_absolute) {
+        weight_scaling *= flux_scale * flux_scale;
+      }
+      info.m_background_identity =
+          BackgroundCache::imageIdentity(py_image.file, info.m_image_hdu, py_image.image_layer, flux_scale) + ";" +
+          BackgroundCache::imageIdentity(py_image.weight_file, info.m_weight_hdu, py_image.weight_layer, weight_scaling);
+
       m_image_infos.emplace_back(std::move(info));
     }
   } else {
@@ -260,7 +274,9 @@ void MeasurementImageConfig::initialize(const UserValues&) {
       0, // image_layer
       0, // weight_layer
 
-      true // psf_renormalize
+      true, // psf_renormalize
+
+      DetectionFrameConfig::getBackgroundIdentity(detection_image, weight_image, 0)
     });
   }
 }
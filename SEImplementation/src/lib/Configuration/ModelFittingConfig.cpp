@@ -246,8 +246,14 @@ void ModelFittingConfig::initializeInner() {
       ::get("Dependent parameter", expr_builder, py_func, params.size());
 
     auto dependent_func = [dependent](const std::shared_ptr<CoordinateSystem> &cs, const std::vector<double> &params) -> double {
-      Pyston::Context context;
-      context["coordinate_system"] = cs;
+      // Building the context allocates, and this is called for every evaluation during the fitting.
+      // The context only depends on the coordinate system, which is normally the same for all sources.
+      thread_local Pyston::Context context;
+      thread_local const CoordinateSystem* context_cs = nullptr;
+      if (context_cs != cs.get() || context.empty()) {
+        context["coordinate_system"] = cs;
+        context_cs = cs.get();
+      }
       return dependent(context, params);
     };
 
@@ -387,6 +393,7 @@ void ModelFittingConfig::initializeInner() {
   m_window_type = static_cast<FlexibleModelFittingIterativeTask::WindowType>(
       py::extract<int>(parameters["window_type"].attr("value"))());
   m_ellipse_scale = py::extract<double>(parameters["ellipse_scale"]);
+  m_batch_convolution = py::extract<bool>(parameters["batch_convolution"]);
 }
 
 const std::map<int, std::shared_ptr<FlexibleModelFittingParameter>>& ModelFittingConfig::getParameters() const {
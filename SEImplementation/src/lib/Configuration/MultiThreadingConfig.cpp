@@ -32,13 +32,24 @@ namespace SourceXtractor {
 
 static const std::string THREADS_NB {"thread-count"};
 static const std::string MAX_QUEUE_SIZE {"thread-max-queue-size"};
+static const std::string MAX_QUEUE_MEMORY {"thread-max-queue-memory"};
+static const std::string SCHEDULE_WINDOW {"thread-schedule-window"};
+static const std::string BAND_PARALLEL {"thread-band-parallel"};
 
-MultiThreadingConfig::MultiThreadingConfig(long manager_id) : Configuration(manager_id), m_threads_nb(-1), m_max_queue_size(1000) {}
+MultiThreadingConfig::MultiThreadingConfig(long manager_id) : Configuration(manager_id), m_threads_nb(-1),
+                                                              m_max_queue_size(1000), m_max_queue_memory(0),
+                                                              m_schedule_window(64), m_band_parallel_sources(0) {}
 
 auto MultiThreadingConfig::getProgramOptions() -> std::map<std::string, OptionDescriptionList> {
   return { {"Multi-threading", {
       {THREADS_NB.c_str(), po::value<int>()->default_value(-1), "Number of worker threads (-1=automatic, 0=disable all multithreading)"},
-      {MAX_QUEUE_SIZE.c_str(), po::value<int>()->default_value(1000), "Limit the size of the internal queues"}
+      {MAX_QUEUE_SIZE.c_str(), po::value<int>()->default_value(1000), "Limit the size of the internal queues"},
+      {MAX_QUEUE_MEMORY.c_str(), po::value<int>()->default_value(0),
+          "Limit the estimated memory, in MB, used by the groups being measured (0=no limit)"},
+      {SCHEDULE_WINDOW.c_str(), po::value<int>()->default_value(64),
+          "Measure first the most expensive among this many waiting groups (1=detection order)"},
+      {BAND_PARALLEL.c_str(), po::value<int>()->default_value(0),
+          "Prepare the measurement frames of groups with at least this many sources in parallel (0=disable)"}
   }}};
 }
 
@@ -58,6 +69,24 @@ void MultiThreadingConfig::initialize(const UserValues& args) {
   if (m_max_queue_size <= 0) {
     throw Elements::Exception(MAX_QUEUE_SIZE + " must be strictly positive");
   }
+
+  auto max_queue_memory = args.at(MAX_QUEUE_MEMORY).as<int>();
+  if (max_queue_memory < 0) {
+    throw Elements::Exception(MAX_QUEUE_MEMORY + " can not be negative");
+  }
+  m_max_queue_memory = static_cast<size_t>(max_queue_memory) * 1024 * 1024;
+
+  auto schedule_window = args.at(SCHEDULE_WINDOW).as<int>();
+  if (schedule_window <= 0) {
+    throw Elements::Exception(SCHEDULE_WINDOW + " must be strictly positive");
+  }
+  m_schedule_window = schedule_window;
+
+  auto band_parallel = args.at(BAND_PARALLEL).as<int>();
+  if (band_parallel < 0) {
+    throw Elements::Exception(BAND_PARALLEL + " can not be negative");
+  }
+  m_band_parallel_sources = band_parallel;
 }
 
 } // SourceXtractor namespace
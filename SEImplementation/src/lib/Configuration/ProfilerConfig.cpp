@@ -0,0 +1,85 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ProfilerConfig.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <fstream>
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <ElementsKernel/Logging.h>
+
+#include "SEFramework/Pipeline/Profiler.h"
+#include "SEImplementation/Configuration/ProfilerConfig.h"
+
+using namespace Euclid::Configuration;
+namespace po = boost::program_options;
+
+namespace SourceXtractor {
+
+static const std::string PROFILE_FILE {"profile-file"};
+static const std::string TRACE_FILE {"profile-trace-file"};
+
+static Elements::Logging logger = Elements::Logging::getLogger("Profiler");
+
+ProfilerConfig::ProfilerConfig(long manager_id) : Configuration(manager_id) {}
+
+auto ProfilerConfig::getProgramOptions() -> std::map<std::string, OptionDescriptionList> {
+  return { {"Profiling", {
+      {PROFILE_FILE.c_str(), po::value<std::string>()->default_value(""),
+          "Write the time spent per stage and per property, and the queue depths (CSV if the extension is .csv, JSON otherwise)"},
+      {TRACE_FILE.c_str(), po::value<std::string>()->default_value(""),
+          "Write a timeline of the run in the Chrome trace-event format"},
+  }}};
+}
+
+void ProfilerConfig::initialize(const UserValues& args) {
+  m_profile_file = args.at(PROFILE_FILE).as<std::string>();
+  m_trace_file = args.at(TRACE_FILE).as<std::string>();
+  if (!m_profile_file.empty() || !m_trace_file.empty()) {
+    Profiler::getInstance().enable(!m_trace_file.empty());
+  }
+}
+
+void ProfilerConfig::writeProfile() const {
+  auto& profiler = Profiler::getInstance();
+  if (!m_profile_file.empty()) {
+    std::ofstream out(m_profile_file);
+    if (!out) {
+      throw Elements::Exception() << "Can not write the profile into " << m_profile_file;
+    }
+    if (boost::algorithm::iends_with(m_profile_file, ".csv")) {
+      profiler.writeCsv(out);
+    }
+    else {
+      profiler.writeJson(out);
+    }
+    logger.info() << "Profile written into " << m_profile_file;
+  }
+  if (!m_trace_file.empty()) {
+    std::ofstream out(m_trace_file);
+    if (!out) {
+      throw Elements::Exception() << "Can not write the trace into " << m_trace_file;
+    }
+    profiler.writeChromeTrace(out);
+    logger.info() << "Trace written into " << m_trace_file;
+  }
+}
+
+} // SourceXtractor namespace
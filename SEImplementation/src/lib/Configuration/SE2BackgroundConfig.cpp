@@ -34,9 +34,11 @@ static Elements::Logging logger = Elements::Logging::getLogger("BackgroundConfig
 
 static const std::string CELLSIZE_VALUE {"background-cell-size" };
 static const std::string SMOOTHINGBOX_VALUE {"smoothing-box-size" };
+static const std::string CACHE_DIR {"background-cache-dir" };
+static const std::string CACHE_CHECKSUM {"background-cache-checksum" };
 
 SE2BackgroundConfig::SE2BackgroundConfig(long manager_id) :
-  Configuration(manager_id), m_cell_size(), m_smoothing_box() {
+  Configuration(manager_id), m_cell_size(), m_smoothing_box(), m_cache_checksum(false) {
 }
 
 std::map<std::string, Configuration::OptionDescriptionList> SE2BackgroundConfig::getProgramOptions() {
@@ -44,7 +46,11 @@ std::map<std::string, Configuration::OptionDescriptionList> SE2BackgroundConfig:
       {CELLSIZE_VALUE.c_str(), po::value<std::string>()->default_value(std::string("64")),
           "Background mesh cell size to determine a value."},
       {SMOOTHINGBOX_VALUE.c_str(), po::value<std::string>()->default_value(std::string("3")),
-          "Background median filter size"}
+          "Background median filter size"},
+      {CACHE_DIR.c_str(), po::value<std::string>()->default_value(""),
+          "Directory where the background meshes are cached between runs (can be shared by concurrent jobs)"},
+      {CACHE_CHECKSUM.c_str(), po::value<bool>()->default_value(false),
+          "Add a checksum of a sample of the pixels to the background cache key"}
   }}};
 }
 
@@ -59,6 +65,9 @@ void SE2BackgroundConfig::initialize(const UserValues& args) {
     m_smoothing_box = Euclid::stringToVector<int>(smoothing_box_str);
   }
 
+  m_cache_dir = args.at(CACHE_DIR).as<std::string>();
+  m_cache_checksum = args.at(CACHE_CHECKSUM).as<bool>();
+
   auto less_eq_0 = [](int v) { return v <= 0; };
   auto less_0 = [](int v) { return v < 0; };
 
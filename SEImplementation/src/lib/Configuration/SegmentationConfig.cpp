@@ -20,6 +20,7 @@
  * @author mschefer
  */
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -31,6 +32,7 @@
 #include "SEFramework/Image/VectorImage.h"
 #include "SEFramework/FITS/FitsReader.h"
 #include "SEImplementation/Segmentation/BackgroundConvolution.h"
+#include "SEImplementation/Configuration/MultiThreadingConfig.h"
 #include "SEImplementation/Configuration/SegmentationConfig.h"
 
 using boost::regex;
@@ -47,15 +49,19 @@ static Elements::Logging segConfigLogger = Elements::Logging::getLogger("Config"
 static const std::string SEGMENTATION_ALGORITHM {"segmentation-algorithm" };
 static const std::string SEGMENTATION_USE_FILTERING {"segmentation-use-filtering" };
 static const std::string SEGMENTATION_FILTER {"segmentation-filter" };
+static const std::string SEGMENTATION_FILTER_THREADS {"segmentation-filter-threads" };
 static const std::string SEGMENTATION_LUTZ_WINDOW_SIZE {"segmentation-lutz-window-size" };
 static const std::string SEGMENTATION_BFS_MAX_DELTA {"segmentation-bfs-max-delta" };
 static const std::string SEGMENTATION_ML_MODEL {"segmentation-ml-model" };
 static const std::string SEGMENTATION_ML_THRESHOLD {"segmentation-ml-threshold" };
 
 SegmentationConfig::SegmentationConfig(long manager_id) : Configuration(manager_id), m_selected_algorithm(Algorithm::UNKNOWN)
+    , m_filter_threads(0)
     , m_lutz_window_size(0)
     , m_bfs_max_delta(1000)
-    , m_ml_threshold(0.9) {}
+    , m_ml_threshold(0.9) {
+  declareDependency<MultiThreadingConfig>();
+}
 
 std::map<std::string, Configuration::OptionDescriptionList> SegmentationConfig::getProgramOptions() {
   return { {"Detection image", {
@@ -65,6 +71,9 @@ std::map<std::string, Configuration::OptionDescriptionList> SegmentationConfig::
           "Is filtering used"},
       {SEGMENTATION_FILTER.c_str(), po::value<std::string>()->default_value(""),
           "Loads a filter"},
+      {SEGMENTATION_FILTER_THREADS.c_str(), po::value<int>()->default_value(-1),
+          "Threads filtering the detection image ahead of the segmentation, for large filters, up to the "
+          "number of worker threads (-1=automatic, 0=disable)"},
       {SEGMENTATION_LUTZ_WINDOW_SIZE.c_str(), po::value<int>()->default_value(0),
           "Lutz sliding window size (0=disable)"},
       {SEGMENTATION_BFS_MAX_DELTA.c_str(), po::value<int>()->default_value(1000),
@@ -94,6 +103,31 @@ void SegmentationConfig::preInitialize(const UserValues& args) {
     throw Elements::Exception() << "Unknown segmentation algorithm : " << algorithm_name;
   }
 
+  if (args.at(SEGMENTATION_FILTER_THREADS).as<int>() < -1) {
+    throw Elements::Exception() << "Invalid " << SEGMENTATION_FILTER_THREADS << " value: "
+                                << args.at(SEGMENTATION_FILTER_THREADS).as<int>();
+  }
+
+  m_lutz_window_size = args.at(SEGMENTATION_LUTZ_WINDOW_SIZE).as<int>();
+  m_bfs_max_delta = args.at(SEGMENTATION_BFS_MAX_DELTA).as<int>();
+  m_onnx_model_path = args.at(SEGMENTATION_ML_MODEL).as<std::string>();
+  m_ml_threshold = args.at(SEGMENTATION_ML_THRESHOLD).as<double>();
+
+  if (m_selected_algorithm == Algorithm::ML && m_onnx_model_path == "") {
+    throw Elements::Exception() << "Machine learning segmentation requested but no ONNX model was provided";
+  }
+}
+
+void SegmentationConfig::initialize(const UserValues& args) {
+  // The filter threads are on top of the worker threads, so they follow the same setting
+  static const int default_filter_threads = 2;
+  int threads_nb = std::max(getDependency<MultiThreadingConfig>().getThreadsNb(), 0);
+  int filter_threads = args.at(SEGMENTATION_FILTER_THREADS).as<int>();
+  if (filter_threads == -1) {
+    filter_threads = default_filter_threads;
+  }
+  m_filter_threads = std::min(filter_threads, threads_nb);
+
   if (args.at(SEGMENTATION_USE_FILTERING).as<bool>()) {
     auto filter_filename = args.at(SEGMENTATION_FILTER).as<std::string>();
     if (filter_filename != "") {
@@ -106,15 +140,6 @@ void SegmentationConfig::preInitialize(const UserValues& args) {
   } else {
     m_filter = nullptr;
   }
-
-  m_lutz_window_size = args.at(SEGMENTATION_LUTZ_WINDOW_SIZE).as<int>();
-  m_bfs_max_delta = args.at(SEGMENTATION_BFS_MAX_DELTA).as<int>();
-  m_onnx_model_path = args.at(SEGMENTATION_ML_MODEL).as<std::string>();
-  m_ml_threshold = args.at(SEGMENTATION_ML_THRESHOLD).as<double>();
-
-  if (m_selected_algorithm == Algorithm::ML && m_onnx_model_path == "") {
-    throw Elements::Exception() << "Machine learning segmentation requested but no ONNX model was provided";
-  }
 }
 
 std::shared_ptr<DetectionImageFrame::ImageFilter> SegmentationConfig::getDefaultFilter() const {
@@ -132,7 +157,7 @@ std::shared_ptr<DetectionImageFrame::ImageFilter> SegmentationConfig::getDefault
   convolution_kernel->setValue(2,1, 2);
   convolution_kernel->setValue(2,2, 1);
 
-  return std::make_shared<BackgroundConvolution>(convolution_kernel, true);
+  return std::make_shared<BackgroundConvolution>(convolution_kernel, true, m_filter_threads);
 }
 
 std::shared_ptr<DetectionImageFrame::ImageFilter> SegmentationConfig::loadFilter(const std::string& filename) const {
@@ -158,7 +183,7 @@ std::shared_ptr<DetectionImageFrame::ImageFilter> SegmentationConfig::loadFITSFi
   segConfigLogger.info() << "Loaded segmentation filter: " << filename << " height: " << convolution_kernel->getHeight() << " width: " << convolution_kernel->getWidth();
 
   // return the correct object
-  return std::make_shared<BackgroundConvolution>(convolution_kernel, true);
+  return std::make_shared<BackgroundConvolution>(convolution_kernel, true, m_filter_threads);
 }
 
 static bool getNormalization(std::istream& line_stream) {
@@ -244,7 +269,7 @@ std::shared_ptr<DetectionImageFrame::ImageFilter> SegmentationConfig::loadASCIIF
   segConfigLogger.info() << "Loaded segmentation filter: " << filename << " width: " << convolution_kernel->getWidth() << " height: " << convolution_kernel->getHeight();
 
   // return the correct object
-  return std::make_shared<BackgroundConvolution>(convolution_kernel, normalize);
+  return std::make_shared<BackgroundConvolution>(convolution_kernel, normalize, m_filter_threads);
 }
 
 } // SourceXtractor namespace
@@ -0,0 +1,70 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ShardConfig.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "AlexandriaKernel/StringUtils.h"
+#include "SEImplementation/Configuration/ShardConfig.h"
+
+using namespace Euclid::Configuration;
+namespace po = boost::program_options;
+
+namespace SourceXtractor {
+
+static const std::string SHARD_REGION {"shard-region"};
+static const std::string SHARD_MARGIN {"shard-margin"};
+
+ShardConfig::ShardConfig(long manager_id) : Configuration(manager_id), m_enabled(false), m_margin(0) {
+}
+
+auto ShardConfig::getProgramOptions() -> std::map<std::string, OptionDescriptionList> {
+  return { {"Sharding", {
+      {SHARD_REGION.c_str(), po::value<std::string>()->default_value(""),
+          "Core region of the detection image owned by this process, as x,y,width,height (0-based pixels)"},
+      {SHARD_MARGIN.c_str(), po::value<int>()->default_value(0),
+          "Pixels processed around the core region. Should be larger than the biggest expected source"},
+  }}};
+}
+
+void ShardConfig::initialize(const UserValues& args) {
+  auto region_str = args.at(SHARD_REGION).as<std::string>();
+  m_margin = args.at(SHARD_MARGIN).as<int>();
+
+  if (m_margin < 0) {
+    throw Elements::Exception() << "Invalid " << SHARD_MARGIN << " value: " << m_margin;
+  }
+  if (region_str.empty()) {
+    return;
+  }
+
+  auto region = Euclid::stringToVector<int>(region_str);
+  if (region.size() != 4) {
+    throw Elements::Exception() << SHARD_REGION << " expects x,y,width,height, got: " << region_str;
+  }
+  if (region[0] < 0 || region[1] < 0 || region[2] <= 0 || region[3] <= 0) {
+    throw Elements::Exception() << "Invalid " << SHARD_REGION << ": " << region_str;
+  }
+
+  m_core = PixelRectangle(PixelCoordinate(region[0], region[1]),
+                          PixelCoordinate(region[0] + region[2] - 1, region[1] + region[3] - 1));
+  m_enabled = true;
+}
+
+} // end of namespace SourceXtractor
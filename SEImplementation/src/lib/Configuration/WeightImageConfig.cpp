@@ -112,6 +112,7 @@ void WeightImageConfig::initialize(const UserValues& args) {
   m_symmetry_usage = args.find(WEIGHT_SYMMETRYUSAGE)->second.as<bool>();
 
   auto weight_image_filename = args.find(WEIGHT_IMAGE)->second.as<std::string>();
+  m_weight_image_path = weight_image_filename;
 
   auto weight_type_name = boost::to_upper_copy(args.at(WEIGHT_TYPE).as<std::string>());
   auto weight_iter = WEIGHT_MAP.find(weight_type_name);
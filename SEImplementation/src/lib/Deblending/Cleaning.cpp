@@ -21,6 +21,7 @@
  *      Author: mschefer
  */
 
+#include <map>
 #include <vector>
 #include <set>
 #include <tuple>
@@ -38,8 +39,18 @@
 
 namespace SourceXtractor {
 
-inline bool operator<(SourceGroupInterface::iterator a, SourceGroupInterface::iterator b) {
-  return &(*a) < &(*b);
+namespace {
+
+// Merge following the ids, so the order of the group does not depend on memory addresses
+struct SourceIdLess {
+  bool operator()(SourceGroupInterface::iterator a, SourceGroupInterface::iterator b) const {
+    auto& a_id = a->getProperty<SourceId>();
+    auto& b_id = b->getProperty<SourceId>();
+    return std::make_pair(a_id.getDetectionId(), a_id.getSourceId()) <
+           std::make_pair(b_id.getDetectionId(), b_id.getSourceId());
+  }
+};
+
 }
 
 void Cleaning::deblend(SourceGroupInterface& group) const {
@@ -61,7 +72,7 @@ void Cleaning::deblend(SourceGroupInterface& group) const {
 
   if (sources_to_clean.size() > 0) {
     if (remaining_sources.size() > 1) {
-      std::map<SourceGroupInterface::iterator, std::vector<SourceGroupInterface::iterator>> merging_map;
+      std::map<SourceGroupInterface::iterator, std::vector<SourceGroupInterface::iterator>, SourceIdLess> merging_map;
       for (auto it : sources_to_clean) {
         auto influential_source = findMostInfluentialSource(*it, remaining_sources);
         merging_map[influential_source].push_back(it);
@@ -87,7 +98,7 @@ void Cleaning::deblend(SourceGroupInterface& group) const {
 }
 
 bool Cleaning::shouldClean(SourceInterface& source, SourceGroupInterface& group) const {
-  const auto& pixel_list = source.getProperty<PixelCoordinateList>().getCoordinateList();
+  const auto& pixel_list = source.getProperty<PixelCoordinateList>();
 
   std::vector<double> group_influence(pixel_list.size());
 
@@ -120,7 +131,7 @@ bool Cleaning::shouldClean(SourceInterface& source, SourceGroupInterface& group)
 SourceGroupInterface::iterator Cleaning::findMostInfluentialSource(
     SourceInterface& source, const std::vector<SourceGroupInterface::iterator>& candidates) const {
 
-  const auto& pixel_list = source.getProperty<PixelCoordinateList>().getCoordinateList();
+  const auto& pixel_list = source.getProperty<PixelCoordinateList>();
 
   std::vector<double> total_influence_of_sources(candidates.size());
 
@@ -147,20 +158,23 @@ SourceGroupInterface::iterator Cleaning::findMostInfluentialSource(
 std::unique_ptr<SourceInterface> Cleaning::mergeSources(SourceInterface& parent,
     const std::vector<SourceGroupInterface::iterator> children) const {
 
-  // Start with a copy of the pixel list of the parent
-  auto pixel_list = parent.getProperty<PixelCoordinateList>().getCoordinateList();
+  // Start with a copy of the pixel spans of the parent
+  auto pixel_spans = parent.getProperty<PixelCoordinateList>().getSpans();
 
-  // Merge the pixel lists of all the child sources
+  // Merge the pixel spans of all the child sources
   for (const auto& child : children) {
-    const auto& pixel_list_to_merge = child->getProperty<PixelCoordinateList>().getCoordinateList();
-    pixel_list.insert(pixel_list.end(), pixel_list_to_merge.begin(), pixel_list_to_merge.end());
+    const auto& spans_to_merge = child->getProperty<PixelCoordinateList>().getSpans();
+    pixel_spans.insert(pixel_spans.end(), spans_to_merge.begin(), spans_to_merge.end());
   }
 
   // Create a new source with the minimum necessary properties
   auto new_source = m_source_factory->createSource();
-  new_source->setProperty<PixelCoordinateList>(pixel_list);
+  new_source->setProperty<PixelCoordinateList>(std::move(pixel_spans));
   new_source->setProperty<DetectionFrame>(parent.getProperty<DetectionFrame>().getEncapsulatedFrame());
-  new_source->setProperty<SourceId>(parent.getProperty<SourceId>().getSourceId());
+
+  // The merged source replaces the parent, so it keeps its ids
+  const auto& parent_id = parent.getProperty<SourceId>();
+  new_source->setProperty<SourceId>(parent_id.getSourceId(), parent_id.getDetectionId());
 
   return new_source;
 }
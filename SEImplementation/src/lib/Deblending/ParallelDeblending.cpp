@@ -0,0 +1,46 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ParallelDeblending.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "SEImplementation/Deblending/ParallelDeblending.h"
+
+namespace SourceXtractor {
+
+ParallelDeblending::ParallelDeblending(std::shared_ptr<Deblending> deblending,
+                                       const std::shared_ptr<Euclid::ThreadPool>& thread_pool, unsigned max_queue_size)
+  : OrderedStage(thread_pool, max_queue_size, "ParallelDeblending"), m_deblending(std::move(deblending)) {
+}
+
+ParallelDeblending::~ParallelDeblending() {
+  wait();
+}
+
+std::vector<std::unique_ptr<SourceGroupInterface>>
+ParallelDeblending::process(std::unique_ptr<SourceGroupInterface> group) const {
+  std::vector<std::unique_ptr<SourceGroupInterface>> result;
+  group = m_deblending->applySteps(std::move(group));
+  if (group) {
+    result.emplace_back(std::move(group));
+  }
+  return result;
+}
+
+} // end of namespace SourceXtractor
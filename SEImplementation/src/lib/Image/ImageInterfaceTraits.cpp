@@ -8,6 +8,7 @@
 #include <iostream>
 
 #include "SEImplementation/Image/ImageInterfaceTraits.h"
+#include "SEImplementation/Image/LanczosResampler.h"
 
 namespace SourceXtractor {
 
@@ -119,7 +120,7 @@ static void makeLanczos4Kernel(float pos, float *kernel, const float threshold)
   }
 }
 
-inline void make_kernel(float pos, float *kernel, interpenum interptype) {
+void make_kernel(float pos, float *kernel, interpenum interptype) {
   const float threshold = 1e-6;
 
   switch (interptype) {
@@ -316,35 +317,7 @@ namespace ModelFitting {
 void ModelFitting::ImageTraits<ImageInterfaceTypePtr>::addImageToImage(
   ImageInterfaceTypePtr& target_image, const ImageInterfaceTypePtr& source_image,
   double scale_factor, double x, double y) {
-  // Calculate the size in pixels of the image2 after in the scale of image1
-  double scaled_width = width(source_image) * scale_factor;
-  double scaled_height = height(source_image) * scale_factor;
-  // Calculate the window of the image1 which is affected
-  int x_min = std::floor(x - scaled_width / 2.);
-  int x_max = std::ceil(x + scaled_width / 2.);
-  int window_width = x_max - x_min;
-  int y_min = std::floor(y - scaled_height / 2.);
-  int y_max = std::ceil(y + scaled_height / 2.);
-  int window_height = y_max - y_min;
-  // Calculate the shift of the image2 inside the window
-  double x_shift = x - scaled_width / 2. - x_min;
-  double y_shift = y - scaled_height / 2. - y_min;
-  // Create the scaled and shifted window
-  auto window = factory(window_width, window_height);
-
-  shiftResizeLancszosFast(source_image, window, scale_factor, x_shift, y_shift);
-
-  // We need to correct the window for the scaling, so it has the same integral
-  // with the image2
-  double corr_factor = 1. / (scale_factor * scale_factor);
-  // Add the window to the image1
-  for (int x_im = std::max(x_min, 0); x_im < std::min<int>(x_max, width(target_image)); ++x_im) {
-    for (int y_im = std::max(y_min, 0); y_im < std::min<int>(y_max, height(target_image)); ++y_im) {
-      int x_win = x_im - x_min;
-      int y_win = y_im - y_min;
-      at(target_image, x_im, y_im) += corr_factor * at(window, x_win, y_win);
-    }
-  }
+  SourceXtractor::LanczosResampler::addImage(*target_image, *source_image, scale_factor, x, y);
 }
 
 }
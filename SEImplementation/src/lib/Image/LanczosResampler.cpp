@@ -0,0 +1,141 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * LanczosResampler.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+#include "SEImplementation/Image/ImageInterfaceTraits.h"
+#include "SEImplementation/Image/LanczosResampler.h"
+
+namespace SourceXtractor {
+
+namespace {
+
+using WeightsKey = std::tuple<double, double, int, int>;
+
+// Enough for all the stamps of a group, for the duration of a fit
+constexpr size_t MAX_CACHED_WEIGHTS = 1024;
+
+thread_local std::map<WeightsKey, std::shared_ptr<const LanczosResampler::AxisWeights>> s_weights_cache;
+
+} // end of anonymous namespace
+
+std::shared_ptr<const LanczosResampler::AxisWeights> LanczosResampler::getWeights(double scale_factor, double shift,
+                                                                                 int source_size, int output_size) {
+  WeightsKey key{scale_factor, shift, source_size, output_size};
+  auto i = s_weights_cache.find(key);
+  if (i != s_weights_cache.end()) {
+    return i->second;
+  }
+
+  auto weights = std::make_shared<AxisWeights>();
+  weights->m_first.resize(output_size, -1);
+  weights->m_weights.resize(output_size * TAPS);
+  for (int out = 0; out < output_size; ++out) {
+    float pos = (out + 0.5 - shift) / scale_factor + 0.5;
+    int ipos = int(pos) - TAPS / 2;
+    if (ipos < 0 || ipos + TAPS - 1 >= source_size) {
+      continue;
+    }
+    weights->m_first[out] = ipos;
+    make_kernel(pos - int(pos), &weights->m_weights[out * TAPS], INTERP_LANCZOS4);
+  }
+
+  if (s_weights_cache.size() >= MAX_CACHED_WEIGHTS) {
+    s_weights_cache.clear();
+  }
+  s_weights_cache.emplace(key, weights);
+  return weights;
+}
+
+void LanczosResampler::addImage(VectorImage<SeFloat>& target, const VectorImage<SeFloat>& source,
+                                double scale_factor, double x, double y) {
+  int source_width = source.getWidth();
+  int source_height = source.getHeight();
+  int target_width = target.getWidth();
+  int target_height = target.getHeight();
+
+  // Window of the target covered by the scaled source
+  double scaled_width = source_width * scale_factor;
+  double scaled_height = source_height * scale_factor;
+  int x_min = std::floor(x - scaled_width / 2.);
+  int x_max = std::ceil(x + scaled_width / 2.);
+  int y_min = std::floor(y - scaled_height / 2.);
+  int y_max = std::ceil(y + scaled_height / 2.);
+
+  int x_start = std::max(x_min, 0), x_end = std::min(x_max, target_width);
+  int y_start = std::max(y_min, 0), y_end = std::min(y_max, target_height);
+  if (x_start >= x_end || y_start >= y_end) {
+    return;
+  }
+
+  // Shift of the source inside the window
+  double x_shift = x - scaled_width / 2. - x_min;
+  double y_shift = y - scaled_height / 2. - y_min;
+  auto x_weights = getWeights(scale_factor, x_shift, source_width, x_max - x_min);
+  auto y_weights = getWeights(scale_factor, y_shift, source_height, y_max - y_min);
+
+  // Correct for the scaling, so the integral is preserved
+  double corr_factor = 1. / (scale_factor * scale_factor);
+
+  const SeFloat* source_data = source.getData().data();
+  SeFloat* target_data = target.getData().data();
+  std::vector<float> row(source_width);
+
+  for (int y_im = y_start; y_im < y_end; ++y_im) {
+    int y_first = y_weights->m_first[y_im - y_min];
+    if (y_first < 0) {
+      continue;
+    }
+
+    // Vertical pass: one output row, as a weighted sum of contiguous source rows
+    const float* y_kernel = &y_weights->m_weights[(y_im - y_min) * TAPS];
+    std::fill(row.begin(), row.end(), 0.f);
+    for (int i = 0; i < TAPS; ++i) {
+      const SeFloat* source_row = source_data + (y_first + i) * source_width;
+      float k = y_kernel[i];
+      for (int x_src = 0; x_src < source_width; ++x_src) {
+        row[x_src] += k * source_row[x_src];
+      }
+    }
+
+    // Horizontal pass, straight into the target
+    SeFloat* target_row = target_data + y_im * target_width;
+    for (int x_im = x_start; x_im < x_end; ++x_im) {
+      int x_first = x_weights->m_first[x_im - x_min];
+      if (x_first < 0) {
+        continue;
+      }
+      const float* x_kernel = &x_weights->m_weights[(x_im - x_min) * TAPS];
+      const float* row_ptr = &row[x_first];
+      float val = 0.f;
+      for (int i = 0; i < TAPS; ++i) {
+        val += x_kernel[i] * row_ptr[i];
+      }
+      target_row[x_im] += corr_factor * val;
+    }
+  }
+}
+
+} // end of namespace SourceXtractor
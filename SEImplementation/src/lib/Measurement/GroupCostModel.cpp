@@ -0,0 +1,67 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * GroupCostModel.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "SEImplementation/Measurement/GroupCostModel.h"
+
+namespace SourceXtractor {
+
+GroupCostModel::GroupCostModel(double source_weight, size_t min_samples)
+  : m_min_samples(min_samples), m_source_cost(source_weight), m_pixel_cost(1.),
+    m_samples(0), m_ss(0), m_sp(0), m_pp(0), m_st(0), m_pt(0) {
+}
+
+double GroupCostModel::estimate(size_t sources, size_t pixels) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_source_cost * sources + m_pixel_cost * pixels;
+}
+
+void GroupCostModel::update(size_t sources, size_t pixels, double seconds) {
+  double s = sources, p = pixels;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_ss += s * s;
+  m_sp += s * p;
+  m_pp += p * p;
+  m_st += s * seconds;
+  m_pt += p * seconds;
+  ++m_samples;
+
+  if (m_samples < m_min_samples) {
+    return;
+  }
+
+  // Solve the 2x2 normal equations. Keep the previous coefficients if the system
+  // is degenerate (i.e. all groups so far have the same shape), or the fit is not physical.
+  double det = m_ss * m_pp - m_sp * m_sp;
+  if (det <= 1e-12 * m_ss * m_pp) {
+    return;
+  }
+  double source_cost = (m_st * m_pp - m_pt * m_sp) / det;
+  double pixel_cost = (m_pt * m_ss - m_st * m_sp) / det;
+  if (source_cost < 0 || pixel_cost < 0 || source_cost + pixel_cost <= 0) {
+    return;
+  }
+  m_source_cost = source_cost;
+  m_pixel_cost = pixel_cost;
+}
+
+} // end of namespace SourceXtractor
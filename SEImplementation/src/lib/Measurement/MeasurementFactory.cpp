@@ -21,6 +21,7 @@
  *      Author: mschefer
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include "SEImplementation/Measurement/MeasurementFactory.h"
@@ -28,13 +29,17 @@
 #include "SEImplementation/Measurement/MultithreadedMeasurement.h"
 #include "SEImplementation/Configuration/OutputConfig.h"
 #include "SEImplementation/Configuration/MultiThreadingConfig.h"
+#include "SEImplementation/Configuration/MeasurementImageConfig.h"
 
 namespace SourceXtractor {
 
 std::unique_ptr<Measurement> MeasurementFactory::getMeasurement() const {
   if (m_threads_nb > 0) {
     auto source_to_row = m_output_registry->getSourceToRowConverter(m_output_properties);
-    return std::unique_ptr<Measurement>(new MultithreadedMeasurement(source_to_row, m_thread_pool, m_max_queue));
+    return std::unique_ptr<Measurement>(new MultithreadedMeasurement(source_to_row, m_thread_pool, m_max_queue,
+                                                                     m_max_queue_memory, m_frames_nb,
+                                                                     m_schedule_window, m_task_provider,
+                                                                     m_band_parallel_sources, m_ordered_output));
   } else {
     return std::unique_ptr<Measurement>(new DummyMeasurement());
   }
@@ -43,13 +48,19 @@ std::unique_ptr<Measurement> MeasurementFactory::getMeasurement() const {
 void MeasurementFactory::reportConfigDependencies(Euclid::Configuration::ConfigManager& manager) const {
   manager.registerConfiguration<OutputConfig>();
   manager.registerConfiguration<MultiThreadingConfig>();
+  manager.registerConfiguration<MeasurementImageConfig>();
 }
 
 void MeasurementFactory::configure(Euclid::Configuration::ConfigManager& manager) {
   m_output_properties = manager.getConfiguration<OutputConfig>().getOutputProperties();
+  m_ordered_output = !manager.getConfiguration<OutputConfig>().getOutputUnsorted();
   m_threads_nb = manager.getConfiguration<MultiThreadingConfig>().getThreadsNb();
   m_thread_pool = manager.getConfiguration<MultiThreadingConfig>().getThreadPool();
   m_max_queue = manager.getConfiguration<MultiThreadingConfig>().getMaxQueueSize();
+  m_max_queue_memory = manager.getConfiguration<MultiThreadingConfig>().getMaxQueueMemory();
+  m_schedule_window = manager.getConfiguration<MultiThreadingConfig>().getScheduleWindow();
+  m_band_parallel_sources = manager.getConfiguration<MultiThreadingConfig>().getBandParallelSources();
+  m_frames_nb = std::max<size_t>(1, manager.getConfiguration<MeasurementImageConfig>().getImageInfos().size());
 }
 
 }
@@ -21,17 +21,114 @@
  *      Author: mschefer
  */
 
+#include <algorithm>
+#include <cassert>
 #include <chrono>
 #include <ElementsKernel/Logging.h>
 #include <csignal>
+#include <exception>
+#include <map>
+#include <set>
+#include <typeindex>
 
+#include "AlexandriaKernel/memory_tools.h"
+#include "SEFramework/Image/Image.h"
+#include "SEFramework/Pipeline/Profiler.h"
+#include "SEFramework/Property/PropertyNotFoundException.h"
+#include "SEImplementation/Plugin/MeasurementFrame/MeasurementFrame.h"
+#include "SEImplementation/Plugin/MeasurementFrameCoordinates/MeasurementFrameCoordinates.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
+#include "SEImplementation/Plugin/MeasurementFrameGroupRectangle/MeasurementFrameGroupRectangle.h"
+#include "SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h"
+#include "SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h"
+#include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
+#include "SEImplementation/Plugin/MeasurementFrameRectangle/MeasurementFrameRectangle.h"
 #include "SEImplementation/Plugin/SourceIDs/SourceID.h"
+#include "SEImplementation/Property/PixelCoordinateList.h"
 #include "SEImplementation/Measurement/MultithreadedMeasurement.h"
 
 using namespace SourceXtractor;
 
 static Elements::Logging logger = Elements::Logging::getLogger("Multithreading");
 
+namespace {
+
+/// Properties of the same measurement frame
+using Band = std::vector<PropertyId>;
+
+/// Properties computed once per measurement frame, with the frame index as instance index
+bool isFrameProperty(const PropertyId& property_id) {
+  static const std::set<std::type_index> frame_properties {
+    typeid(MeasurementFrame), typeid(MeasurementFrameInfo), typeid(MeasurementFrameImages),
+    typeid(MeasurementFrameCoordinates), typeid(MeasurementFramePixelCentroid), typeid(MeasurementFrameRectangle),
+    typeid(MeasurementFrameGroupRectangle), typeid(MeasurementFrameCutout)
+  };
+  return frame_properties.count(property_id.getTypeId()) > 0;
+}
+
+void computeBand(SourceGroupInterface& group, const Band& band) {
+  for (auto& source : group) {
+    for (auto& property_id : band) {
+      try {
+        source.getProperty(property_id);
+      }
+      catch (const PropertyNotFoundException&) {
+        // Not applicable to this source
+      }
+    }
+  }
+}
+
+/**
+ * Bands are handed out one at a time to whoever asks first, the owner of the group included.
+ * The owner only waits for the bands already taken, so it never blocks on a helper still
+ * queued on the pool (which could be waiting for this very thread to become free).
+ */
+struct BandFanOut {
+  SourceGroupInterface& m_group;
+  std::vector<Band> m_bands;
+  size_t m_next, m_in_progress;
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable m_band_done;
+
+  BandFanOut(SourceGroupInterface& group, std::vector<Band> bands)
+    : m_group(group), m_bands(std::move(bands)), m_next(0), m_in_progress(0) {}
+
+  void work() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_next < m_bands.size() && !m_error) {
+      const auto& band = m_bands[m_next++];
+      ++m_in_progress;
+      lock.unlock();
+      std::exception_ptr error;
+      try {
+        computeBand(m_group, band);
+      }
+      catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      if (error && !m_error) {
+        m_error = error;
+      }
+      --m_in_progress;
+    }
+    lock.unlock();
+    m_band_done.notify_all();
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_band_done.wait(lock, [this]() { return m_in_progress == 0; });
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+  }
+};
+
+} // end of anonymous namespace
+
 
 MultithreadedMeasurement::~MultithreadedMeasurement() {
   if (m_output_thread->joinable()) {
@@ -79,25 +176,183 @@ void MultithreadedMeasurement::receiveSource(std::unique_ptr<SourceGroupInterfac
     source.getProperty<SourceID>();
   }
 
-  // Put the new SourceGroup into the input queue
-  auto order_number = m_group_counter;
-  auto lambda = [this, order_number, source_group = std::move(source_group)]() mutable {
-    // Trigger measurements
-    for (auto& source : *source_group) {
-      m_source_to_row(source);
+  auto footprint = estimateFootprint(*source_group, m_frames_nb);
+  admit(m_group_counter, footprint);
+
+  size_t sources = 0, pixels = 0;
+  for (auto& source : *source_group) {
+    ++sources;
+    pixels += source.getProperty<PixelCoordinateList>().size();
+  }
+
+  // Queue the group. Each task submitted measures one group, but not necessarily this one
+  {
+    std::lock_guard<std::mutex> pending_lock(m_pending_mutex);
+    m_pending.emplace_back(QueuedGroup{m_group_counter, footprint, sources, pixels, std::move(source_group)});
+  }
+  m_thread_pool->submit([this]() {
+    measureNext();
+  });
+  ++m_group_counter;
+}
+
+void MultithreadedMeasurement::measureNext() {
+  ProfilerScope scope(Profiler::Category::STAGE, "MultithreadedMeasurement.process");
+  QueuedGroup next;
+  // Do not run ahead of the oldest unreleased group by more than the window. The oldest group
+  // waiting is always eligible.
+  int horizon = oldestUnreleased() + static_cast<int>(m_schedule_window);
+  {
+    std::lock_guard<std::mutex> pending_lock(m_pending_mutex);
+    assert(!m_pending.empty());
+    // Estimated now, as the model is refined while the groups wait
+    auto selected = m_pending.begin();
+    double selected_cost = m_cost_model.estimate(selected->m_sources, selected->m_pixels);
+    size_t considered = 1;
+    for (auto i = std::next(m_pending.begin()); i != m_pending.end() && considered < m_schedule_window &&
+         i->m_order_number < horizon; ++i, ++considered) {
+      double cost = m_cost_model.estimate(i->m_sources, i->m_pixels);
+      if (cost > selected_cost) {
+        selected = i;
+        selected_cost = cost;
+      }
     }
-    // Pass to the output thread
-    {
-      std::unique_lock<std::mutex> output_lock(m_output_queue_mutex);
-      m_output_queue.emplace_back(order_number, std::move(source_group));
+    next = std::move(*selected);
+    m_pending.erase(selected);
+  }
+
+  // Trigger measurements
+  auto start = std::chrono::steady_clock::now();
+  measureBands(*next.m_group, next.m_sources);
+  for (auto& source : *next.m_group) {
+    m_source_to_row(source);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  m_cost_model.update(next.m_sources, next.m_pixels, elapsed.count());
+
+  // Pass to the output thread
+  {
+    std::unique_lock<std::mutex> output_lock(m_output_queue_mutex);
+    auto order_number = next.m_order_number;
+    m_output_queue.emplace(order_number, std::move(next));
+  }
+  m_new_output.notify_one();
+}
+
+void MultithreadedMeasurement::measureBands(SourceGroupInterface& group, size_t sources) {
+  if (!m_task_provider || m_band_parallel_sources == 0 || sources < m_band_parallel_sources || m_frames_nb < 2) {
+    return;
+  }
+
+  // Only the per-frame properties are split. The instance index of other properties (apertures, flags,
+  // model fitting parameters...) is not a frame, and their tasks are left to the final conversion into rows
+  std::map<unsigned, Band> bands_by_index;
+  for (auto& property_id : m_task_provider->getKnownPropertyIds()) {
+    if (isFrameProperty(property_id)) {
+      bands_by_index[property_id.getIndex()].emplace_back(property_id);
     }
-    m_new_output.notify_one();
-  };
-  auto lambda_copyable = [lambda = std::make_shared<decltype(lambda)>(std::move(lambda))](){
-    (*lambda)();
-  };
-  m_thread_pool->submit(lambda_copyable);
-  ++m_group_counter;
+  }
+  if (bands_by_index.size() < 2) {
+    return;
+  }
+
+  // The first band runs alone, so the prerequisites shared by all bands are computed only once
+  auto first = bands_by_index.begin();
+  computeBand(group, first->second);
+
+  std::vector<Band> bands;
+  for (auto i = std::next(first); i != bands_by_index.end(); ++i) {
+    bands.emplace_back(std::move(i->second));
+  }
+  auto fan_out = std::make_shared<BandFanOut>(group, std::move(bands));
+  size_t helpers = std::min<size_t>(fan_out->m_bands.size() - 1, m_thread_pool->activeThreads());
+  for (size_t i = 0; i < helpers; ++i) {
+    m_thread_pool->submit([fan_out]() {
+      fan_out->work();
+    });
+  }
+  fan_out->work();
+  fan_out->wait();
+}
+
+size_t MultithreadedMeasurement::estimateFootprint(const SourceGroupInterface& group, size_t frames_nb) {
+  // Detection stamps: image, filtered, thresholded, threshold map and variance
+  static const size_t detection_stamps = 5;
+  // Cutouts per measurement frame: image, variance, and a residual or model
+  static const size_t frame_stamps = 3;
+  // Properties, tasks and bookkeeping not accounted otherwise
+  static const size_t source_overhead = 4096;
+
+  size_t footprint = 0;
+  for (auto& source : group) {
+    const auto& pixels = source.getProperty<PixelCoordinateList>();
+    const auto& spans = pixels.getSpans();
+    footprint += source_overhead + spans.size() * sizeof(PixelSpan) + pixels.size() * sizeof(PixelCoordinate);
+    if (spans.empty()) {
+      continue;
+    }
+
+    int min_x = spans.front().m_x_start, max_x = spans.front().m_x_end;
+    int min_y = spans.front().m_y, max_y = spans.front().m_y;
+    for (auto& span : spans) {
+      min_x = std::min(min_x, span.m_x_start);
+      max_x = std::max(max_x, span.m_x_end);
+      min_y = std::min(min_y, span.m_y);
+      max_y = std::max(max_y, span.m_y);
+    }
+    size_t area = static_cast<size_t>(max_x - min_x) * static_cast<size_t>(max_y - min_y + 1);
+    footprint += area * sizeof(DetectionImage::PixelType) * (detection_stamps + frame_stamps * frames_nb);
+  }
+  return footprint;
+}
+
+void MultithreadedMeasurement::admit(int order_number, size_t footprint) {
+  {
+    std::unique_lock<std::mutex> admission_lock(m_admission_mutex);
+    while (m_queued_groups > 0 && (m_queued_groups >= m_max_queue_size ||
+           (m_max_queue_bytes > 0 && m_queued_bytes + footprint > m_max_queue_bytes))) {
+      m_admission_released.wait_for(admission_lock, std::chrono::milliseconds(100));
+      // A failed worker would never release its group
+      if (m_thread_pool->checkForException(false)) {
+        logger.fatal() << "An exception was thrown from a worker thread";
+        admission_lock.unlock();
+        m_thread_pool->checkForException(true);
+      }
+    }
+    ++m_queued_groups;
+    m_queued_bytes += footprint;
+    m_unreleased.insert(order_number);
+  }
+  notifyQueueProgress();
+}
+
+void MultithreadedMeasurement::release(int order_number, size_t footprint) {
+  {
+    std::lock_guard<std::mutex> admission_lock(m_admission_mutex);
+    --m_queued_groups;
+    m_queued_bytes -= footprint;
+    m_unreleased.erase(order_number);
+  }
+  m_admission_released.notify_all();
+  notifyQueueProgress();
+}
+
+int MultithreadedMeasurement::oldestUnreleased() {
+  std::lock_guard<std::mutex> admission_lock(m_admission_mutex);
+  // Only called while measuring a group, which is itself unreleased
+  assert(!m_unreleased.empty());
+  return *m_unreleased.begin();
+}
+
+void MultithreadedMeasurement::notifyQueueProgress() {
+  MeasurementQueueProgress progress;
+  {
+    std::lock_guard<std::mutex> admission_lock(m_admission_mutex);
+    progress = MeasurementQueueProgress{m_queued_groups, m_queued_bytes, m_max_queue_bytes};
+  }
+  Observable<MeasurementQueueProgress>::notifyObservers(progress);
+  Profiler::getInstance().sample("MultithreadedMeasurement.queue", progress.groups);
+  Profiler::getInstance().sample("MultithreadedMeasurement.queue_bytes", progress.bytes);
 }
 
 void MultithreadedMeasurement::outputThreadStatic(MultithreadedMeasurement *measurement) {
@@ -125,10 +380,18 @@ void MultithreadedMeasurement::outputThreadLoop() {
       m_new_output.wait_for(output_lock, std::chrono::milliseconds(100));
     }
 
-    // Process the output queue
+    // Process the output queue. The budget of a group is returned only once it has been passed on.
     while (!m_output_queue.empty()) {
-      sendSource(std::move(m_output_queue.front().second));
-      m_output_queue.pop_front();
+      auto next = m_output_queue.begin();
+      if (m_ordered_output && next->first != m_next_output) {
+        break;
+      }
+      auto order_number = next->first;
+      auto footprint = next->second.m_footprint;
+      sendSource(std::move(next->second.m_group));
+      m_output_queue.erase(next);
+      ++m_next_output;
+      release(order_number, footprint);
     }
 
     if (m_input_done && m_thread_pool->running() + m_thread_pool->queued() == 0 &&
@@ -0,0 +1,285 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointOutput.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+#include <boost/filesystem.hpp>
+
+#include <ElementsKernel/Exception.h>
+#include <ElementsKernel/Logging.h>
+
+#include "Table/FitsReader.h"
+#include "Table/FitsWriter.h"
+
+#include "SEImplementation/Property/PixelCoordinateList.h"
+#include "SEImplementation/Output/CheckpointOutput.h"
+
+namespace fs = boost::filesystem;
+
+namespace SourceXtractor {
+
+static Elements::Logging logger = Elements::Logging::getLogger("Checkpoint");
+
+static const std::string COMPLETED_INDEX {"completed"};
+static const std::string CONFIGURATION_HASH {"configuration"};
+static const std::string NO_PART {"-"};
+static const std::string END_OF_ENTRY {"end"};
+
+CheckpointOutput::CheckpointOutput(std::shared_ptr<Output> output, std::shared_ptr<FlushableOutput> rows_output,
+                                   const std::string& directory, double interval,
+                                   const std::string& configuration_hash)
+  : m_output(std::move(output)), m_rows_output(std::move(rows_output)), m_directory(directory),
+    m_interval(interval), m_restored_count(0), m_frame(0), m_part_nb(0),
+    m_last_checkpoint(std::chrono::steady_clock::now()) {
+  restore(configuration_hash);
+  replayParts();
+
+  // Registered after the replay, so the restored rows are not saved again
+  m_rows_output->setRowObserver([this](const Euclid::Table::Row& row) {
+    m_pending_rows.emplace_back(row);
+  });
+}
+
+uint64_t CheckpointOutput::getGroupKey(const SourceGroupInterface& group) {
+  // First pixel, in row order, and number of pixels of each source
+  std::vector<std::tuple<int, int, size_t>> footprints;
+  for (auto& source : group) {
+    const auto& pixels = source.getProperty<PixelCoordinateList>();
+    const auto& spans = pixels.getSpans();
+    std::tuple<int, int, size_t> footprint{0, 0, pixels.size()};
+    if (!spans.empty()) {
+      auto first = std::min_element(spans.begin(), spans.end(), [](const PixelSpan& a, const PixelSpan& b) {
+        return std::tie(a.m_y, a.m_x_start) < std::tie(b.m_y, b.m_x_start);
+      });
+      std::get<0>(footprint) = first->m_y;
+      std::get<1>(footprint) = first->m_x_start;
+    }
+    footprints.emplace_back(footprint);
+  }
+  std::sort(footprints.begin(), footprints.end());
+
+  // 64 bits FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  auto update = [&hash](uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      hash ^= (value >> (i * 8)) & 0xFF;
+      hash *= 1099511628211ULL;
+    }
+  };
+  for (auto& footprint : footprints) {
+    update(static_cast<uint32_t>(std::get<0>(footprint)));
+    update(static_cast<uint32_t>(std::get<1>(footprint)));
+    update(std::get<2>(footprint));
+  }
+  return hash;
+}
+
+void CheckpointOutput::receiveSource(std::unique_ptr<SourceGroupInterface> source_group) {
+  auto key = getGroupKey(*source_group);
+  m_output->receiveSource(std::move(source_group));
+  m_pending_groups.emplace_back(key);
+
+  if (std::chrono::steady_clock::now() - m_last_checkpoint >= m_interval) {
+    checkpoint();
+  }
+}
+
+void CheckpointOutput::outputSource(const SourceInterface& source) {
+  m_output->outputSource(source);
+}
+
+size_t CheckpointOutput::flush() {
+  checkpoint();
+  return m_output->flush();
+}
+
+void CheckpointOutput::nextPart() {
+  checkpoint();
+  m_output->nextPart();
+  ++m_frame;
+  replayParts();
+}
+
+bool CheckpointOutput::isCompleted(const SourceGroupInterface& group) const {
+  // m_restored is only modified on construction
+  auto frame = m_restored.find(m_frame);
+  if (frame == m_restored.end()) {
+    return false;
+  }
+  return frame->second.count(getGroupKey(group)) > 0;
+}
+
+void CheckpointOutput::restore(const std::string& configuration_hash) {
+  auto index_path = fs::path(m_directory) / COMPLETED_INDEX;
+  auto hash_path = fs::path(m_directory) / CONFIGURATION_HASH;
+  std::ifstream index(index_path.string());
+  if (!index) {
+    std::ofstream hash_file(hash_path.string(), std::ios::trunc);
+    hash_file << configuration_hash << std::endl;
+    if (!hash_file) {
+      throw Elements::Exception() << "Failed to write the configuration hash in " << m_directory;
+    }
+    return;
+  }
+
+  std::string stored_hash;
+  std::ifstream hash_file(hash_path.string());
+  if (!(hash_file >> stored_hash) || stored_hash != configuration_hash) {
+    throw Elements::Exception() << "The checkpoint in " << m_directory << " was made with a different "
+                                << "configuration. Remove it, or use another checkpoint directory";
+  }
+
+  // Each line is: frame, part file (or - if no rows were written), number of groups, the group keys, and
+  // an end marker. A line is only appended once its part is complete, so anything that does not parse
+  // is an interrupted write
+  std::string line;
+  std::vector<std::string> valid_lines;
+  size_t line_nb = 0;
+  while (std::getline(index, line)) {
+    ++line_nb;
+    std::istringstream fields(line);
+    size_t frame, ngroups;
+    std::string part;
+    if (!(fields >> frame >> part >> ngroups)) {
+      logger.warn() << "Ignoring malformed checkpoint entry " << index_path << ":" << line_nb;
+      continue;
+    }
+    std::vector<uint64_t> keys;
+    std::string token;
+    bool complete = false, valid = true;
+    while (valid && fields >> token) {
+      if (token == END_OF_ENTRY) {
+        complete = !(fields >> token);
+        break;
+      }
+      size_t parsed = 0;
+      try {
+        keys.emplace_back(std::stoull(token, &parsed, 16));
+      }
+      catch (const std::logic_error&) {
+      }
+      valid = parsed > 0 && parsed == token.size();
+    }
+    if (!valid || !complete || keys.size() != ngroups) {
+      logger.warn() << "Ignoring truncated checkpoint entry " << index_path << ":" << line_nb;
+      continue;
+    }
+    if (part != NO_PART) {
+      if (!fs::exists(fs::path(m_directory) / part)) {
+        logger.warn() << "Ignoring checkpoint entry with a missing part " << part;
+        continue;
+      }
+      m_restored_parts[frame].emplace_back(part);
+      m_part_nb = std::max<size_t>(m_part_nb, std::stoul(part.substr(part.find('_') + 1)) + 1);
+    }
+    m_restored[frame].insert(keys.begin(), keys.end());
+    m_restored_count += keys.size();
+    valid_lines.emplace_back(line);
+  }
+  index.close();
+
+  // Drop the invalid entries, so the new ones are not appended to an incomplete line
+  if (valid_lines.size() != line_nb) {
+    auto tmp_path = fs::path(m_directory) / (COMPLETED_INDEX + ".tmp");
+    {
+      std::ofstream rewritten(tmp_path.string(), std::ios::trunc);
+      for (auto& valid_line : valid_lines) {
+        rewritten << valid_line << '\n';
+      }
+      if (!rewritten.flush()) {
+        throw Elements::Exception() << "Failed to rewrite the checkpoint index in " << m_directory;
+      }
+    }
+    fs::rename(tmp_path, index_path);
+  }
+
+  if (m_restored_count > 0) {
+    logger.info() << "Resuming from the checkpoint in " << m_directory << ": "
+                  << m_restored_count << " groups already measured";
+  }
+}
+
+void CheckpointOutput::replayParts() {
+  auto parts = m_restored_parts.find(m_frame);
+  if (parts == m_restored_parts.end()) {
+    return;
+  }
+
+  size_t nrows = 0;
+  for (auto& part : parts->second) {
+    Euclid::Table::FitsReader reader((fs::path(m_directory) / part).string());
+    auto table = reader.read();
+    for (auto& row : table) {
+      m_rows_output->outputRow(row);
+    }
+    nrows += table.size();
+  }
+  // Write them on their own, so they are not mixed with the new rows
+  m_rows_output->flush();
+  logger.info() << "Restored " << nrows << " rows for frame " << m_frame + 1;
+}
+
+void CheckpointOutput::checkpoint() {
+  m_last_checkpoint = std::chrono::steady_clock::now();
+  if (m_pending_groups.empty()) {
+    return;
+  }
+
+  std::string part = NO_PART;
+  if (!m_pending_rows.empty()) {
+    std::ostringstream name;
+    name << "part_" << std::setw(6) << std::setfill('0') << m_part_nb;
+    part = name.str() + ".fits";
+
+    auto final_path = fs::path(m_directory) / part;
+    auto tmp_path = fs::path(m_directory) / (name.str() + ".tmp.fits");
+    {
+      Euclid::Table::FitsWriter writer(tmp_path.string(), true);
+      writer.setHduName("CATALOG");
+      writer.addData(Euclid::Table::Table{m_pending_rows});
+    }
+    fs::rename(tmp_path, final_path);
+    ++m_part_nb;
+  }
+
+  std::ofstream index((fs::path(m_directory) / COMPLETED_INDEX).string(), std::ios::app);
+  index << m_frame << ' ' << part << ' ' << m_pending_groups.size() << std::hex;
+  for (auto key : m_pending_groups) {
+    index << ' ' << key;
+  }
+  index << ' ' << END_OF_ENTRY << std::endl;
+  if (!index) {
+    throw Elements::Exception() << "Failed to write the checkpoint index in " << m_directory;
+  }
+
+  logger.debug() << "Checkpoint with " << m_pending_groups.size() << " groups and "
+                 << m_pending_rows.size() << " rows";
+  m_pending_rows.clear();
+  m_pending_groups.clear();
+}
+
+} // end of namespace SourceXtractor
@@ -27,9 +27,13 @@
 
 #include "SEFramework/Output/OutputRegistry.h"
 
+#include "SEImplementation/Configuration/CheckpointConfig.h"
 #include "SEImplementation/Configuration/DetectionImageConfig.h"
+#include "SEImplementation/Configuration/ShardConfig.h"
 
 #include "SEImplementation/Output/AsciiOutput.h"
+#include "SEImplementation/Output/CheckpointOutput.h"
+#include "SEImplementation/Output/CoreRegionOutput.h"
 #include "SEImplementation/Output/FitsOutput.h"
 #include "SEImplementation/Output/LdacOutput.h"
 #include "SEImplementation/Output/OutputFactory.h"
@@ -41,23 +45,40 @@ namespace SourceXtractor {
 std::shared_ptr<Output> OutputFactory::createOutput() const {
   auto source_to_row = m_output_registry->getSourceToRowConverter(m_output_properties);
 
+  std::shared_ptr<FlushableOutput> rows_output;
   if (m_output_filename != "") {
     switch (m_output_format) {
       case OutputConfig::OutputFileFormat::FITS:
-        return std::make_shared<FitsOutput>(m_output_filename, source_to_row, m_flush_size);
+        rows_output = std::make_shared<FitsOutput>(m_output_filename, source_to_row, m_flush_size);
+        break;
       case OutputConfig::OutputFileFormat::FITS_LDAC:
-        return std::make_shared<LdacOutput>(m_output_filename, source_to_row, m_flush_size);
+        rows_output = std::make_shared<LdacOutput>(m_output_filename, source_to_row, m_flush_size);
+        break;
       default:
       case OutputConfig::OutputFileFormat::ASCII:
-        return std::make_shared<AsciiOutput>(m_output_filename, source_to_row, m_flush_size);
+        rows_output = std::make_shared<AsciiOutput>(m_output_filename, source_to_row, m_flush_size);
+        break;
     }
   } else {
-    return std::make_shared<AsciiOutput>(m_output_filename, source_to_row, m_flush_size);
+    rows_output = std::make_shared<AsciiOutput>(m_output_filename, source_to_row, m_flush_size);
   }
+
+  std::shared_ptr<Output> output = rows_output;
+  if (m_core_region.getWidth() > 0) {
+    output = std::make_shared<CoreRegionOutput>(output, m_core_region);
+  }
+  // Outermost, so it sees the groups
+  if (!m_checkpoint_dir.empty()) {
+    output = std::make_shared<CheckpointOutput>(output, rows_output, m_checkpoint_dir, m_checkpoint_interval,
+                                                m_checkpoint_configuration);
+  }
+  return output;
 }
 
 void OutputFactory::reportConfigDependencies(Euclid::Configuration::ConfigManager& manager) const {
   manager.registerConfiguration<OutputConfig>();
+  manager.registerConfiguration<ShardConfig>();
+  manager.registerConfiguration<CheckpointConfig>();
 }
 
 void OutputFactory::configure(Euclid::Configuration::ConfigManager& manager) {
@@ -67,6 +88,16 @@ void OutputFactory::configure(Euclid::Configuration::ConfigManager& manager) {
   m_output_filename = output_config.getOutputFile();
   m_output_format = output_config.getOutputFileFormat();
 
+  auto& shard_config = manager.getConfiguration<ShardConfig>();
+  if (shard_config.isEnabled()) {
+    m_core_region = shard_config.getCoreRegion();
+  }
+
+  auto& checkpoint_config = manager.getConfiguration<CheckpointConfig>();
+  m_checkpoint_dir = checkpoint_config.getDirectory();
+  m_checkpoint_interval = checkpoint_config.getInterval();
+  m_checkpoint_configuration = checkpoint_config.getConfigurationHash();
+
   if (m_output_filename != "") {
     // Check if we can, at least, create it.
     // Otherwise, the error will be triggered only at the end of the full process!
@@ -50,7 +50,7 @@ std::vector<std::unique_ptr<SourceInterface>> AttractorsPartitionStep::partition
   };
 
   std::vector<std::pair<PixelCoordinate, PixelCoordinate>> pixel_coordinates;
-  auto& pixel_list = source->getProperty<PixelCoordinateList>().getCoordinateList();
+  auto& pixel_list = source->getProperty<PixelCoordinateList>();
   pixel_coordinates.reserve(pixel_list.size());
   for (auto& pixel : pixel_list) {
     pixel_coordinates.emplace_back(pixel, pixel);
@@ -33,7 +33,7 @@ std::vector<std::unique_ptr<SourceInterface>>
 MinAreaPartitionStep::partition(std::unique_ptr<SourceInterface> source) const {
   std::vector<std::unique_ptr<SourceInterface>> sources;
   auto& pixel_coordinate_list = source->getProperty<PixelCoordinateList>();
-  if (pixel_coordinate_list.getCoordinateList().size() >= m_min_pixel_count) {
+  if (pixel_coordinate_list.size() >= m_min_pixel_count) {
     sources.emplace_back(std::move(source));
   }
   return sources;
@@ -50,14 +50,19 @@ public:
     : m_pixel_list(pixel_list), m_is_split(false), m_threshold(threshold) {
   }
 
+  MultiThresholdNode(const PixelCoordinateList& pixel_list, SeFloat threshold)
+    : m_pixel_list(pixel_list.begin(), pixel_list.end()), m_is_split(false), m_threshold(threshold) {
+  }
+
   void addChild(std::shared_ptr<MultiThresholdNode> child) {
     m_children.push_back(child);
     child->m_parent = shared_from_this();
   }
 
   bool contains(const Lutz::PixelGroup& pixel_group) const {
+    auto first_pixel = pixel_group.front();
     for (auto pixel : m_pixel_list) {
-      if (pixel_group.pixel_list[0] == pixel) {
+      if (first_pixel == pixel) {
         return true;
       }
     }
@@ -130,7 +135,7 @@ private:
 std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::partition(
     std::unique_ptr<SourceInterface> original_source) const {
 
-  auto parent_source_id = original_source->getProperty<SourceId>().getSourceId();
+  auto detection_id = original_source->getProperty<SourceId>().getDetectionId();
 
   auto& detection_frame = original_source->getProperty<DetectionFrame>();
 
@@ -172,7 +177,7 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::parti
     for (auto& node : active_nodes_copy) {
       int nb_of_groups_inside = 0;
       for (auto& pixel_group : lutz.getGroups()) {
-        if (pixel_group.pixel_list.size() >= m_min_deblend_area && node->contains(pixel_group)) {
+        if (pixel_group.size() >= m_min_deblend_area && node->contains(pixel_group)) {
           nb_of_groups_inside++;
         }
       }
@@ -185,8 +190,8 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::parti
         active_nodes.remove(node);
         junction_nodes.push_back(node);
         for (auto& pixel_group : lutz.getGroups()) {
-          if (pixel_group.pixel_list.size() >= m_min_deblend_area && node->contains(pixel_group)) {
-            auto new_node = std::make_shared<MultiThresholdNode>(pixel_group.pixel_list, threshold);
+          if (pixel_group.size() >= m_min_deblend_area && node->contains(pixel_group)) {
+            auto new_node = std::make_shared<MultiThresholdNode>(PixelCoordinateList(pixel_group.pixel_spans), threshold);
             node->addChild(new_node);
             active_nodes.push_back(new_node);
           }
@@ -241,11 +246,16 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::parti
     sources.push_back(std::move(new_source));
   }
 
-  auto new_sources = reassignPixels(sources, pixel_coords, thumbnail_image, source_nodes, offset);
+  // Seeded per source, so the result does not depend on the order sources are partitioned,
+  // and partitions can run concurrently
+  boost::random::mt19937 rng(m_seed + offset.m_x + offset.m_y * 65521u);
+  auto new_sources = reassignPixels(sources, pixel_coords, thumbnail_image, source_nodes, offset, rng);
 
+  // Numbered after the detection (see SourceId)
+  auto source_id = detection_id;
   for (auto& new_source : new_sources) {
     new_source->setProperty<DetectionFrame>(detection_frame.getEncapsulatedFrame());
-    new_source->setProperty<SourceId>(parent_source_id);
+    new_source->setProperty<SourceId>(++source_id, detection_id);
   }
 
   return new_sources;
@@ -256,7 +266,8 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::reass
     const std::vector<PixelCoordinate>& pixel_coords,
     std::shared_ptr<VectorImage<DetectionImage::PixelType>> image,
     const std::vector<std::shared_ptr<MultiThresholdNode>>& source_nodes,
-    const PixelCoordinate& offset
+    const PixelCoordinate& offset,
+    boost::random::mt19937& rng
     ) const {
 
   std::vector<SeFloat> amplitudes;
@@ -310,8 +321,7 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::reass
       }
 
       if (probabilities.back() > 1.0e-31) {
-        auto drand = double(probabilities.back()) * boost::random::uniform_01<double>()
-            (const_cast<MultiThresholdPartitionStep*>(this)->m_rng);
+        auto drand = double(probabilities.back()) * boost::random::uniform_01<double>()(rng);
 
         unsigned int i=0;
         for (; i<probabilities.size() && drand >= probabilities[i]; i++);
@@ -353,6 +363,6 @@ std::vector<std::unique_ptr<SourceInterface>> MultiThresholdPartitionStep::reass
 MultiThresholdPartitionStep::MultiThresholdPartitionStep(std::shared_ptr<SourceFactory> source_factory, SeFloat contrast,
     unsigned int thresholds_nb, unsigned int min_deblend_area, unsigned int seed) :
   m_source_factory(source_factory), m_contrast(contrast), m_thresholds_nb(thresholds_nb),
-  m_min_deblend_area(min_deblend_area), m_seed(seed), m_rng(seed) {}
+  m_min_deblend_area(min_deblend_area), m_seed(seed) {}
 
 } // namespace
@@ -31,7 +31,7 @@
 #include "SEImplementation/Plugin/BlendedFlag/BlendedFlag.h"
 #include "SEImplementation/Plugin/SaturateFlag/SaturateFlag.h"
 #include <SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h>
-#include <SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h>
+#include <SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h>
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/Jacobian/Jacobian.h"
 #include "SEImplementation/Plugin/SourceIDs/SourceID.h"
@@ -47,13 +47,13 @@ namespace SourceXtractor {
 
 void AperturePhotometryTask::computeProperties(SourceInterface &source) const {
   const auto& measurement_frame_info = source.getProperty<MeasurementFrameInfo>(m_instance);
-  const auto& measurement_frame_images = source.getProperty<MeasurementFrameImages>(m_instance);
+  const auto& measurement_frame_cutout = source.getProperty<MeasurementFrameCutout>(m_instance);
 
   auto variance_threshold = measurement_frame_info.getVarianceThreshold();
   auto gain = measurement_frame_info.getGain();
 
-  const auto measurement_image = measurement_frame_images.getLockedImage(LayerSubtractedImage);
-  const auto variance_map = measurement_frame_images.getLockedImage(LayerVarianceMap);
+  const auto measurement_image = measurement_frame_cutout.getLockedImage(LayerSubtractedImage);
+  const auto variance_map = measurement_frame_cutout.getLockedImage(LayerVarianceMap);
 
   auto pixel_centroid = source.getProperty<MeasurementFramePixelCentroid>(m_instance);
 
@@ -114,15 +114,16 @@ void AperturePhotometryTask::computeProperties(SourceInterface &source) const {
   source.setIndexedProperty<AperturePhotometry>(m_instance, fluxes, fluxes_error, mags, mags_error, flags);
 
   // draw the apertures onto the checkimage
-  auto aperture_check_img = CheckImages::getInstance().getMeasurementApertureImage(m_instance);
-  if (aperture_check_img) {
+  auto aperture_check = CheckImages::getInstance().getMeasurementApertureAccumulator(m_instance);
+  if (aperture_check) {
     auto src_id = source.getProperty<SourceID>().getId();
     for (auto aperture_diameter : m_apertures) {
-    	auto aperture = std::make_shared<TransformedAperture>(std::make_shared<CircularAperture>(aperture_diameter / 2.),
-    			jacobian.asTuple());
-    		drawAperture<int>(aperture, centroid_x, centroid_y, aperture_check_img, static_cast<unsigned>(src_id));
+      auto aperture = std::make_shared<TransformedAperture>(std::make_shared<CircularAperture>(aperture_diameter / 2.),
+                                                            jacobian.asTuple());
+      PixelCoordinate corner;
+      auto stamp = drawApertureStamp<int>(aperture, centroid_x, centroid_y, static_cast<unsigned>(src_id), corner);
+      aperture_check->addStamp(corner.m_x, corner.m_y, stamp, CheckImageAccumulator<int>::Operation::PAINT);
     }
-
   }
 }
 
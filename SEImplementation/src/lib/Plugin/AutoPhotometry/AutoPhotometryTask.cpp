@@ -31,7 +31,7 @@
 #include "SEImplementation/Plugin/SaturateFlag/SaturateFlag.h"
 #include "SEImplementation/Plugin/AutoPhotometry/AutoPhotometryFlag.h"
 #include <SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h>
-#include <SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h>
+#include <SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h>
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/ShapeParameters/ShapeParameters.h"
 #include "SEImplementation/Plugin/KronRadius/KronRadius.h"
@@ -47,13 +47,13 @@ namespace SourceXtractor {
 
 void AutoPhotometryTask::computeProperties(SourceInterface &source) const {
   const auto& measurement_frame_info = source.getProperty<MeasurementFrameInfo>(m_instance);
-  const auto& measurement_frame_images = source.getProperty<MeasurementFrameImages>(m_instance);
+  const auto& measurement_frame_cutout = source.getProperty<MeasurementFrameCutout>(m_instance);
 
   auto variance_threshold = measurement_frame_info.getVarianceThreshold();
   auto gain = measurement_frame_info.getGain();
 
-  const auto measurement_image = measurement_frame_images.getLockedImage(LayerSubtractedImage);
-  const auto variance_map = measurement_frame_images.getLockedImage(LayerVarianceMap);
+  const auto measurement_image = measurement_frame_cutout.getLockedImage(LayerSubtractedImage);
+  const auto variance_map = measurement_frame_cutout.getLockedImage(LayerVarianceMap);
 
   // get the object center
   const auto& centroid_x = source.getProperty<MeasurementFramePixelCentroid>(m_instance).getCentroidX();
@@ -97,11 +97,13 @@ void AutoPhotometryTask::computeProperties(SourceInterface &source) const {
   source.setIndexedProperty<AutoPhotometry>(m_instance, measurement.m_flux, flux_error, mag, mag_error, measurement.m_flags);
 
   // Draw the aperture
-  auto aperture_check_img = CheckImages::getInstance().getMeasurementAutoApertureImage(m_instance);
-  if (aperture_check_img) {
+  auto aperture_check = CheckImages::getInstance().getMeasurementAutoApertureAccumulator(m_instance);
+  if (aperture_check) {
     auto src_id = source.getProperty<SourceID>().getId();
 
-    drawAperture<int>(ell_aper, centroid_x, centroid_y, aperture_check_img, static_cast<unsigned>(src_id));
+    PixelCoordinate corner;
+    auto stamp = drawApertureStamp<int>(ell_aper, centroid_x, centroid_y, static_cast<unsigned>(src_id), corner);
+    aperture_check->addStamp(corner.m_x, corner.m_y, stamp, CheckImageAccumulator<int>::Operation::PAINT);
   }
 }
 
@@ -38,7 +38,7 @@ std::vector<std::unique_ptr<SourceInterface>> CoreThresholdPartitionStep::partit
   const auto snr_image = source->getProperty<DetectionFrameImages>().getLockedImage(LayerSignalToNoiseMap);
 
   // go over all pixels
-  for (auto pixel_coord : source->getProperty<PixelCoordinateList>().getCoordinateList())
+  for (auto pixel_coord : source->getProperty<PixelCoordinateList>())
     // enhance the counter if the SNR is above the level
     if (snr_image->getValue(pixel_coord.m_x, pixel_coord.m_y) >= m_snr_level)
       n_snr_level += 1;
@@ -40,7 +40,7 @@ void DetectionFramePixelValuesTask::computeProperties(SourceInterface& source) c
 
   std::vector<DetectionImage::PixelType> values, filtered_values;
   std::vector<WeightImage::PixelType> variances;
-  for (auto pixel_coord : source.getProperty<PixelCoordinateList>().getCoordinateList()) {
+  for (auto pixel_coord : source.getProperty<PixelCoordinateList>()) {
     auto offset_coord = pixel_coord - offset;
     values.push_back(detection_image.getValue(offset_coord.m_x, offset_coord.m_y));
     filtered_values.push_back(filtered_image.getValue(offset_coord.m_x, offset_coord.m_y));
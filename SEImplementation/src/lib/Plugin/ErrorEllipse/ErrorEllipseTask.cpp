@@ -38,7 +38,7 @@ void ErrorEllipseTask::computeProperties(SourceInterface& source) const {
   const auto& pixel_variances = source.getProperty<DetectionFramePixelValues>().getVariances();
   const auto& centroid_x = source.getProperty<PixelCentroid>().getCentroidX();
   const auto& centroid_y = source.getProperty<PixelCentroid>().getCentroidY();
-  const auto& coordinates = source.getProperty<PixelCoordinateList>().getCoordinateList();
+  const auto& coordinates = source.getProperty<PixelCoordinateList>();
   auto total_intensity = source.getProperty<ShapeParameters>().getIntensity();
   auto singu = source.getProperty<ShapeParameters>().getSinguFlag();
 
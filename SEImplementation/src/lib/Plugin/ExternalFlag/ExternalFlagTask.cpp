@@ -59,7 +59,7 @@ void ExternalFlagTask<Combine>::computeProperties(SourceInterface &source) const
   }
 
   std::vector<FlagImage::PixelType> pixel_flags{};
-  for (auto& coords : source.getProperty<PixelCoordinateList>().getCoordinateList()) {
+  for (auto& coords : source.getProperty<PixelCoordinateList>()) {
     pixel_flags.push_back(flag_image_acc.getValue(coords.m_x, coords.m_y));
   }
   std::int64_t flag = 0;
@@ -61,14 +61,15 @@ FlexibleModelFittingIterativeTask::FlexibleModelFittingIterativeTask(const std::
     double meta_iteration_stop,
     size_t max_fit_size,
     WindowType window_type,
-    double ellipse_scale
+    double ellipse_scale,
+    bool batch_convolution
     )
     : m_least_squares_engine(least_squares_engine), m_max_iterations(max_iterations),
       m_modified_chi_squared_scale(modified_chi_squared_scale), m_scale_factor(scale_factor),
       m_meta_iterations(meta_iterations), m_deblend_factor(deblend_factor), m_meta_iteration_stop(meta_iteration_stop),
       m_max_fit_size(max_fit_size * max_fit_size), m_parameters(parameters), m_frames(frames), m_priors(priors),
       m_should_renormalize(should_renormalize),
-      m_window_type(window_type), m_ellipse_scale(ellipse_scale) {}
+      m_window_type(window_type), m_ellipse_scale(ellipse_scale), m_batch_convolution(batch_convolution) {}
 
 FlexibleModelFittingIterativeTask::~FlexibleModelFittingIterativeTask() {
 }
@@ -284,6 +285,7 @@ FlexibleModelFittingIterativeTask::createFrameModel(
   FrameModel<DownSampledImagePsf, std::shared_ptr<VectorImage<SourceXtractor::SeFloat>>> frame_model(
     pixel_scale, (size_t) stamp_rect.getWidth(), (size_t) stamp_rect.getHeight(),
     std::move(constant_models), std::move(point_models), std::move(extended_models), source_psf);
+  frame_model.setBatchConvolution(m_batch_convolution);
 
   return frame_model;
 }
@@ -807,37 +809,20 @@ void FlexibleModelFittingIterativeTask::updateCheckImages(SourceGroupInterface&
 
         auto weight_image = createWeightImage(src, frame_index);
 
-        {
-          auto debug_image = CheckImages::getInstance().getModelFittingImage(frame_index);
-          if (debug_image) {
-            ImageAccessor<SeFloat> debug_accessor(debug_image);
-            for (int x = 0; x < final_stamp->getWidth(); x++) {
-              for (int y = 0; y < final_stamp->getHeight(); y++) {
-                auto x_coord = stamp_rect.getTopLeft().m_x + x;
-                auto y_coord = stamp_rect.getTopLeft().m_y + y;
-                debug_image->setValue(x_coord, y_coord,
-                                      debug_accessor.getValue(x_coord, y_coord) + final_stamp->getValue(x, y));
-              }
-            }
-          }
+        auto debug_image = CheckImages::getInstance().getModelFittingAccumulator(frame_index);
+        if (debug_image) {
+          debug_image->addStamp(stamp_rect.getTopLeft().m_x, stamp_rect.getTopLeft().m_y, final_stamp);
         }
 
-        {
-          auto window_image = CheckImages::getInstance().getFittingWindowImage(frame_index);
-          if (window_image) {
-            ImageAccessor<int> window_accessor(window_image);
+        auto window_image = CheckImages::getInstance().getFittingWindowAccumulator(frame_index);
+        if (window_image) {
+          auto window_stamp = VectorImage<int>::create(final_stamp->getWidth(), final_stamp->getHeight());
+          for (int y = 0; y < final_stamp->getHeight(); y++) {
             for (int x = 0; x < final_stamp->getWidth(); x++) {
-              for (int y = 0; y < final_stamp->getHeight(); y++) {
-                auto x_coord = stamp_rect.getTopLeft().m_x + x;
-                auto y_coord = stamp_rect.getTopLeft().m_y + y;
-                if (weight_image->getValue(x, y) > 0.0) {
-                  window_image->setValue(x_coord, y_coord, window_accessor.getValue(x_coord, y_coord) + 2);
-                } else {
-                  window_image->setValue(x_coord, y_coord, window_accessor.getValue(x_coord, y_coord) + 1);
-                }
-              }
+              window_stamp->at(x, y) = weight_image->getValue(x, y) > 0.0 ? 2 : 1;
             }
           }
+          window_image->addStamp(stamp_rect.getTopLeft().m_x, stamp_rect.getTopLeft().m_y, window_stamp);
         }
 
       }
@@ -125,8 +125,11 @@ std::shared_ptr<ModelFitting::BasicParameter> createDependentParameterHelper(
                                        std::shared_ptr<Parameters>... parameters) {
 
   auto coordinate_system = source.getProperty<ReferenceCoordinates>().getCoordinateSystem();
-  auto calc = [value_calculator, coordinate_system] (decltype(doubleResolver(std::declval<Parameters>()))... params) -> double {
-    std::vector<double> materialized{params...};
+  // Each parameter gets its own copy of the buffer, so it can be reused between evaluations
+  std::vector<double> materialized(sizeof...(Parameters));
+  auto calc = [value_calculator, coordinate_system, materialized]
+      (decltype(doubleResolver(std::declval<Parameters>()))... params) mutable -> double {
+    materialized = {params...};
     return value_calculator(coordinate_system, materialized);
   };
   return createDependentParameter(calc, parameter_manager.getParameter(source, parameters)...);
@@ -70,10 +70,11 @@ FlexibleModelFittingTask::FlexibleModelFittingTask(const std::string &least_squa
     std::vector<std::shared_ptr<FlexibleModelFittingParameter>> parameters,
     std::vector<std::shared_ptr<FlexibleModelFittingFrame>> frames,
     std::vector<std::shared_ptr<FlexibleModelFittingPrior>> priors,
-    double scale_factor)
+    double scale_factor, bool batch_convolution)
   : m_least_squares_engine(least_squares_engine),
     m_max_iterations(max_iterations), m_modified_chi_squared_scale(modified_chi_squared_scale),
-    m_parameters(parameters), m_frames(frames), m_priors(priors), m_scale_factor(scale_factor) {}
+    m_parameters(parameters), m_frames(frames), m_priors(priors), m_scale_factor(scale_factor),
+    m_batch_convolution(batch_convolution) {}
 
 bool FlexibleModelFittingTask::isFrameValid(SourceGroupInterface& group, int frame_index) const {
   auto stamp_rect = group.getProperty<MeasurementFrameGroupRectangle>(frame_index);
@@ -166,6 +167,7 @@ FrameModel<ImagePsf, std::shared_ptr<VectorImage<SourceXtractor::SeFloat>>> Flex
   FrameModel<ImagePsf, std::shared_ptr<VectorImage<SourceXtractor::SeFloat>>> frame_model(
     pixel_scale, (size_t) stamp_rect.getWidth(), (size_t) stamp_rect.getHeight(),
     std::move(constant_models), std::move(point_models), std::move(extended_models), group_psf);
+  frame_model.setBatchConvolution(m_batch_convolution);
 
   return frame_model;
 }
@@ -354,17 +356,9 @@ void FlexibleModelFittingTask::updateCheckImages(SourceGroupInterface& group,
 
       auto stamp_rect = group.getProperty<MeasurementFrameGroupRectangle>(frame_index);
 
-      auto debug_image = CheckImages::getInstance().getModelFittingImage(frame_index);
+      auto debug_image = CheckImages::getInstance().getModelFittingAccumulator(frame_index);
       if (debug_image) {
-        ImageAccessor<SeFloat> debugAccessor(debug_image);
-        for (int x = 0; x < final_stamp->getWidth(); x++) {
-          for (int y = 0; y < final_stamp->getHeight(); y++) {
-            auto x_coord = stamp_rect.getTopLeft().m_x + x;
-            auto y_coord = stamp_rect.getTopLeft().m_y + y;
-            debug_image->setValue(x_coord, y_coord,
-                                  debugAccessor.getValue(x_coord, y_coord) + final_stamp->getValue(x, y));
-          }
-        }
+        debug_image->addStamp(stamp_rect.getTopLeft().m_x, stamp_rect.getTopLeft().m_y, final_stamp);
       }
     }
     frame_id++;
@@ -41,10 +41,12 @@ std::shared_ptr<Task> FlexibleModelFittingTaskFactory::createTask(const Property
     if (m_use_iterative_fitting) {
       return std::make_shared<FlexibleModelFittingIterativeTask>(m_least_squares_engine, m_max_iterations,
           m_modified_chi_squared_scale, m_parameters, m_frames, m_priors, m_should_renormalize, m_scale_factor,
-          m_meta_iterations, m_deblend_factor, m_meta_iteration_stop, m_max_fit_size, m_window_type, m_ellipse_scale);
+          m_meta_iterations, m_deblend_factor, m_meta_iteration_stop, m_max_fit_size, m_window_type, m_ellipse_scale,
+          m_batch_convolution);
     } else {
       return std::make_shared<FlexibleModelFittingTask>(m_least_squares_engine, m_max_iterations,
-          m_modified_chi_squared_scale, m_parameters, m_frames, m_priors, m_scale_factor);
+          m_modified_chi_squared_scale, m_parameters, m_frames, m_priors, m_scale_factor,
+          m_batch_convolution);
     }
   } else {
     return nullptr;
@@ -80,6 +82,7 @@ void FlexibleModelFittingTaskFactory::configure(Euclid::Configuration::ConfigMan
   m_meta_iteration_stop = model_fitting_config.getMetaIterationStop();
   m_window_type = model_fitting_config.getWindowType();
   m_ellipse_scale = model_fitting_config.getEllipseScale();
+  m_batch_convolution = model_fitting_config.getBatchConvolution();
 
   std::string approach;
   if (m_use_iterative_fitting) {
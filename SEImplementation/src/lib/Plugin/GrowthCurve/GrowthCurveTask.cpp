@@ -20,7 +20,7 @@
 #include "SEImplementation/Plugin/GrowthCurve/GrowthCurveTask.h"
 #include "SEImplementation/Plugin/Jacobian/Jacobian.h"
 #include "SEImplementation/Plugin/KronRadius/KronRadius.h"
-#include "SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
 #include "SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h"
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/ShapeParameters/ShapeParameters.h"
@@ -31,7 +31,6 @@ namespace SourceXtractor {
 
 using SExtractor::Mat22;
 
-static const SeFloat GROWTH_NSIG = 6.;
 static const size_t GROWTH_NSAMPLES = 64;
 
 static SeFloat getPixelValue(int x, int y, SeFloat centroid_x, SeFloat centroid_y,
@@ -65,12 +64,12 @@ GrowthCurveTask::GrowthCurveTask(unsigned instance, bool use_symmetry)
 
 void GrowthCurveTask::computeProperties(SourceInterface& source) const {
   const auto& measurement_frame_info = source.getProperty<MeasurementFrameInfo>(m_instance);
-  const auto& measurement_frame_images = source.getProperty<MeasurementFrameImages>(m_instance);
+  const auto& measurement_frame_cutout = source.getProperty<MeasurementFrameCutout>(m_instance);
 
   auto variance_threshold = measurement_frame_info.getVarianceThreshold();
 
-  const auto image = measurement_frame_images.getLockedImage(LayerSubtractedImage);
-  const auto variance_map = measurement_frame_images.getLockedImage(LayerVarianceMap);
+  const auto image = measurement_frame_cutout.getLockedImage(LayerSubtractedImage);
+  const auto variance_map = measurement_frame_cutout.getLockedImage(LayerVarianceMap);
 
   auto centroid_x = source.getProperty<MeasurementFramePixelCentroid>(m_instance).getCentroidX();
   auto centroid_y = source.getProperty<MeasurementFramePixelCentroid>(m_instance).getCentroidY();
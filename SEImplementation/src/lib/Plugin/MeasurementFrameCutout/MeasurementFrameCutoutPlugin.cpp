@@ -0,0 +1,41 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutPlugin.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "SEFramework/Plugin/StaticPlugin.h"
+
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutoutTaskFactory.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutoutPlugin.h"
+
+namespace SourceXtractor {
+
+static StaticPlugin<MeasurementFrameCutoutPlugin> measurement_frame_cutout_plugin;
+
+void MeasurementFrameCutoutPlugin::registerPlugin(PluginAPI& plugin_api) {
+  plugin_api.getTaskFactoryRegistry().registerTaskFactory<MeasurementFrameCutoutTaskFactory, MeasurementFrameCutout>();
+}
+
+std::string MeasurementFrameCutoutPlugin::getIdString() const {
+  return "MeasurementFrameCutout";
+}
+
+} // end of namespace SourceXtractor
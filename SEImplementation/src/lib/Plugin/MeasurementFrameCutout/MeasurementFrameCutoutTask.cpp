@@ -0,0 +1,87 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutTask.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+
+#include "SEFramework/Property/PropertyNotFoundException.h"
+#include "SEImplementation/Plugin/GrowthCurve/GrowthCurveTask.h"
+#include "SEImplementation/Plugin/Jacobian/Jacobian.h"
+#include "SEImplementation/Plugin/KronRadius/KronRadius.h"
+#include "SEImplementation/Plugin/MeasurementFrame/MeasurementFrame.h"
+#include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
+#include "SEImplementation/Plugin/ShapeParameters/ShapeParameters.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutoutTask.h"
+#include "SEUtils/Mat22.h"
+
+namespace SourceXtractor {
+
+using SExtractor::Mat22;
+
+void MeasurementFrameCutoutTask::computeProperties(SourceInterface& source) const {
+  auto frame = source.getProperty<MeasurementFrame>(m_instance).getFrame();
+  const auto& centroid = source.getProperty<MeasurementFramePixelCentroid>(m_instance);
+  Mat22 jacobian{source.getProperty<JacobianSource>(m_instance).asTuple()};
+
+  // Radius, on the detection frame, of the widest aperture
+  double detection_radius = m_max_aperture / 2.;
+  try {
+    const auto& shape = source.getProperty<ShapeParameters>();
+    auto kron_radius = source.getProperty<KronRadius>().getKronRadius();
+
+    // Growth curve
+    detection_radius = std::max<double>(detection_radius, std::max(GROWTH_NSIG * shape.getEllipseA(), kron_radius));
+
+    // Auto aperture, same extent as EllipticalAperture
+    double kron_auto = std::max(m_kron_factor * kron_radius, m_kron_minrad);
+    double cxx = shape.getEllipseCxx(), cyy = shape.getEllipseCyy(), cxy = shape.getEllipseCxy();
+    double dx = kron_auto * std::sqrt(1.0 / (cxx - cxy * cxy / (4.0 * cyy)));
+    double dy = kron_auto * std::sqrt(1.0 / (cyy - cxy * cxy / (4.0 * cxx)));
+    if (std::isfinite(dx) && std::isfinite(dy)) {
+      detection_radius = std::max(detection_radius, std::max(dx, dy));
+    }
+  }
+  catch (const PropertyNotFoundException&) {
+    // No shape measured on a detection frame: the stamp only covers the fixed apertures
+  }
+
+  // Transform into the measurement frame, using the longest axis after the transformation
+  Mat22 radius_22{detection_radius, 0, 0, detection_radius};
+  radius_22 = radius_22 * jacobian;
+  double r1 = radius_22[0] * radius_22[0] + radius_22[1] * radius_22[1];
+  double r2 = radius_22[2] * radius_22[2] + radius_22[3] * radius_22[3];
+  double radius = std::sqrt(std::max(r1, r2));
+
+  // The apertures bounding boxes are one pixel wider
+  int half_width = static_cast<int>(std::ceil(std::max(radius, m_vignet_size[0] / 2.))) + 2;
+  int half_height = static_cast<int>(std::ceil(std::max(radius, m_vignet_size[1] / 2.))) + 2;
+
+  int center_x = static_cast<int>(std::floor(centroid.getCentroidX()));
+  int center_y = static_cast<int>(std::floor(centroid.getCentroidY()));
+
+  source.setIndexedProperty<MeasurementFrameCutout>(
+    m_instance, frame,
+    PixelCoordinate(center_x - half_width, center_y - half_height),
+    PixelCoordinate(center_x + half_width, center_y + half_height));
+}
+
+} // end of namespace SourceXtractor
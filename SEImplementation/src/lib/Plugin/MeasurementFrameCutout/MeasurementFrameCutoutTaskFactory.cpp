@@ -0,0 +1,67 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MeasurementFrameCutoutTaskFactory.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+
+#include "SEImplementation/Configuration/MeasurementImageConfig.h"
+#include "SEImplementation/Plugin/AperturePhotometry/AperturePhotometryConfig.h"
+#include "SEImplementation/Plugin/AutoPhotometry/AutoPhotometryConfig.h"
+#include "SEImplementation/Plugin/Vignet/VignetConfig.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutoutTask.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutoutTaskFactory.h"
+
+namespace SourceXtractor {
+
+void MeasurementFrameCutoutTaskFactory::reportConfigDependencies(Euclid::Configuration::ConfigManager& manager) const {
+  manager.registerConfiguration<AperturePhotometryConfig>();
+  manager.registerConfiguration<AutoPhotometryConfig>();
+  manager.registerConfiguration<VignetConfig>();
+  manager.registerConfiguration<MeasurementImageConfig>();
+}
+
+void MeasurementFrameCutoutTaskFactory::configure(Euclid::Configuration::ConfigManager& manager) {
+  const auto& aperture_config = manager.getConfiguration<AperturePhotometryConfig>();
+  for (const auto& apertures : aperture_config.getApertures()) {
+    auto max_aperture = std::max_element(apertures.second.begin(), apertures.second.end());
+    m_max_aperture[apertures.first] = max_aperture != apertures.second.end() ? *max_aperture : 0.f;
+  }
+
+  const auto& auto_config = manager.getConfiguration<AutoPhotometryConfig>();
+  m_kron_factor = auto_config.getAutoKronFactor();
+  m_kron_minrad = auto_config.getAutoKronMinrad();
+
+  m_vignet_size = manager.getConfiguration<VignetConfig>().getVignetSize();
+}
+
+std::shared_ptr<Task> MeasurementFrameCutoutTaskFactory::createTask(const PropertyId& property_id) const {
+  if (property_id.getTypeId() == PropertyId::create<MeasurementFrameCutout>().getTypeId()) {
+    auto instance = property_id.getIndex();
+    auto max_aperture = m_max_aperture.find(instance);
+    return std::make_shared<MeasurementFrameCutoutTask>(
+      instance, max_aperture != m_max_aperture.end() ? max_aperture->second : 0.f,
+      m_kron_factor, m_kron_minrad, m_vignet_size);
+  }
+  return nullptr;
+}
+
+} // end of namespace SourceXtractor
@@ -160,7 +160,7 @@ void MoffatModelFittingTask::computeProperties(SourceInterface& source) const {
   // Computes the minimum flux that a detection should have (min. detection threshold for every pixel)
   // This will be used instead of lower or negative fluxes that can happen for various reasons
   double min_flux = 0.;
-  auto& pixel_coordinates = source.getProperty<PixelCoordinateList>().getCoordinateList();
+  auto& pixel_coordinates = source.getProperty<PixelCoordinateList>();
   for (auto pixel : pixel_coordinates) {
     pixel -= stamp_top_left;
 
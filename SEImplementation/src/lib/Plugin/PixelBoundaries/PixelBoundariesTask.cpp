@@ -36,7 +36,7 @@ void PixelBoundariesTask::computeProperties(SourceInterface& source) const {
   int max_x = INT_MIN;
   int max_y = INT_MIN;
 
-  for (auto pixel_coord : source.getProperty<PixelCoordinateList>().getCoordinateList()) {
+  for (auto pixel_coord : source.getProperty<PixelCoordinateList>()) {
     min_x = std::min(min_x, pixel_coord.m_x);
     min_y = std::min(min_y, pixel_coord.m_y);
     max_x = std::max(max_x, pixel_coord.m_x);
@@ -56,7 +56,7 @@ void PixelBoundariesTaskHalfMaximum::computeProperties(SourceInterface& source)
   int max_y_half = INT_MIN;
 
   auto i = pixel_values.begin();
-  for (auto pixel_coord : source.getProperty<PixelCoordinateList>().getCoordinateList()) {
+  for (auto pixel_coord : source.getProperty<PixelCoordinateList>()) {
     SeFloat value = *i++;
 
     if (value >= half_maximum) {
@@ -38,7 +38,7 @@ void PixelCentroidTask::computeProperties(SourceInterface& source) const {
   double total_value = 0.0;
 
   auto i = pixel_values.begin();
-  for (auto pixel_coord : source.getProperty<PixelCoordinateList>().getCoordinateList()) {
+  for (auto pixel_coord : source.getProperty<PixelCoordinateList>()) {
     pixel_coord -= min_coord;
     SeFloat value = *i++;
 
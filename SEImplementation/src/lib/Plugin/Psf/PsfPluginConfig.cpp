@@ -42,6 +42,8 @@ namespace SourceXtractor {
 static const std::string PSF_FILE{"psf-filename"};
 static const std::string PSF_FWHM {"psf-fwhm" };
 static const std::string PSF_PIXEL_SAMPLING {"psf-pixel-sampling" };
+static const std::string PSF_CACHE_CELL_SIZE {"psf-cache-cell-size" };
+static const std::string PSF_CACHE_MEMORY {"psf-cache-memory" };
 
 /*
  * Reading in a stacked PSF as it is being developed for co-added images in Euclid
@@ -231,7 +233,12 @@ std::map<std::string, Configuration::OptionDescriptionList> PsfPluginConfig::get
     {PSF_FWHM.c_str(), po::value<double>(),
        "Generate a gaussian PSF with the given full-width half-maximum (in pixels)"},
     {PSF_PIXEL_SAMPLING.c_str(), po::value<double>(),
-        "Generate a gaussian PSF with the given pixel sampling step size"}
+        "Generate a gaussian PSF with the given pixel sampling step size"},
+    {PSF_CACHE_CELL_SIZE.c_str(), po::value<double>()->default_value(0.),
+        "Evaluate variable PSFs once per cell of this size (in pixels) of their position components, "
+        "and reuse the result. 0 disables the cache"},
+    {PSF_CACHE_MEMORY.c_str(), po::value<int>()->default_value(64),
+        "Maximum memory used by the variable PSF cache, in MB"}
   }}};
 }
 
@@ -244,13 +251,27 @@ void PsfPluginConfig::preInitialize(const Euclid::Configuration::Configuration::
 }
 
 void PsfPluginConfig::initialize(const UserValues &args) {
+  if (args.find(PSF_CACHE_CELL_SIZE) != args.end()) {
+    m_cache_cell_size = args.find(PSF_CACHE_CELL_SIZE)->second.as<double>();
+    if (m_cache_cell_size < 0) {
+      throw Elements::Exception() << "Invalid " << PSF_CACHE_CELL_SIZE << " value: " << m_cache_cell_size;
+    }
+  }
+  if (args.find(PSF_CACHE_MEMORY) != args.end()) {
+    auto cache_memory = args.find(PSF_CACHE_MEMORY)->second.as<int>();
+    if (cache_memory < 0) {
+      throw Elements::Exception() << "Invalid " << PSF_CACHE_MEMORY << " value: " << cache_memory;
+    }
+    m_cache_max_bytes = static_cast<size_t>(cache_memory) * 1024 * 1024;
+  }
+
   if (args.find(PSF_FILE) != args.end()) {
     auto psf_file = args.find(PSF_FILE)->second.as<std::string>();
     logger.debug() << "Provided by user: " << psf_file;
     if (boost::to_upper_copy(psf_file) == "NOPSF"){
       m_vpsf = nullptr;
     } else {
-      m_vpsf = readPsf(args.find(PSF_FILE)->second.as<std::string>());
+      m_vpsf = loadPsf(args.find(PSF_FILE)->second.as<std::string>());
     }
   } else if (args.find(PSF_FWHM) != args.end()) {
     m_vpsf = generateGaussianPsf(args.find(PSF_FWHM)->second.as<double>(),
@@ -262,4 +283,18 @@ const std::shared_ptr<Psf>& PsfPluginConfig::getPsf() const {
   return m_vpsf;
 }
 
+std::shared_ptr<Psf> PsfPluginConfig::loadPsf(const std::string &filename, int hdu_number) const {
+  auto psf = readPsf(filename, hdu_number);
+  setupCache(psf);
+  return psf;
+}
+
+void PsfPluginConfig::setupCache(const std::shared_ptr<Psf>& psf) const {
+  auto variable_psf = std::dynamic_pointer_cast<VariablePsf>(psf);
+  if (variable_psf && m_cache_cell_size > 0 && !variable_psf->getComponents().empty()) {
+    logger.debug() << "Caching variable PSF with a cell size of " << m_cache_cell_size;
+    variable_psf->setCache(m_cache_cell_size, m_cache_max_bytes);
+  }
+}
+
 } // end SourceXtractor
@@ -39,7 +39,7 @@ void ShapeParametersTask::computeProperties(SourceInterface& source) const {
   const auto& centroid_y = source.getProperty<PixelCentroid>().getCentroidY();
   auto min_value = source.getProperty<PeakValue>().getMinValue();
   auto peak_value = source.getProperty<PeakValue>().getMaxValue();
-  auto& coordinates = source.getProperty<PixelCoordinateList>().getCoordinateList();
+  auto& coordinates = source.getProperty<PixelCoordinateList>();
 
   SeFloat x_2 = 0.0;
   SeFloat y_2 = 0.0;
@@ -35,7 +35,7 @@ void SourcePsfTaskFactory::configure(Euclid::Configuration::ConfigManager& manag
   for (unsigned int i = 0; i < image_infos.size(); i++) {
     if (!image_infos[i].m_psf_path.empty()) {
       m_psf_infos[image_infos[i].m_id] = {
-          PsfPluginConfig::readPsf(image_infos[i].m_psf_path, image_infos[i].m_psf_hdu),
+          psf_config.loadPsf(image_infos[i].m_psf_path, image_infos[i].m_psf_hdu),
           image_infos[i].m_psf_renormalize
       };
     }
@@ -25,7 +25,7 @@
 #include "SEImplementation/Property/PixelCoordinateList.h"
 #include <SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h>
 #include <SEImplementation/Plugin/MeasurementFrameCoordinates/MeasurementFrameCoordinates.h>
-#include <SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h>
+#include <SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h>
 #include "SEImplementation/Plugin/PixelCentroid/PixelCentroid.h"
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/DetectionFrameCoordinates/DetectionFrameCoordinates.h"
@@ -37,12 +37,12 @@
 namespace SourceXtractor {
 void VignetSourceTask::computeProperties(SourceInterface& source) const {
   const auto& measurement_frame_info = source.getProperty<MeasurementFrameInfo>(m_instance);
-  const auto& measurement_frame_images = source.getProperty<MeasurementFrameImages>(m_instance);
+  const auto& measurement_frame_cutout = source.getProperty<MeasurementFrameCutout>(m_instance);
 
   auto measurement_var_threshold = measurement_frame_info.getVarianceThreshold();
 
-  const auto measurement_sub_image = measurement_frame_images.getLockedImage(LayerSubtractedImage);
-  const auto measurement_var_image = measurement_frame_images.getLockedImage(LayerVarianceMap);
+  const auto measurement_sub_image = measurement_frame_cutout.getLockedImage(LayerSubtractedImage);
+  const auto measurement_var_image = measurement_frame_cutout.getLockedImage(LayerVarianceMap);
 
   // neighbor masking from the detection image
   const auto& detection_frame_images = source.getProperty<DetectionFrameImages>();
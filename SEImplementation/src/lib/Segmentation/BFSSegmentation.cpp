@@ -15,6 +15,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <list>
@@ -41,13 +42,24 @@ void BFSSegmentation::labelImage(Segmentation::LabellingListener& listener,
   auto detection_image = frame->getThresholdedImage();
   auto tiles = getTiles(*detection_image);
 
-  VisitedMap visited(detection_image->getWidth(), detection_image->getHeight());
+  // As with Lutz, sources are cut at the border of the region
+  auto region = getRegion(detection_image->getWidth(), detection_image->getHeight());
+  auto region_min = region.getTopLeft(), region_max = region.getBottomRight();
+  VisitedMap visited(region);
 
   for (auto& tile : tiles) {
-    auto chunk = detection_image->getChunk(tile.offset.m_x, tile.offset.m_y, tile.width, tile.height);
-    for (int y=0; y<tile.height; y++) {
-      for (int x=0; x<tile.width; x++) {
-        PixelCoordinate pixel =  tile.offset + PixelCoordinate(x,y);
+    PixelCoordinate tile_min(std::max(tile.offset.m_x, region_min.m_x), std::max(tile.offset.m_y, region_min.m_y));
+    PixelCoordinate tile_max(std::min(tile.offset.m_x + tile.width - 1, region_max.m_x),
+                             std::min(tile.offset.m_y + tile.height - 1, region_max.m_y));
+    if (tile_min.m_x > tile_max.m_x || tile_min.m_y > tile_max.m_y) {
+      continue;
+    }
+    int width = tile_max.m_x - tile_min.m_x + 1, height = tile_max.m_y - tile_min.m_y + 1;
+
+    auto chunk = detection_image->getChunk(tile_min.m_x, tile_min.m_y, width, height);
+    for (int y=0; y<height; y++) {
+      for (int x=0; x<width; x++) {
+        PixelCoordinate pixel =  tile_min + PixelCoordinate(x,y);
         if (!visited.wasVisited(pixel) && chunk->getValue(x, y) > 0.0) {
           labelSource(pixel, listener, *detection_image, visited);
         }
@@ -100,6 +112,11 @@ void BFSSegmentation::labelSource(PixelCoordinate pc,
     }
   }
 
+  // Row-major order, so the pixels can be stored as spans
+  std::sort(source_pixels.begin(), source_pixels.end(), [](const PixelCoordinate& a, const PixelCoordinate& b) {
+    return a.m_y < b.m_y || (a.m_y == b.m_y && a.m_x < b.m_x);
+  });
+
   auto source = m_source_factory->createSource();
   source->setProperty<PixelCoordinateList>(source_pixels);
   source->setProperty<SourceId>();
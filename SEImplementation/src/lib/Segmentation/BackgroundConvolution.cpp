@@ -31,22 +31,47 @@ namespace SourceXtractor {
 
 Elements::Logging logger = Elements::Logging::getLogger("Segmentation");
 
+/// Each tile is convolved with a margin around it, which would dominate the cost of thin strips
+static std::shared_ptr<DetectionImage> createConvolvedImage(std::shared_ptr<const ImageSource> source) {
+  auto image = BufferedImage<DetectionImage::PixelType>::create(std::move(source));
+  image->setAccessPattern(TileManager::AccessPattern::CUTOUTS);
+  return image;
+}
+
 std::shared_ptr<DetectionImage>
 BackgroundConvolution::processImage(std::shared_ptr<DetectionImage> image, std::shared_ptr<DetectionImage> variance,
                                     SeFloat threshold) const {
 
   if (m_convolution_filter->getWidth() > 5) {
     logger.debug() << "Using DFT algorithm for the image convolution";
-    return BufferedImage<DetectionImage::PixelType>::create(
+    return createConvolvedImage(
       std::make_shared<BgDFTConvolutionImageSource>(image, variance, threshold, m_convolution_filter)
     );
   }
   logger.debug() << "Using direct algorithm for the image convolution";
-  return BufferedImage<DetectionImage::PixelType>::create(
+  return createConvolvedImage(
     std::make_shared<BgConvolutionImageSource>(image, variance, threshold, m_convolution_filter)
   );
 }
 
+std::pair<std::shared_ptr<DetectionImage>, std::shared_ptr<DetectionImage>>
+BackgroundConvolution::processImageAndVariance(std::shared_ptr<DetectionImage> image,
+                                               std::shared_ptr<DetectionImage> variance,
+                                               SeFloat threshold) const {
+  if (m_convolution_filter->getWidth() <= 5) {
+    return DetectionImageFrame::ImageFilter::processImageAndVariance(image, variance, threshold);
+  }
+
+  // The image and the variance share the masking, and are transformed together
+  logger.debug() << "Using DFT algorithm for the image and variance convolution";
+  auto filter = std::make_shared<MaskedDFTFilter>(image, variance, threshold, m_convolution_filter,
+                                                  true, m_prefetch_threads);
+  return std::make_pair(
+    createConvolvedImage(std::make_shared<BgDFTConvolutionImageSource>(filter, MaskedDFTFilter::Output::IMAGE)),
+    createConvolvedImage(std::make_shared<BgDFTConvolutionImageSource>(filter, MaskedDFTFilter::Output::VARIANCE))
+  );
+}
+
 void BackgroundConvolution::normalize() {
   double total = 0;
 
@@ -134,7 +134,7 @@ void Lutz::labelImage(LutzListener& listener, const DetectionImage& image, Pixel
             group_stack.back().start = -1;
           } else {
             // Add group to current group
-            auto prev_group = inc_group_map.at(x);
+            auto prev_group = std::move(inc_group_map.at(x));
             inc_group_map.erase(x);
 
             group_stack.back().merge_pixel_list(prev_group);
@@ -180,7 +180,7 @@ void Lutz::labelImage(LutzListener& listener, const DetectionImage& image, Pixel
               listener.publishGroup(old_group);
             } else {
               marker[old_group.end] = LutzMarker::F;
-              inc_group_map[old_group.start] = old_group;
+              inc_group_map[old_group.start] = std::move(old_group);
             }
             ps = ps_stack.back();
             ps_stack.pop_back();
@@ -190,7 +190,7 @@ void Lutz::labelImage(LutzListener& listener, const DetectionImage& image, Pixel
 
       if (in_object) {
         // Update current group by current pixel
-        group_stack.back().pixel_list.push_back(PixelCoordinate(x, y) + offset);
+        group_stack.back().addPixel(PixelCoordinate(x, y) + offset);
 
       } else {
         // The current pixel is not object
@@ -210,10 +210,10 @@ void Lutz::labelImage(LutzListener& listener, const DetectionImage& image, Pixel
 
             marker[x] = LutzMarker::F;
 
-            auto old_group = group_stack.back();
+            auto old_group = std::move(group_stack.back());
             group_stack.pop_back();
 
-            inc_group_map[old_group.start] = old_group;
+            inc_group_map[old_group.start] = std::move(old_group);
           }
         }
       }
@@ -229,7 +229,7 @@ void Lutz::labelImage(LutzListener& listener, const DetectionImage& image, Pixel
 }
 
 void LutzList::publishGroup(PixelGroup& pixel_group) {
-  m_groups.push_back(pixel_group);
+  m_groups.push_back(std::move(pixel_group));
 }
 
 
@@ -23,6 +23,7 @@
 
 #include "SEFramework/Image/Image.h"
 #include "SEFramework/Image/ProcessedImage.h"
+#include "SEFramework/Image/SubImage.h"
 #include "SEFramework/Source/SourceWithOnDemandProperties.h"
 
 #include "SEImplementation/Measurement/MultithreadedMeasurement.h"
@@ -40,16 +41,17 @@ namespace {
 class LutzLabellingListener : public Lutz::LutzListener {
 public:
   LutzLabellingListener(Segmentation::LabellingListener& listener, std::shared_ptr<SourceFactory> source_factory,
-      int window_size) :
+      int window_size, int line_offset) :
     m_listener(listener),
     m_source_factory(source_factory),
-    m_window_size(window_size) {}
+    m_window_size(window_size),
+    m_line_offset(line_offset) {}
 
   virtual ~LutzLabellingListener() = default;
 
   void publishGroup(Lutz::PixelGroup& pixel_group) override {
     auto source = m_source_factory->createSource();
-    source->setProperty<PixelCoordinateList>(pixel_group.pixel_list);
+    source->setProperty<PixelCoordinateList>(std::move(pixel_group.pixel_spans));
     source->setProperty<SourceId>();
     m_listener.publishSource(std::move(source));
   }
@@ -59,7 +61,7 @@ public:
 
     if (m_window_size > 0 && line > m_window_size) {
       m_listener.requestProcessing(
-        ProcessSourcesEvent(std::make_shared<LineSelectionCriteria>(line - m_window_size))
+        ProcessSourcesEvent(std::make_shared<LineSelectionCriteria>(line + m_line_offset - m_window_size))
       );
     }
   }
@@ -68,6 +70,7 @@ private:
   Segmentation::LabellingListener& m_listener;
   std::shared_ptr<SourceFactory> m_source_factory;
   int m_window_size;
+  int m_line_offset;
 };
 
 }
@@ -78,8 +81,18 @@ private:
 
 void LutzSegmentation::labelImage(Segmentation::LabellingListener& listener, std::shared_ptr<const DetectionImageFrame> frame) {
   Lutz lutz;
-  LutzLabellingListener lutz_listener(listener, m_source_factory, m_window_size);
-  lutz.labelImage(lutz_listener, *frame->getThresholdedImage());
+  auto thresholded = frame->getThresholdedImage();
+  auto region = getRegion(thresholded->getWidth(), thresholded->getHeight());
+  auto offset = region.getTopLeft();
+  LutzLabellingListener lutz_listener(listener, m_source_factory, m_window_size, offset.m_y);
+  if (region.getWidth() == thresholded->getWidth() && region.getHeight() == thresholded->getHeight()) {
+    lutz.labelImage(lutz_listener, *thresholded);
+  }
+  else {
+    auto sub_image = SubImage<DetectionImage::PixelType>::create(thresholded, offset,
+                                                                 region.getWidth(), region.getHeight());
+    lutz.labelImage(lutz_listener, *sub_image, offset);
+  }
 }
 
 } // Segmentation namespace
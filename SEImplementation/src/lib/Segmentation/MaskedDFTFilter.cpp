@@ -0,0 +1,324 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * MaskedDFTFilter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+
+#include "SEFramework/FFT/FFT.h"
+#include "SEFramework/Image/PaddedImage.h"
+#include "SEFramework/Image/RecenterImage.h"
+#include "SEImplementation/Segmentation/MaskedDFTFilter.h"
+
+namespace SourceXtractor {
+
+/// Maximum number of filtered tiles kept waiting to be consumed
+static const size_t MAX_STASHED_TILES = 64;
+
+MaskedDFTFilter::MaskedDFTFilter(std::shared_ptr<Image<SeFloat>> image, std::shared_ptr<Image<SeFloat>> variance,
+                                 SeFloat threshold, std::shared_ptr<VectorImage<SeFloat>> kernel,
+                                 bool filter_variance, unsigned prefetch_threads)
+  : m_image(std::move(image)), m_variance(std::move(variance)), m_threshold(threshold), m_kernel(std::move(kernel)),
+    m_filter_variance(filter_variance), m_stop(false) {
+  for (unsigned i = 0; i < prefetch_threads; ++i) {
+    m_prefetch_threads.emplace_back(&MaskedDFTFilter::prefetchLoop, this);
+  }
+}
+
+MaskedDFTFilter::~MaskedDFTFilter() {
+  {
+    std::lock_guard<std::mutex> lock(m_stash_mutex);
+    m_stop = true;
+  }
+  m_prefetch_cv.notify_all();
+  for (auto& thread : m_prefetch_threads) {
+    thread.join();
+  }
+}
+
+void MaskedDFTFilter::generateTile(Output output, ImageTileWithType<SeFloat>& tile,
+                                   int x, int y, int width, int height) {
+  TileKey key{x, y, width, height};
+  TileFuture future;
+  std::shared_ptr<TilePromise> own;
+
+  {
+    std::lock_guard<std::mutex> lock(m_stash_mutex);
+    auto entry = m_stash.find(key);
+    if (entry != m_stash.end() && !entry->second.m_consumed[static_cast<int>(output)]) {
+      future = entry->second.m_future;
+      // Nobody has started, so do it here rather than waiting for a prefetch thread
+      own = std::move(entry->second.m_pending);
+      entry->second.m_consumed[static_cast<int>(output)] = true;
+      if (!m_filter_variance || entry->second.m_consumed[1 - static_cast<int>(output)]) {
+        m_stash.erase(entry);
+      }
+    }
+    else {
+      own = std::make_shared<TilePromise>();
+      future = own->get_future().share();
+      // Keep the result for the other output. Tiles requested again after having been consumed
+      // (i.e. evicted from the tile manager) are not stashed.
+      if (m_filter_variance && entry == m_stash.end()) {
+        StashEntry new_entry{future, nullptr, {false, false}};
+        new_entry.m_consumed[static_cast<int>(output)] = true;
+        m_stash.emplace(key, std::move(new_entry));
+        m_stash_order.emplace_back(key);
+      }
+    }
+
+    // Filter ahead the tile below
+    if (!m_prefetch_threads.empty() && y + height < m_image->getHeight()) {
+      schedulePrefetch(TileKey{x, y + height, width, std::min(height, m_image->getHeight() - y - height)});
+    }
+    trimStash();
+  }
+
+  if (own) {
+    run(this, key, *own);
+  }
+
+  auto filtered = future.get();
+  auto& data = tile.getImage()->getData();
+  const auto& values = filtered->m_outputs[static_cast<int>(output)];
+  std::copy(values.begin(), values.end(), data.begin());
+}
+
+void MaskedDFTFilter::schedulePrefetch(const TileKey& key) {
+  if (m_stash.count(key)) {
+    return;
+  }
+  auto promise = std::make_shared<TilePromise>();
+  StashEntry entry{promise->get_future().share(), promise, {false, !m_filter_variance}};
+  m_stash.emplace(key, std::move(entry));
+  m_stash_order.emplace_back(key);
+  m_prefetch_queue.emplace_back(key);
+  m_prefetch_cv.notify_one();
+}
+
+void MaskedDFTFilter::trimStash() {
+  // Drop the oldest entries that are done, or that nobody started
+  while (m_stash.size() > MAX_STASHED_TILES && !m_stash_order.empty()) {
+    auto key = m_stash_order.front();
+    m_stash_order.pop_front();
+    auto entry = m_stash.find(key);
+    if (entry == m_stash.end()) {
+      continue;
+    }
+    if (entry->second.m_pending ||
+        entry->second.m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+      m_stash.erase(entry);
+    }
+    else {
+      m_stash_order.emplace_back(key);
+      break;
+    }
+  }
+  // Keys already consumed have no entry anymore
+  if (m_stash_order.size() > 2 * MAX_STASHED_TILES) {
+    m_stash_order.erase(std::remove_if(m_stash_order.begin(), m_stash_order.end(), [this](const TileKey& key) {
+      return m_stash.count(key) == 0;
+    }), m_stash_order.end());
+  }
+}
+
+void MaskedDFTFilter::prefetchLoop() {
+  while (true) {
+    TileKey key;
+    std::shared_ptr<TilePromise> promise;
+    {
+      std::unique_lock<std::mutex> lock(m_stash_mutex);
+      m_prefetch_cv.wait(lock, [this]() { return m_stop || !m_prefetch_queue.empty(); });
+      if (m_stop) {
+        break;
+      }
+      key = m_prefetch_queue.front();
+      m_prefetch_queue.pop_front();
+      auto entry = m_stash.find(key);
+      // It may have been taken over by a consumer, or evicted
+      if (entry == m_stash.end() || !entry->second.m_pending) {
+        continue;
+      }
+      promise = std::move(entry->second.m_pending);
+    }
+    run(this, key, *promise);
+  }
+}
+
+void MaskedDFTFilter::run(const MaskedDFTFilter* filter, const TileKey& key, TilePromise& promise) {
+  try {
+    promise.set_value(filter->filter(key));
+  }
+  catch (...) {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+std::shared_ptr<const std::vector<SeFloat>> MaskedDFTFilter::getKernelTransform(int padded_width,
+                                                                                int padded_height) const {
+  auto key = std::make_pair(padded_width, padded_height);
+  {
+    boost::shared_lock<boost::shared_mutex> read_lock(m_kernel_mutex);
+    auto i = m_kernel_transforms.find(key);
+    if (i != m_kernel_transforms.end()) {
+      return i->second;
+    }
+  }
+
+  // Same centering as DFTConvolution, so the results are equivalent
+  auto padded = PaddedImage<SeFloat>::create(m_kernel, padded_width, padded_height);
+  auto center = PixelCoordinate{padded_width / 2, padded_height / 2};
+  if (padded_width % 2 == 0) center.m_x--;
+  if (padded_height % 2 == 0) center.m_y--;
+  auto recenter = RecenterImage<SeFloat>::create(padded, center);
+  auto chunk = recenter->getChunk(0, 0, padded_width, padded_height);
+
+  auto transform = std::make_shared<std::vector<SeFloat>>();
+  auto plan = FFT<SeFloat>::createComplexPlan(padded_width, padded_height, false, *transform);
+  std::fill(transform->begin(), transform->end(), 0.f);
+  for (int y = 0; y < padded_height; ++y) {
+    auto row = chunk->getRowPtr(y);
+    for (int x = 0; x < padded_width; ++x) {
+      (*transform)[2 * (x + y * padded_width)] = row[x];
+    }
+  }
+  FFT<SeFloat>::executeComplex(plan, *transform);
+
+  boost::lock_guard<boost::shared_mutex> write_lock(m_kernel_mutex);
+  return m_kernel_transforms.emplace(key, std::move(transform)).first->second;
+}
+
+std::shared_ptr<const MaskedDFTFilter::FilteredTile> MaskedDFTFilter::filter(const TileKey& key) const {
+  int start_x, start_y, width, height;
+  std::tie(start_x, start_y, width, height) = key;
+
+  int hx = m_kernel->getWidth() / 2;
+  int hy = m_kernel->getHeight() / 2;
+  int clip_x = std::max(start_x - hx, 0);
+  int clip_y = std::max(start_y - hy, 0);
+  int clip_w = std::min(width + hx * 2, m_image->getWidth() - clip_x);
+  int clip_h = std::min(height + hy * 2, m_image->getHeight() - clip_y);
+
+  auto image_chunk = m_image->getChunk(clip_x, clip_y, clip_w, clip_h);
+  auto variance_chunk = m_variance->getChunk(clip_x, clip_y, clip_w, clip_h);
+
+  // The image is placed at the origin, the zero padding on the right and bottom avoids the wrap-around
+  int padded_width = fftRoundDimension(clip_w + m_kernel->getWidth() - 1);
+  int padded_height = fftRoundDimension(clip_h + m_kernel->getHeight() - 1);
+  auto kernel_transform = getKernelTransform(padded_width, padded_height);
+  const SeFloat* kernel = kernel_transform->data();
+
+  // Real part: masked image. Imaginary part: masked variance if requested, the mask otherwise.
+  std::vector<SeFloat> packed;
+  auto packed_plan = FFT<SeFloat>::createComplexPlan(padded_width, padded_height, false, packed);
+  auto packed_inv_plan = FFT<SeFloat>::createComplexPlan(padded_width, padded_height, true, packed);
+  std::fill(packed.begin(), packed.end(), 0.f);
+
+  // Real transform for the mask, only needed when the variance is filtered too
+  std::vector<SeFloat> mask;
+  int mask_stride = 2 * (padded_width / 2 + 1);
+  FFT<SeFloat>::plan_ptr_t mask_plan, mask_inv_plan;
+  if (m_filter_variance) {
+    mask_plan = FFT<SeFloat>::createForwardPlan(padded_width, padded_height, mask);
+    mask_inv_plan = FFT<SeFloat>::createInversePlan(padded_width, padded_height, mask);
+    std::fill(mask.begin(), mask.end(), 0.f);
+  }
+
+  for (int y = 0; y < clip_h; ++y) {
+    auto image_row = image_chunk->getRowPtr(y);
+    auto variance_row = variance_chunk->getRowPtr(y);
+    auto packed_row = packed.data() + 2 * y * padded_width;
+    for (int x = 0; x < clip_w; ++x) {
+      bool valid = variance_row[x] < m_threshold;
+      packed_row[2 * x] = valid ? image_row[x] : 0.f;
+      if (m_filter_variance) {
+        packed_row[2 * x + 1] = valid ? variance_row[x] : 0.f;
+        mask[x + y * mask_stride] = valid;
+      }
+      else {
+        packed_row[2 * x + 1] = valid;
+      }
+    }
+  }
+
+  // Convolve
+  FFT<SeFloat>::executeComplex(packed_plan, packed);
+  size_t ncomplex = static_cast<size_t>(padded_width) * padded_height;
+  for (size_t i = 0; i < ncomplex; ++i) {
+    SeFloat a = packed[2 * i], b = packed[2 * i + 1];
+    SeFloat c = kernel[2 * i], d = kernel[2 * i + 1];
+    packed[2 * i] = a * c - b * d;
+    packed[2 * i + 1] = a * d + b * c;
+  }
+  FFT<SeFloat>::executeComplex(packed_inv_plan, packed);
+
+  if (m_filter_variance) {
+    // The transform of a real signal is the left half of the full spectrum
+    int half_width = padded_width / 2 + 1;
+    FFT<SeFloat>::executeForward(mask_plan, mask);
+    for (int y = 0; y < padded_height; ++y) {
+      for (int x = 0; x < half_width; ++x) {
+        auto m = mask.data() + 2 * (x + y * half_width);
+        auto k = kernel + 2 * (x + y * padded_width);
+        SeFloat re = m[0] * k[0] - m[1] * k[1];
+        SeFloat im = m[0] * k[1] + m[1] * k[0];
+        m[0] = re;
+        m[1] = im;
+      }
+    }
+    FFT<SeFloat>::executeInverse(mask_inv_plan, mask);
+  }
+
+  // Normalize by the convolution of the mask, masking again the result.
+  // The scaling of the transform cancels out.
+  auto result = std::make_shared<FilteredTile>();
+  result->m_outputs[0].resize(width * height);
+  if (m_filter_variance) {
+    result->m_outputs[1].resize(width * height);
+  }
+  int off_x = start_x - clip_x;
+  int off_y = start_y - clip_y;
+  for (int y = 0; y < height; ++y) {
+    auto variance_row = variance_chunk->getRowPtr(y + off_y);
+    for (int x = 0; x < width; ++x) {
+      size_t out = x + y * width;
+      size_t in = (x + off_x) + (y + off_y) * padded_width;
+      if (variance_row[x + off_x] < m_threshold) {
+        if (m_filter_variance) {
+          SeFloat weight = mask[(x + off_x) + (y + off_y) * mask_stride];
+          result->m_outputs[0][out] = packed[2 * in] / weight;
+          result->m_outputs[1][out] = packed[2 * in + 1] / weight;
+        }
+        else {
+          result->m_outputs[0][out] = packed[2 * in] / packed[2 * in + 1];
+        }
+      }
+      else {
+        result->m_outputs[0][out] = 0;
+        if (m_filter_variance) {
+          result->m_outputs[1][out] = 0;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+} // end of namespace SourceXtractor
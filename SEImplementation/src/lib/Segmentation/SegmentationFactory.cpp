@@ -51,6 +51,7 @@ SegmentationFactory::SegmentationFactory(std::shared_ptr<TaskProvider> task_prov
 void SegmentationFactory::reportConfigDependencies(Euclid::Configuration::ConfigManager& manager) const {
   manager.registerConfiguration<AssocModeConfig>();
   manager.registerConfiguration<SegmentationConfig>();
+  manager.registerConfiguration<ShardConfig>();
 }
 
 void SegmentationFactory::configure(Euclid::Configuration::ConfigManager& manager) {
@@ -64,6 +65,13 @@ void SegmentationFactory::configure(Euclid::Configuration::ConfigManager& manage
 
   auto assoc_config = manager.getConfiguration<AssocModeConfig>();
   m_catalogs = assoc_config.getCatalogs();
+
+  auto& shard_config = manager.getConfiguration<ShardConfig>();
+  if (shard_config.isEnabled()) {
+    auto core = shard_config.getCoreRegion();
+    auto margin = PixelCoordinate(shard_config.getMargin(), shard_config.getMargin());
+    m_detection_region = PixelRectangle(core.getTopLeft() - margin, core.getBottomRight() + margin);
+  }
 }
 
 std::shared_ptr<Segmentation> SegmentationFactory::createSegmentation() const {
@@ -95,6 +103,10 @@ std::shared_ptr<Segmentation> SegmentationFactory::createSegmentation() const {
       throw Elements::Exception("Unknown segmentation algorithm.");
   }
 
+  if (m_detection_region.getWidth() > 0) {
+    segmentation->setDetectionRegion(m_detection_region);
+  }
+
   return segmentation;
 }
 
@@ -0,0 +1,115 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "SEImplementation/Background/BackgroundCache.h"
+#include "SEUtils/TestUtils.h"
+
+using namespace SourceXtractor;
+namespace fs = boost::filesystem;
+
+struct BackgroundCacheFixture {
+  fs::path m_directory;
+  BackgroundMeshes m_meshes;
+
+  BackgroundCacheFixture() : m_directory(fs::temp_directory_path() / fs::unique_path()) {
+    m_meshes.m_mode = VectorImage<SeFloat>::create(3, 2, std::vector<SeFloat>{1, 2, 3, 4, 5, 6});
+    m_meshes.m_sigma = VectorImage<SeFloat>::create(3, 2, std::vector<SeFloat>{.1, .2, .3, .4, .5, .6});
+    m_meshes.m_use_sigma_map = true;
+    m_meshes.m_scaling = 1.5;
+    m_meshes.m_median = 3.5;
+    m_meshes.m_median_sigma = .35;
+  }
+
+  ~BackgroundCacheFixture() {
+    fs::remove_all(m_directory);
+  }
+};
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(BackgroundCache_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(roundTrip, BackgroundCacheFixture) {
+  BackgroundCache cache(m_directory.string(), false);
+  BackgroundMeshes loaded;
+
+  BOOST_CHECK(!cache.load("key", loaded));
+  cache.store("key", m_meshes);
+  BOOST_CHECK(!cache.load("other", loaded));
+  BOOST_REQUIRE(cache.load("key", loaded));
+
+  BOOST_CHECK(compareImages(m_meshes.m_mode, loaded.m_mode));
+  BOOST_CHECK(compareImages(m_meshes.m_sigma, loaded.m_sigma));
+  BOOST_CHECK(loaded.m_use_sigma_map);
+  BOOST_CHECK_EQUAL(loaded.m_scaling, m_meshes.m_scaling);
+  BOOST_CHECK_EQUAL(loaded.m_median, m_meshes.m_median);
+  BOOST_CHECK_EQUAL(loaded.m_median_sigma, m_meshes.m_median_sigma);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(corruptEntry, BackgroundCacheFixture) {
+  BackgroundCache cache(m_directory.string(), false);
+  cache.store("key", m_meshes);
+
+  // Truncate the entry
+  for (auto& entry : fs::directory_iterator(m_directory)) {
+    fs::resize_file(entry.path(), fs::file_size(entry.path()) - 8);
+  }
+
+  BackgroundMeshes loaded;
+  BOOST_CHECK(!cache.load("key", loaded));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(checksum, BackgroundCacheFixture) {
+  BackgroundCache cache(m_directory.string(), true);
+
+  auto image = VectorImage<SeFloat>::create(64, 64);
+  auto key = cache.makeKey("image", *image, nullptr);
+  BOOST_CHECK_EQUAL(key, cache.makeKey("image", *image, nullptr));
+
+  image->setValue(1, 1, 42.);
+  BOOST_CHECK_NE(key, cache.makeKey("image", *image, nullptr));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(fileIdentity) {
+  auto path = fs::temp_directory_path() / fs::unique_path();
+  std::ofstream(path.string()) << "abc";
+
+  auto identity = BackgroundCache::fileIdentity(path.string());
+  BOOST_CHECK_EQUAL(identity, BackgroundCache::fileIdentity(path.string()));
+  BOOST_CHECK_NE(identity, BackgroundCache::fileIdentity(path.string() + "[1]"));
+
+  std::ofstream(path.string(), std::ios::app) << "def";
+  BOOST_CHECK_NE(identity, BackgroundCache::fileIdentity(path.string()));
+
+  fs::remove(path);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+#include "SEImplementation/CheckImages/CheckImageAccumulator.h"
+#include "SEFramework/Image/VectorImage.h"
+#include "SEUtils/TestUtils.h"
+
+using namespace SourceXtractor;
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(CheckImageAccumulator_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(addAndPaint) {
+  auto target = VectorImage<int>::create(4, 4);
+  CheckImageAccumulator<int> accumulator(target);
+
+  // Partially out of bounds
+  accumulator.addStamp(-1, -1, VectorImage<int>::create(2, 2, std::vector<int>{1, 1, 1, 1}));
+  accumulator.addStamp(0, 0, VectorImage<int>::create(2, 2, std::vector<int>{1, 1, 1, 1}));
+  accumulator.addStamp(3, 3, VectorImage<int>::create(2, 2, std::vector<int>{5, 5, 5, 5}));
+  accumulator.addStamp(1, 2, VectorImage<int>::create(2, 2, std::vector<int>{0, 7, 7, 0}),
+                       CheckImageAccumulator<int>::Operation::PAINT);
+  accumulator.flush();
+
+  auto expected = VectorImage<int>::create(4, 4, std::vector<int>{
+    2, 1, 0, 0,
+    1, 1, 0, 0,
+    0, 0, 7, 0,
+    0, 7, 0, 5
+  });
+  BOOST_CHECK(compareImages(expected, target));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(concurrentAdd) {
+  auto target = VectorImage<SeFloat>::create(32, 32);
+  {
+    // Keep the staging area small so the workers have to wait for the compositor
+    CheckImageAccumulator<SeFloat> accumulator(target, 64);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+      workers.emplace_back([&accumulator]() {
+        for (int i = 0; i < 100; ++i) {
+          auto stamp = VectorImage<SeFloat>::create(8, 8);
+          std::fill(stamp->getData().begin(), stamp->getData().end(), 1.);
+          accumulator.addStamp((i * 3) % 32, (i * 5) % 32, stamp);
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    // The destructor must compose whatever is left
+  }
+
+  auto expected = VectorImage<SeFloat>::create(32, 32);
+  for (int i = 0; i < 100; ++i) {
+    for (int y = (i * 5) % 32; y < std::min(32, (i * 5) % 32 + 8); ++y) {
+      for (int x = (i * 3) % 32; x < std::min(32, (i * 3) % 32 + 8); ++x) {
+        expected->at(x, y) += 4;
+      }
+    }
+  }
+  BOOST_CHECK(compareImages(expected, target));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Deblending/ParallelDeblending_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <mutex>
+#include <tuple>
+
+#include "SEFramework/Property/DetectionFrame.h"
+#include "SEFramework/Source/SimpleSource.h"
+#include "SEFramework/Source/SimpleSourceFactory.h"
+#include "SEFramework/Source/SimpleSourceGroup.h"
+#include "SEImplementation/Property/SourceId.h"
+#include "SEImplementation/Property/PixelCoordinateList.h"
+#include "SEImplementation/Plugin/DetectionFramePixelValues/DetectionFramePixelValues.h"
+#include "SEImplementation/Plugin/MoffatModelFitting/MoffatModelFitting.h"
+#include "SEImplementation/Plugin/MoffatModelFitting/MoffatModelEvaluator.h"
+#include "SEImplementation/Deblending/Cleaning.h"
+#include "SEImplementation/Deblending/ParallelDeblending.h"
+
+using namespace SourceXtractor;
+
+namespace {
+
+/// A 3x3 source, with a Moffat model of the given intensity centered on it
+std::unique_ptr<SourceInterface> createSource(unsigned int source_id, unsigned int detection_id,
+                                              int x, int y, double i0) {
+  auto source = Euclid::make_unique<SimpleSource>();
+  std::vector<PixelCoordinate> pixels;
+  for (int iy = y - 1; iy <= y + 1; ++iy) {
+    for (int ix = x - 1; ix <= x + 1; ++ix) {
+      pixels.emplace_back(ix, iy);
+    }
+  }
+  std::vector<DetectionImage::PixelType> values(pixels.size(), i0);
+  std::vector<WeightImage::PixelType> variances(pixels.size(), 1.);
+  source->setProperty<DetectionFramePixelValues>(values, values, variances);
+  source->setProperty<PixelCoordinateList>(pixels);
+  source->setProperty<DetectionFrame>(nullptr);
+  source->setProperty<SourceId>(source_id, detection_id);
+  source->setProperty<MoffatModelEvaluator>(MoffatModelFitting(x, y, i0, 1., 2., 0., 50., 1., 1., 0., 1));
+  return std::move(source);
+}
+
+class Collector : public PipelineReceiver<SourceGroupInterface> {
+public:
+  void receiveSource(std::unique_ptr<SourceGroupInterface> group) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& source : *group) {
+      auto& source_id = source.getProperty<SourceId>();
+      m_ids.emplace_back(m_groups, source_id.getSourceId(), source_id.getDetectionId());
+    }
+    ++m_groups;
+  }
+
+  void receiveProcessSignal(const ProcessSourcesEvent&) override {
+  }
+
+  std::mutex m_mutex;
+  unsigned int m_groups = 0;
+  std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> m_ids;
+};
+
+std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> runCleaning(unsigned threads) {
+  auto cleaning = std::make_shared<Cleaning>(std::make_shared<SimpleSourceFactory>(), 5);
+  auto deblending = std::make_shared<Deblending>(std::vector<std::shared_ptr<DeblendStep>>{cleaning});
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(threads);
+  auto parallel = std::make_shared<ParallelDeblending>(deblending, thread_pool, 8);
+  auto collector = std::make_shared<Collector>();
+  parallel->setNextStage(collector);
+
+  for (unsigned int detection_id = 1; detection_id < 250; detection_id += 5) {
+    // A detection split into two bright sources, each with a faint neighbour that is cleaned into them
+    auto group = Euclid::make_unique<SimpleSourceGroup>();
+    group->addSource(createSource(detection_id + 1, detection_id, 10, 10, 1000.));
+    group->addSource(createSource(detection_id + 2, detection_id, 13, 10, 0.001));
+    group->addSource(createSource(detection_id + 3, detection_id, 40, 40, 1000.));
+    group->addSource(createSource(detection_id + 4, detection_id, 40, 43, 0.001));
+    parallel->receiveSource(std::move(group));
+    // Like the segmentation, allocate ids while the workers run
+    SourceId unused;
+  }
+  parallel->synchronize();
+  parallel->wait();
+  return collector->m_ids;
+}
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (ParallelDeblending_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( deterministic_ids_test ) {
+  auto single = runCleaning(1);
+  auto multiple = runCleaning(4);
+
+  BOOST_CHECK(single == multiple);
+
+  // The merged sources keep the ids of the bright source they replace
+  BOOST_REQUIRE_EQUAL(single.size(), 100);
+  for (unsigned int i = 0; i < 50; ++i) {
+    BOOST_CHECK(single[2 * i] == std::make_tuple(i, 5 * i + 2, 5 * i + 1));
+    BOOST_CHECK(single[2 * i + 1] == std::make_tuple(i, 5 * i + 4, 5 * i + 1));
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -0,0 +1,227 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Image/FrameModel_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+#include "AlexandriaKernel/memory_tools.h"
+#include "ModelFitting/Parameters/ManualParameter.h"
+#include "ModelFitting/Models/FrameModel.h"
+#include "SEImplementation/Image/ImageInterfaceTraits.h"
+
+using namespace SourceXtractor;
+using namespace ModelFitting;
+
+namespace {
+
+using Traits = ImageTraits<ImageInterfaceTypePtr>;
+
+/// Circular gaussian, normalized to the given flux
+class GaussianComponent : public ModelComponent {
+public:
+  GaussianComponent(double flux, double sigma) : m_flux(flux), m_sigma(sigma) {}
+
+  double getValue(double x, double y) override {
+    return m_flux * std::exp(-(x * x + y * y) / (2 * m_sigma * m_sigma)) / (2 * M_PI * m_sigma * m_sigma);
+  }
+
+  void updateRasterizationInfo(double, double) override {
+  }
+
+  std::vector<ModelSample> getSharpSampling() override {
+    return {};
+  }
+
+  bool insideSharpRegion(double, double) override {
+    return false;
+  }
+
+private:
+  double m_flux, m_sigma;
+};
+
+/// Gaussian PSF convolved directly, counting the convolutions
+class TestPsf {
+public:
+  TestPsf(double pixel_scale, std::shared_ptr<size_t> convolutions)
+    : m_pixel_scale(pixel_scale), m_kernel(Traits::factory(9, 9)), m_convolutions(std::move(convolutions)) {
+    double total = 0;
+    for (int y = 0; y < 9; ++y) {
+      for (int x = 0; x < 9; ++x) {
+        total += Traits::at(m_kernel, x, y) = std::exp(-((x - 4) * (x - 4) + (y - 4) * (y - 4)) / 4.);
+      }
+    }
+    for (auto i = Traits::begin(m_kernel); i != Traits::end(m_kernel); ++i) {
+      *i /= total;
+    }
+  }
+
+  double getPixelScale() const {
+    return m_pixel_scale;
+  }
+
+  std::size_t getSize() const {
+    return Traits::width(m_kernel);
+  }
+
+  ImageInterfaceTypePtr getScaledKernel(double scale) const {
+    auto scaled = Traits::factory(getSize(), getSize());
+    for (std::size_t y = 0; y < getSize(); ++y) {
+      for (std::size_t x = 0; x < getSize(); ++x) {
+        Traits::at(scaled, x, y) = Traits::at(m_kernel, x, y) * scale;
+      }
+    }
+    return scaled;
+  }
+
+  void convolve(ImageInterfaceTypePtr& image) const {
+    ++*m_convolutions;
+    int width = Traits::width(image), height = Traits::height(image), half = getSize() / 2;
+    auto result = Traits::factory(width, height);
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        double value = 0;
+        for (int ky = -half; ky <= half; ++ky) {
+          for (int kx = -half; kx <= half; ++kx) {
+            if (x - kx >= 0 && x - kx < width && y - ky >= 0 && y - ky < height) {
+              value += Traits::at(m_kernel, kx + half, ky + half) * Traits::at(image, x - kx, y - ky);
+            }
+          }
+        }
+        Traits::at(result, x, y) = value;
+      }
+    }
+    image = result;
+  }
+
+private:
+  double m_pixel_scale;
+  ImageInterfaceTypePtr m_kernel;
+  std::shared_ptr<size_t> m_convolutions;
+};
+
+std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>> createModel(double x, double y, double size) {
+  std::vector<std::unique_ptr<ModelComponent>> components;
+  components.emplace_back(Euclid::make_unique<GaussianComponent>(1000., size / 8.));
+  return std::make_shared<ExtendedModel<ImageInterfaceTypePtr>>(
+    std::move(components), std::make_shared<ManualParameter>(1.), std::make_shared<ManualParameter>(1.),
+    std::make_shared<ManualParameter>(0.), size, size,
+    std::make_shared<ManualParameter>(x), std::make_shared<ManualParameter>(y));
+}
+
+struct Rendering {
+  ImageInterfaceTypePtr m_image;
+  size_t m_convolutions;
+};
+
+Rendering render(const std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>>& models,
+                 bool batch, double psf_pixel_scale = 1.) {
+  auto convolutions = std::make_shared<size_t>(0);
+  FrameModel<TestPsf, ImageInterfaceTypePtr> frame_model(1., 60, 50, {}, {}, models,
+                                                         TestPsf(psf_pixel_scale, convolutions));
+  frame_model.setBatchConvolution(batch);
+  return {frame_model.getImage(), *convolutions};
+}
+
+/// Largest difference between both renderings, relative to the peak of the reference
+double maxRelativeDifference(const ImageInterfaceTypePtr& reference, const ImageInterfaceTypePtr& image) {
+  double peak = 0, difference = 0;
+  for (std::size_t y = 0; y < Traits::height(reference); ++y) {
+    for (std::size_t x = 0; x < Traits::width(reference); ++x) {
+      peak = std::max<double>(peak, std::abs(Traits::at(reference, x, y)));
+      difference = std::max<double>(difference, std::abs(Traits::at(reference, x, y) - Traits::at(image, x, y)));
+    }
+  }
+  return difference / peak;
+}
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (FrameModel_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( batch_off_by_default_test ) {
+  auto convolutions = std::make_shared<size_t>(0);
+  FrameModel<TestPsf, ImageInterfaceTypePtr> frame_model(
+    1., 60, 50, {}, {}, {createModel(20.3, 17.6, 40), createModel(38.7, 30.2, 40)}, TestPsf(1., convolutions));
+  frame_model.getImage();
+  BOOST_CHECK_EQUAL(*convolutions, 2);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( off_centre_test ) {
+  std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>> models{
+    createModel(20.3, 17.6, 40), createModel(38.7, 30.2, 40), createModel(25.5, 35.1, 40), createModel(44.2, 12.8, 40)
+  };
+  auto per_model = render(models, false);
+  auto batched = render(models, true);
+  BOOST_CHECK_EQUAL(per_model.m_convolutions, models.size());
+  BOOST_CHECK_EQUAL(batched.m_convolutions, 1);
+  BOOST_CHECK_LT(maxRelativeDifference(per_model.m_image, batched.m_image), 1e-3);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( margin_test ) {
+  // Partially outside of the frame, so part of their light lands on the margin of the canvas
+  std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>> models{
+    createModel(-2.4, 48.6, 40), createModel(59.2, 1.3, 40), createModel(0.5, 0.5, 40), createModel(61.7, 52.2, 40)
+  };
+  auto per_model = render(models, false);
+  auto batched = render(models, true);
+  BOOST_CHECK_EQUAL(batched.m_convolutions, 1);
+  BOOST_CHECK_LT(maxRelativeDifference(per_model.m_image, batched.m_image), 1e-3);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( fallback_test ) {
+  // Stamps smaller than the canvas
+  std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>> small{
+    createModel(20.3, 17.6, 10), createModel(38.7, 30.2, 10)
+  };
+  auto small_batched = render(small, true);
+  BOOST_CHECK_EQUAL(small_batched.m_convolutions, small.size());
+  BOOST_CHECK_EQUAL(maxRelativeDifference(render(small, false).m_image, small_batched.m_image), 0.);
+
+  // A single model
+  std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>> single{createModel(20.3, 17.6, 80)};
+  auto single_batched = render(single, true);
+  BOOST_CHECK_EQUAL(single_batched.m_convolutions, 1);
+  BOOST_CHECK_EQUAL(maxRelativeDifference(render(single, false).m_image, single_batched.m_image), 0.);
+
+  // The PSF has a different pixel scale than the frame
+  std::vector<std::shared_ptr<ExtendedModel<ImageInterfaceTypePtr>>> models{
+    createModel(20.3, 17.6, 40), createModel(38.7, 30.2, 40), createModel(25.5, 35.1, 40)
+  };
+  auto scaled_batched = render(models, true, 0.5);
+  BOOST_CHECK_EQUAL(scaled_batched.m_convolutions, models.size());
+  BOOST_CHECK_EQUAL(maxRelativeDifference(render(models, false, 0.5).m_image, scaled_batched.m_image), 0.);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -22,6 +22,7 @@
  */
 
 #include <iostream>
+#include <tuple>
 
 #include <boost/test/unit_test.hpp>
 
@@ -70,6 +71,56 @@ BOOST_AUTO_TEST_CASE (copy_test_odd) {
   copy_test(127, 4);
 }
 
+// Reference: resample into a window, then add the window to the target
+void addImageToImageWindow(ImageInterfaceTypePtr& target, const ImageInterfaceTypePtr& source,
+                           double scale_factor, double x, double y) {
+  double scaled_width = Traits::width(source) * scale_factor;
+  double scaled_height = Traits::height(source) * scale_factor;
+  int x_min = std::floor(x - scaled_width / 2.);
+  int x_max = std::ceil(x + scaled_width / 2.);
+  int y_min = std::floor(y - scaled_height / 2.);
+  int y_max = std::ceil(y + scaled_height / 2.);
+  auto window = Traits::factory(x_max - x_min, y_max - y_min);
+  shiftResizeLancszosFast(source, window, scale_factor, x - scaled_width / 2. - x_min, y - scaled_height / 2. - y_min);
+  double corr_factor = 1. / (scale_factor * scale_factor);
+  for (int x_im = std::max(x_min, 0); x_im < std::min<int>(x_max, Traits::width(target)); ++x_im) {
+    for (int y_im = std::max(y_min, 0); y_im < std::min<int>(y_max, Traits::height(target)); ++y_im) {
+      Traits::at(target, x_im, y_im) += corr_factor * Traits::at(window, x_im - x_min, y_im - y_min);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE (resample_test) {
+  auto source = Traits::factory(61, 45);
+  for (unsigned int x = 0; x < Traits::width(source); ++x) {
+    for (unsigned int y = 0; y < Traits::height(source); ++y) {
+      Traits::at(source, x, y) = std::exp(-((x - 30.) * (x - 30.) + (y - 21.) * (y - 21.)) / 50.);
+    }
+  }
+
+  // Downscaled, partially outside the target, and upscaled
+  std::vector<std::tuple<double, double, double>> placements{
+    std::make_tuple(0.2, 10.3, 7.8), std::make_tuple(0.33, 1.1, 18.6), std::make_tuple(1.7, 20.5, 12.25)
+  };
+  for (auto& placement : placements) {
+    auto expected = Traits::factory(25, 20);
+    auto result = Traits::factory(25, 20);
+    double scale, x, y;
+    std::tie(scale, x, y) = placement;
+    addImageToImageWindow(expected, source, scale, x, y);
+    // Twice, so the second time the weights come from the cache
+    for (int i = 0; i < 2; ++i) {
+      std::fill(result->getData().begin(), result->getData().end(), 0.f);
+      Traits::addImageToImage(result, source, scale, x, y);
+      for (unsigned int ix = 0; ix < Traits::width(result); ++ix) {
+        for (unsigned int iy = 0; iy < Traits::height(result); ++iy) {
+          BOOST_CHECK_SMALL(Traits::at(result, ix, iy) - Traits::at(expected, ix, iy), 1e-4f);
+        }
+      }
+    }
+  }
+}
+
 
 //-----------------------------------------------------------------------------
 
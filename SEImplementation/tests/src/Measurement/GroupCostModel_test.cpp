@@ -0,0 +1,73 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Measurement/GroupCostModel_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "SEImplementation/Measurement/GroupCostModel.h"
+
+using namespace SourceXtractor;
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (GroupCostModel_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( prior_test ) {
+  GroupCostModel model(100.);
+
+  BOOST_CHECK_CLOSE(model.estimate(1, 50), 150., 1e-8);
+  BOOST_CHECK_GT(model.estimate(2, 10), model.estimate(1, 10));
+  BOOST_CHECK_GT(model.estimate(1, 200), model.estimate(2, 10));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( refine_test ) {
+  GroupCostModel model(100., 4);
+
+  // Sources are actually very expensive compared to pixels
+  for (size_t sources = 1; sources <= 8; ++sources) {
+    size_t pixels = 1000 / sources;
+    model.update(sources, pixels, 2. * sources + 0.001 * pixels);
+  }
+
+  BOOST_CHECK_CLOSE(model.estimate(1, 0), 2., 1e-4);
+  BOOST_CHECK_CLOSE(model.estimate(0, 1000), 1., 1e-4);
+  BOOST_CHECK_GT(model.estimate(2, 10), model.estimate(1, 200));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( degenerate_test ) {
+  GroupCostModel model(100., 2);
+
+  // All groups have the same shape, so the coefficients can not be told apart
+  for (int i = 0; i < 10; ++i) {
+    model.update(1, 100, 5.);
+  }
+
+  BOOST_CHECK_CLOSE(model.estimate(1, 50), 150., 1e-8);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -0,0 +1,421 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Measurement/MultithreadedMeasurement_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "AlexandriaKernel/memory_tools.h"
+#include "SEFramework/Source/SimpleSource.h"
+#include "SEFramework/Source/SimpleSourceGroup.h"
+#include "SEFramework/Source/SourceGroupWithOnDemandProperties.h"
+#include "SEFramework/Source/SourceWithOnDemandProperties.h"
+#include "SEFramework/Task/SourceTask.h"
+#include "SEFramework/Task/TaskFactory.h"
+#include "SEFramework/Task/TaskProvider.h"
+#include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
+#include "SEImplementation/Plugin/SourceIDs/SourceID.h"
+#include "SEImplementation/Property/PixelCoordinateList.h"
+#include "SEImplementation/Measurement/MultithreadedMeasurement.h"
+
+using namespace SourceXtractor;
+
+namespace {
+
+/// A group of sources with consecutive ids starting at first_id, each spanning a row of pixels
+std::unique_ptr<SourceGroupInterface> createGroup(unsigned int first_id, unsigned int sources, int pixels) {
+  auto group = Euclid::make_unique<SimpleSourceGroup>();
+  for (unsigned int i = 0; i < sources; ++i) {
+    auto source = Euclid::make_unique<SimpleSource>();
+    std::vector<PixelCoordinate> coordinates;
+    for (int x = 0; x < pixels; ++x) {
+      coordinates.emplace_back(x, static_cast<int>(i));
+    }
+    source->setProperty<PixelCoordinateList>(coordinates);
+    source->setProperty<SourceID>(first_id + i, first_id + i);
+    group->addSource(std::move(source));
+  }
+  return std::move(group);
+}
+
+Euclid::Table::Row createRow(const SourceInterface& source) {
+  static auto column_info = std::make_shared<Euclid::Table::ColumnInfo>(
+    std::vector<Euclid::Table::ColumnInfo::info_type>{Euclid::Table::ColumnDescription("id", typeid(int64_t))});
+  return Euclid::Table::Row({static_cast<int64_t>(source.getProperty<SourceID>().getId())}, column_info);
+}
+
+unsigned int firstId(const SourceGroupInterface& group) {
+  return group.cbegin()->getProperty<SourceID>().getId();
+}
+
+/// Blocks the measurement of a source until opened
+struct Gate {
+  std::promise<void> m_entered, m_open;
+  std::shared_future<void> m_open_future = m_open.get_future().share();
+
+  void pass() {
+    m_entered.set_value();
+    m_open_future.wait();
+  }
+};
+
+/// Records the first source id of the groups measured, in the order their measurement started
+struct MeasureRecorder {
+  std::mutex m_mutex;
+  std::vector<unsigned int> m_measured;
+
+  void record(const SourceInterface& source, const std::set<unsigned int>& group_ids) {
+    auto id = source.getProperty<SourceID>().getId();
+    if (group_ids.count(id)) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_measured.emplace_back(id);
+    }
+  }
+};
+
+class Collector : public PipelineReceiver<SourceGroupInterface> {
+public:
+  void receiveSource(std::unique_ptr<SourceGroupInterface> group) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_received.emplace_back(firstId(*group));
+  }
+
+  void receiveProcessSignal(const ProcessSourcesEvent&) override {
+  }
+
+  std::mutex m_mutex;
+  std::vector<unsigned int> m_received;
+};
+
+/// A property with several instances that are not measurement frames (i.e. apertures)
+class InstanceProperty : public Property {
+};
+
+/// Offset of the instances of InstanceProperty on the log, to tell them from the frames
+const int instance_offset = 100;
+
+/// Records where and when the per-frame properties and the rows were computed
+struct BandLog {
+  struct Entry {
+    unsigned int m_source_id;
+    int m_band; // -1 for the row
+    std::thread::id m_thread;
+  };
+
+  std::mutex m_mutex;
+  std::vector<Entry> m_entries;
+  int m_failing_band = -1;
+
+  void record(unsigned int source_id, int band) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.emplace_back(Entry{source_id, band, std::this_thread::get_id()});
+  }
+};
+
+BandLog* band_log = nullptr;
+
+class BandTask : public SourceTask {
+public:
+  BandTask(unsigned int band, bool frame) : m_band(band), m_frame(frame) {}
+
+  void computeProperties(SourceInterface& source) const override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    if (m_frame && static_cast<int>(m_band) == band_log->m_failing_band) {
+      // An Elements::Exception would be taken as the property not being applicable
+      throw std::runtime_error("band " + std::to_string(m_band) + " failed");
+    }
+    if (m_frame) {
+      band_log->record(source.getProperty<SourceID>().getId(), m_band);
+      source.setIndexedProperty<MeasurementFramePixelCentroid>(m_band, m_band, 0);
+    }
+    else {
+      band_log->record(source.getProperty<SourceID>().getId(), instance_offset + m_band);
+      source.setIndexedProperty<InstanceProperty>(m_band);
+    }
+  }
+
+private:
+  unsigned int m_band;
+  bool m_frame;
+};
+
+class FrameTaskFactory : public TaskFactory {
+public:
+  std::shared_ptr<Task> createTask(const PropertyId& property_id) const override {
+    return std::make_shared<BandTask>(property_id.getIndex(), true);
+  }
+};
+
+class InstanceTaskFactory : public TaskFactory {
+public:
+  std::shared_ptr<Task> createTask(const PropertyId& property_id) const override {
+    return std::make_shared<BandTask>(property_id.getIndex(), false);
+  }
+};
+
+/// Knows a per-frame property for the given frames, and a property with instances 1 and 2 that are not frames,
+/// as if they had already been requested
+std::shared_ptr<TaskProvider> createBandTaskProvider(unsigned int frames) {
+  auto registry = std::make_shared<TaskFactoryRegistry>();
+  registry->registerTaskFactory<FrameTaskFactory, MeasurementFramePixelCentroid>();
+  registry->registerTaskFactory<InstanceTaskFactory, InstanceProperty>();
+  auto task_provider = std::make_shared<TaskProvider>(registry);
+  for (unsigned int frame = 0; frame < frames; ++frame) {
+    task_provider->getTask<SourceTask>(PropertyId::create<MeasurementFramePixelCentroid>(frame));
+  }
+  for (unsigned int instance = 1; instance <= 2; ++instance) {
+    task_provider->getTask<SourceTask>(PropertyId::create<InstanceProperty>(instance));
+  }
+  return task_provider;
+}
+
+std::unique_ptr<SourceGroupInterface> createBandGroup(const std::shared_ptr<TaskProvider>& task_provider,
+                                                      unsigned int first_id, unsigned int sources) {
+  auto group = Euclid::make_unique<SourceGroupWithOnDemandProperties>(task_provider);
+  for (unsigned int i = 0; i < sources; ++i) {
+    auto source = Euclid::make_unique<SourceWithOnDemandProperties>(task_provider);
+    source->setProperty<PixelCoordinateList>(std::vector<PixelCoordinate>{{0, static_cast<int>(i)}});
+    source->setProperty<SourceID>(first_id + i, first_id + i);
+    group->addSource(std::move(source));
+  }
+  return std::move(group);
+}
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (MultithreadedMeasurement_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( cheap_group_not_starved_test ) {
+  const size_t window = 4;
+  const unsigned int expensive_groups = 20;
+
+  std::set<unsigned int> group_ids{1, 2};
+  for (unsigned int i = 0; i < expensive_groups; ++i) {
+    group_ids.insert(3 + i * 10);
+  }
+
+  Gate gate;
+  MeasureRecorder recorder;
+  auto source_to_row = [&gate, &recorder, &group_ids](const SourceInterface& source) {
+    recorder.record(source, group_ids);
+    if (source.getProperty<SourceID>().getId() == 1) {
+      gate.pass();
+    }
+    return createRow(source);
+  };
+
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(1);
+  auto measurement = std::make_shared<MultithreadedMeasurement>(source_to_row, thread_pool, 100, 0, 1, window);
+  auto collector = std::make_shared<Collector>();
+  measurement->setNextStage(collector);
+  measurement->startThreads();
+
+  // Hold the only worker, so all the following groups are waiting when it becomes free
+  measurement->receiveSource(createGroup(1, 1, 1));
+  gate.m_entered.get_future().wait();
+
+  // A cheap group queued in front of many expensive ones
+  measurement->receiveSource(createGroup(2, 1, 1));
+  for (unsigned int i = 0; i < expensive_groups; ++i) {
+    measurement->receiveSource(createGroup(3 + i * 10, 10, 100));
+  }
+  gate.m_open.set_value();
+  measurement->stopThreads();
+
+  BOOST_REQUIRE_EQUAL(recorder.m_measured.size(), group_ids.size());
+  auto cheap = std::find(recorder.m_measured.begin(), recorder.m_measured.end(), 2u);
+  BOOST_CHECK_LE(cheap - recorder.m_measured.begin(), window);
+  BOOST_CHECK_EQUAL(collector->m_received.size(), group_ids.size());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( budget_released_after_output_test ) {
+  Gate gate;
+  std::atomic<int> measured(0);
+  auto source_to_row = [&gate, &measured](const SourceInterface& source) {
+    if (source.getProperty<SourceID>().getId() == 1) {
+      gate.pass();
+    }
+    ++measured;
+    return createRow(source);
+  };
+
+  // Room for two groups
+  auto footprint = MultithreadedMeasurement::estimateFootprint(*createGroup(1, 1, 10), 1);
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(2);
+  auto measurement = std::make_shared<MultithreadedMeasurement>(source_to_row, thread_pool, 100, 2 * footprint, 1, 1,
+                                                                nullptr, 0, true);
+  auto collector = std::make_shared<Collector>();
+  measurement->setNextStage(collector);
+  measurement->startThreads();
+
+  // The first group is held, the second one is measured but has to wait for the first to be output
+  measurement->receiveSource(createGroup(1, 1, 10));
+  gate.m_entered.get_future().wait();
+  measurement->receiveSource(createGroup(2, 1, 10));
+  while (measured < 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // The budget is exhausted, so the third group has to wait
+  std::atomic_bool admitted(false);
+  std::thread producer([&measurement, &admitted]() {
+    measurement->receiveSource(createGroup(3, 1, 10));
+    admitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  BOOST_CHECK(!admitted);
+  {
+    std::lock_guard<std::mutex> lock(collector->m_mutex);
+    BOOST_CHECK(collector->m_received.empty());
+  }
+
+  // Once the first group is output, the budget is released and the third group admitted
+  gate.m_open.set_value();
+  producer.join();
+  BOOST_CHECK(admitted);
+  measurement->stopThreads();
+
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({1, 2, 3}));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( all_bands_measured_test ) {
+  const unsigned int bands = 4;
+  BandLog log;
+  band_log = &log;
+  auto source_to_row = [&log](const SourceInterface& source) {
+    log.record(source.getProperty<SourceID>().getId(), -1);
+    source.getProperty<InstanceProperty>(1);
+    return createRow(source);
+  };
+
+  auto task_provider = createBandTaskProvider(bands);
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(4);
+  auto measurement = std::make_shared<MultithreadedMeasurement>(source_to_row, thread_pool, 100, 0, bands, 1,
+                                                                task_provider, 1);
+  auto collector = std::make_shared<Collector>();
+  measurement->setNextStage(collector);
+  measurement->startThreads();
+  measurement->receiveSource(createBandGroup(task_provider, 1, 3));
+  measurement->synchronizeThreads();
+  measurement->stopThreads();
+
+  // Every frame is computed once per source, before the row. The instances that are not frames
+  // are only computed when requested by the row.
+  for (unsigned int id = 1; id <= 3; ++id) {
+    std::vector<int> computed;
+    for (auto& entry : log.m_entries) {
+      if (entry.m_source_id == id) {
+        computed.emplace_back(entry.m_band);
+      }
+    }
+    BOOST_REQUIRE_EQUAL(computed.size(), bands + 2);
+    BOOST_CHECK_EQUAL(computed[bands], -1);
+    BOOST_CHECK_EQUAL(computed[bands + 1], instance_offset + 1);
+    std::sort(computed.begin(), computed.begin() + bands);
+    BOOST_CHECK(std::vector<int>(computed.begin(), computed.begin() + bands) == std::vector<int>({0, 1, 2, 3}));
+  }
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({1}));
+  band_log = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( band_exception_test ) {
+  const unsigned int bands = 4;
+  BandLog log;
+  log.m_failing_band = 3;
+  band_log = &log;
+  auto source_to_row = [](const SourceInterface& source) {
+    return createRow(source);
+  };
+
+  auto task_provider = createBandTaskProvider(bands);
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(4);
+  auto measurement = std::make_shared<MultithreadedMeasurement>(source_to_row, thread_pool, 100, 0, bands, 1,
+                                                                task_provider, 1);
+  auto collector = std::make_shared<Collector>();
+  measurement->setNextStage(collector);
+  measurement->startThreads();
+  measurement->receiveSource(createBandGroup(task_provider, 1, 3));
+
+  // The failure of a band fanned out to another thread is reported, instead of being lost
+  // or leaving the group waiting forever
+  BOOST_CHECK_EXCEPTION(measurement->synchronizeThreads(), std::runtime_error, [](const std::runtime_error& e) {
+    return std::string(e.what()).find("band 3 failed") != std::string::npos;
+  });
+  measurement->stopThreads();
+  BOOST_CHECK(collector->m_received.empty());
+  band_log = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( single_band_direct_test ) {
+  // Two frames configured, but only the properties of the first one requested. The other instances
+  // known are not frames, so they are not split either.
+  BandLog log;
+  band_log = &log;
+  auto source_to_row = [&log](const SourceInterface& source) {
+    log.record(source.getProperty<SourceID>().getId(), -1);
+    source.getProperty<MeasurementFramePixelCentroid>(0);
+    return createRow(source);
+  };
+
+  auto task_provider = createBandTaskProvider(1);
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(4);
+  auto measurement = std::make_shared<MultithreadedMeasurement>(source_to_row, thread_pool, 100, 0, 2, 1,
+                                                                task_provider, 1);
+  auto collector = std::make_shared<Collector>();
+  measurement->setNextStage(collector);
+  measurement->startThreads();
+  measurement->receiveSource(createBandGroup(task_provider, 1, 3));
+  measurement->synchronizeThreads();
+  measurement->stopThreads();
+
+  // Nothing is computed ahead of the rows, and everything on the thread measuring the group
+  BOOST_REQUIRE_EQUAL(log.m_entries.size(), 6);
+  for (size_t i = 0; i < log.m_entries.size(); i += 2) {
+    BOOST_CHECK_EQUAL(log.m_entries[i].m_band, -1);
+    BOOST_CHECK_EQUAL(log.m_entries[i + 1].m_band, 0);
+    BOOST_CHECK_EQUAL(log.m_entries[i + 1].m_source_id, log.m_entries[i].m_source_id);
+    BOOST_CHECK(log.m_entries[i].m_thread == log.m_entries[0].m_thread);
+    BOOST_CHECK(log.m_entries[i + 1].m_thread == log.m_entries[0].m_thread);
+  }
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({1}));
+  band_log = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -0,0 +1,206 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Output/CheckpointOutput_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+
+#include "AlexandriaKernel/memory_tools.h"
+#include "SEFramework/Source/SimpleSource.h"
+#include "SEFramework/Source/SimpleSourceGroup.h"
+#include "SEImplementation/Property/PixelCoordinateList.h"
+#include "SEImplementation/Output/CheckpointOutput.h"
+
+using namespace SourceXtractor;
+namespace fs = boost::filesystem;
+
+namespace {
+
+std::unique_ptr<SourceInterface> createSource(int x, int y, int width) {
+  auto source = Euclid::make_unique<SimpleSource>();
+  std::vector<PixelCoordinate> pixels;
+  for (int i = 0; i < width; ++i) {
+    pixels.emplace_back(x + i, y);
+  }
+  source->setProperty<PixelCoordinateList>(pixels);
+  return std::move(source);
+}
+
+std::unique_ptr<SourceGroupInterface> createGroup(const std::vector<std::tuple<int, int, int>>& sources) {
+  auto group = Euclid::make_unique<SimpleSourceGroup>();
+  for (auto& s : sources) {
+    group->addSource(createSource(std::get<0>(s), std::get<1>(s), std::get<2>(s)));
+  }
+  return std::move(group);
+}
+
+/// Counts the sources, without generating any row
+class NullOutput : public FlushableOutput {
+public:
+  NullOutput() : FlushableOutput([](const SourceInterface&) -> Euclid::Table::Row {
+    throw Elements::Exception() << "Not expected";
+  }, 0) {}
+
+  void outputSource(const SourceInterface&) override {
+    ++m_sources;
+  }
+
+  void nextPart() override {
+  }
+
+  size_t m_sources = 0;
+
+protected:
+  void writeRows(const std::vector<Euclid::Table::Row>&) override {
+  }
+};
+
+}
+
+struct CheckpointOutputFixture {
+  fs::path m_directory;
+  std::shared_ptr<NullOutput> m_output = std::make_shared<NullOutput>();
+  std::unique_ptr<SourceGroupInterface> m_group_a = createGroup({{10, 10, 3}, {20, 5, 4}});
+  std::unique_ptr<SourceGroupInterface> m_group_b = createGroup({{30, 40, 2}});
+  std::unique_ptr<SourceGroupInterface> m_group_c = createGroup({{50, 60, 5}});
+
+  CheckpointOutputFixture() : m_directory(fs::temp_directory_path() / fs::unique_path()) {
+    fs::create_directories(m_directory);
+  }
+
+  ~CheckpointOutputFixture() {
+    fs::remove_all(m_directory);
+  }
+
+  std::shared_ptr<CheckpointOutput> createCheckpoint(const std::string& configuration = "abcd") {
+    return std::make_shared<CheckpointOutput>(m_output, m_output, m_directory.string(), 600., configuration);
+  }
+
+  void writeFile(const std::string& name, const std::string& content) {
+    std::ofstream out((m_directory / name).string());
+    out << content;
+  }
+
+  std::string readFile(const std::string& name) {
+    std::ifstream in((m_directory / name).string());
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+  }
+
+  static std::string key(const SourceGroupInterface& group) {
+    std::ostringstream str;
+    str << std::hex << CheckpointOutput::getGroupKey(group);
+    return str.str();
+  }
+};
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(CheckpointOutput_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(group_key_test, CheckpointOutputFixture) {
+  // The same sources, in a different order
+  auto group_a_reversed = createGroup({{20, 5, 4}, {10, 10, 3}});
+  BOOST_CHECK_EQUAL(CheckpointOutput::getGroupKey(*m_group_a), CheckpointOutput::getGroupKey(*group_a_reversed));
+
+  // A source with a different footprint
+  auto group_a_shifted = createGroup({{10, 10, 3}, {21, 5, 4}});
+  BOOST_CHECK_NE(CheckpointOutput::getGroupKey(*m_group_a), CheckpointOutput::getGroupKey(*group_a_shifted));
+  BOOST_CHECK_NE(CheckpointOutput::getGroupKey(*m_group_a), CheckpointOutput::getGroupKey(*m_group_b));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(fresh_directory_test, CheckpointOutputFixture) {
+  auto checkpoint = createCheckpoint();
+  BOOST_CHECK_EQUAL(checkpoint->getRestoredGroupCount(), 0);
+  BOOST_CHECK(!checkpoint->isCompleted(*m_group_a));
+  BOOST_CHECK_EQUAL(readFile("configuration"), "abcd\n");
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(restore_test, CheckpointOutputFixture) {
+  auto key_a = key(*m_group_a), key_b = key(*m_group_b), key_c = key(*m_group_c);
+  auto valid = "0 - 2 " + key_a + " " + key_b + " end";
+  writeFile("configuration", "abcd\n");
+  writeFile("completed",
+            valid + "\n" +
+            "garbage\n" +
+            "0 - 1 " + key_c + "x end\n" +
+            "0 - 1 " + key_c + " end trailing\n" +
+            "0 - 1 " + key_c.substr(0, 5));
+
+  auto checkpoint = createCheckpoint();
+  BOOST_CHECK_EQUAL(checkpoint->getRestoredGroupCount(), 2);
+  BOOST_CHECK(checkpoint->isCompleted(*m_group_a));
+  BOOST_CHECK(checkpoint->isCompleted(*m_group_b));
+  BOOST_CHECK(!checkpoint->isCompleted(*m_group_c));
+
+  // Only the valid entry is kept, so the following ones start on their own line
+  BOOST_CHECK_EQUAL(readFile("completed"), valid + "\n");
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(truncated_key_test, CheckpointOutputFixture) {
+  // Truncated in the middle of the last key: the number of keys matches, but the end marker is missing
+  auto key_a = key(*m_group_a), key_b = key(*m_group_b);
+  writeFile("configuration", "abcd\n");
+  writeFile("completed", "0 - 2 " + key_a + " " + key_b.substr(0, 3) + "\n");
+
+  auto checkpoint = createCheckpoint();
+  BOOST_CHECK_EQUAL(checkpoint->getRestoredGroupCount(), 0);
+  BOOST_CHECK(!checkpoint->isCompleted(*m_group_a));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(round_trip_test, CheckpointOutputFixture) {
+  {
+    auto checkpoint = createCheckpoint();
+    checkpoint->receiveSource(createGroup({{30, 40, 2}}));
+    checkpoint->flush();
+  }
+  BOOST_CHECK_EQUAL(m_output->m_sources, 1);
+  auto checkpoint = createCheckpoint();
+  BOOST_CHECK_EQUAL(checkpoint->getRestoredGroupCount(), 1);
+  BOOST_CHECK(checkpoint->isCompleted(*m_group_b));
+  BOOST_CHECK(!checkpoint->isCompleted(*m_group_a));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(configuration_mismatch_test, CheckpointOutputFixture) {
+  createCheckpoint("abcd");
+  writeFile("completed", "0 - 1 " + key(*m_group_a) + " end\n");
+
+  BOOST_CHECK_THROW(createCheckpoint("ef01"), Elements::Exception);
+  BOOST_CHECK_NO_THROW(createCheckpoint("abcd"));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
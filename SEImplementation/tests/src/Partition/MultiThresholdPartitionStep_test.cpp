@@ -91,9 +91,12 @@ class SourceObserver : public Observer<SourceInterface> {
 public:
   virtual void handleMessage(const SourceInterface& source) override {
       m_list.push_back(source.getProperty<DetectionFrameSourceStamp>());
+      auto& source_id = source.getProperty<SourceId>();
+      m_ids.emplace_back(source_id.getSourceId(), source_id.getDetectionId());
   }
 
   std::list<DetectionFrameSourceStamp> m_list;
+  std::vector<std::pair<unsigned int, unsigned int>> m_ids;
 };
 
 using namespace SourceXtractor;
@@ -152,8 +155,14 @@ BOOST_FIXTURE_TEST_CASE( multithreshold_test_2, MultiThresholdPartitionFixture )
   partition.addObserver(source_observer);
 
   source->setProperty<DetectionFrameSourceStamp>(stamp_one_source, nullptr, nullptr, PixelCoordinate(0,0), nullptr, nullptr);
+  auto detection_id = source->getProperty<SourceId>().getDetectionId();
   partition.receiveSource(std::move(source));
   BOOST_CHECK(source_observer->m_list.size() == 2);
+
+  // The split sources are numbered after the detection
+  std::vector<std::pair<unsigned int, unsigned int>> expected{{detection_id + 1, detection_id},
+                                                              {detection_id + 2, detection_id}};
+  BOOST_CHECK(source_observer->m_ids == expected);
 }
 
 BOOST_FIXTURE_TEST_CASE( multithreshold_test_3, MultiThresholdPartitionFixture ) {
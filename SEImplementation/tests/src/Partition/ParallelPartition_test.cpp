@@ -0,0 +1,172 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Partition/ParallelPartition_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+
+#include "SEFramework/Source/SimpleSource.h"
+#include "SEFramework/Pipeline/Partition.h"
+#include "SEImplementation/Property/SourceId.h"
+#include "SEImplementation/Partition/ParallelPartition.h"
+
+using namespace SourceXtractor;
+
+namespace {
+
+/// Splits each source in two, taking longer for the first sources received
+class SplitStep : public PartitionStep {
+public:
+  std::vector<std::unique_ptr<SourceInterface>> partition(std::unique_ptr<SourceInterface> source) const override {
+    auto id = source->getProperty<SourceId>().getDetectionId();
+    std::this_thread::sleep_for(std::chrono::milliseconds(id < 5 ? 5 - id : 0));
+    std::vector<std::unique_ptr<SourceInterface>> result;
+    for (unsigned i = 1; i <= 2; ++i) {
+      auto child = Euclid::make_unique<SimpleSource>();
+      child->setProperty<SourceId>(id + i, id);
+      result.emplace_back(std::move(child));
+    }
+    return result;
+  }
+};
+
+/// Splits each source in (detection id % 4) children, or passes it along if that is 1, at a random pace
+class RandomPaceSplitStep : public PartitionStep {
+public:
+  std::vector<std::unique_ptr<SourceInterface>> partition(std::unique_ptr<SourceInterface> source) const override {
+    thread_local std::mt19937 rng(std::random_device{}());
+    std::this_thread::sleep_for(std::chrono::microseconds(std::uniform_int_distribution<int>(0, 500)(rng)));
+
+    auto id = source->getProperty<SourceId>().getSourceId();
+    std::vector<std::unique_ptr<SourceInterface>> result;
+    if (id % 4 == 1) {
+      result.emplace_back(std::move(source));
+      return result;
+    }
+    for (unsigned i = 1; i <= id % 4; ++i) {
+      auto child = Euclid::make_unique<SimpleSource>();
+      // Like MultiThresholdPartitionStep, numbered after the detection
+      child->setProperty<SourceId>(id + i, id);
+      result.emplace_back(std::move(child));
+    }
+    return result;
+  }
+};
+
+class Collector : public PipelineReceiver<SourceInterface> {
+public:
+  void receiveSource(std::unique_ptr<SourceInterface> source) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& source_id = source->getProperty<SourceId>();
+    m_received.push_back(source_id.getDetectionId());
+    m_ids.emplace_back(source_id.getSourceId(), source_id.getDetectionId());
+  }
+
+  void receiveProcessSignal(const ProcessSourcesEvent&) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events_after.push_back(m_received.size());
+  }
+
+  std::mutex m_mutex;
+  std::vector<unsigned int> m_received;
+  std::vector<std::pair<unsigned int, unsigned int>> m_ids;
+  std::vector<size_t> m_events_after;
+};
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (ParallelPartition_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( ordered_release_test ) {
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(4);
+  auto partition = std::make_shared<Partition>(std::vector<std::shared_ptr<PartitionStep>>{std::make_shared<SplitStep>()});
+  auto parallel = std::make_shared<ParallelPartition>(partition, thread_pool, 3);
+  auto collector = std::make_shared<Collector>();
+  parallel->setNextStage(collector);
+
+  for (unsigned int id = 1; id <= 4; ++id) {
+    auto source = Euclid::make_unique<SimpleSource>();
+    source->setProperty<SourceId>(id, id);
+    parallel->receiveSource(std::move(source));
+  }
+  parallel->receiveProcessSignal(ProcessSourcesEvent(nullptr));
+  for (unsigned int id = 5; id <= 6; ++id) {
+    auto source = Euclid::make_unique<SimpleSource>();
+    source->setProperty<SourceId>(id, id);
+    parallel->receiveSource(std::move(source));
+  }
+  parallel->synchronize();
+  parallel->wait();
+
+  // The children keep the detection id set by the segmentation
+  std::vector<unsigned int> expected{1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6};
+  BOOST_CHECK_EQUAL_COLLECTIONS(collector->m_received.begin(), collector->m_received.end(),
+                                expected.begin(), expected.end());
+  BOOST_REQUIRE_EQUAL(collector->m_events_after.size(), 1);
+  BOOST_CHECK_EQUAL(collector->m_events_after[0], 8);
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<std::pair<unsigned int, unsigned int>> runRandomPace(unsigned threads) {
+  auto thread_pool = std::make_shared<Euclid::ThreadPool>(threads);
+  auto partition = std::make_shared<Partition>(
+    std::vector<std::shared_ptr<PartitionStep>>{std::make_shared<RandomPaceSplitStep>()});
+  auto parallel = std::make_shared<ParallelPartition>(partition, thread_pool, 8);
+  auto collector = std::make_shared<Collector>();
+  parallel->setNextStage(collector);
+
+  for (unsigned int id = 1; id <= 200; ++id) {
+    auto source = Euclid::make_unique<SimpleSource>();
+    source->setProperty<SourceId>(id, id);
+    parallel->receiveSource(std::move(source));
+  }
+  parallel->synchronize();
+  parallel->wait();
+  return collector->m_ids;
+}
+
+BOOST_AUTO_TEST_CASE( deterministic_ids_test ) {
+  auto single = runRandomPace(1);
+  auto multiple = runRandomPace(4);
+
+  BOOST_CHECK_EQUAL(single.size(), 50 * (0 + 1 + 2 + 3));
+  BOOST_CHECK(single == multiple);
+
+  // A source is identified by both ids
+  std::set<std::pair<unsigned int, unsigned int>> source_ids(single.begin(), single.end());
+  BOOST_CHECK_EQUAL(source_ids.size(), single.size());
+  for (auto& ids : single) {
+    BOOST_CHECK_EQUAL(ids.second % 4 == 1, ids.first == ids.second);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -43,6 +43,7 @@
 #include "SEImplementation/Plugin/MeasurementFrame/MeasurementFrame.h"
 #include "SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h"
 #include "SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/Jacobian/Jacobian.h"
 
@@ -77,6 +78,7 @@ BOOST_FIXTURE_TEST_CASE( one_pixel_test, AperturePhotometryFixture ) {
   source.setProperty<DetectionFrameImages>(frame, 1, 1);
   source.setIndexedProperty<MeasurementFrame>(0, frame);
   source.setIndexedProperty<MeasurementFrameImages>(0, frame, 1, 1);
+  source.setIndexedProperty<MeasurementFrameCutout>(0, frame, PixelCoordinate(-1, -1), PixelCoordinate(1, 1));
   source.setIndexedProperty<MeasurementFrameInfo>(0, 1, 1, 1, 9, 1e6, 0);
   source.setIndexedProperty<PixelBoundaries>(0, 0, 0, 0, 0);
   source.setIndexedProperty<MeasurementFramePixelCentroid>(0, 0, 0);
@@ -112,6 +114,7 @@ BOOST_FIXTURE_TEST_CASE( neighbour_test, AperturePhotometryFixture ) {
   source.setProperty<DetectionFrameImages>(frame, 1, 1);
   source.setIndexedProperty<MeasurementFrame>(0, frame);
   source.setIndexedProperty<MeasurementFrameImages>(0, frame, 3, 3);
+  source.setIndexedProperty<MeasurementFrameCutout>(0, frame, PixelCoordinate(0, 0), PixelCoordinate(2, 2));
   source.setIndexedProperty<MeasurementFrameInfo>(0, 3, 3, 1, 9, 1e6, 0);
   source.setIndexedProperty<PixelBoundaries>(0, 0, 0, 2, 2);
   source.setIndexedProperty<PixelCoordinateList>(0, PixelCoordinateList{{
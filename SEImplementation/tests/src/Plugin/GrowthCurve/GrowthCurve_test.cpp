@@ -27,7 +27,7 @@
 #include "SEImplementation/Plugin/MeasurementFrame/MeasurementFrame.h"
 #include "SEImplementation/Plugin/MeasurementFramePixelCentroid/MeasurementFramePixelCentroid.h"
 #include "SEImplementation/Plugin/MeasurementFrameInfo/MeasurementFrameInfo.h"
-#include "SEImplementation/Plugin/MeasurementFrameImages/MeasurementFrameImages.h"
+#include "SEImplementation/Plugin/MeasurementFrameCutout/MeasurementFrameCutout.h"
 
 using namespace SourceXtractor;
 
@@ -47,8 +47,9 @@ struct GrowthCurveFixture {
     frame0 = std::make_shared<MeasurementImageFrame>(img0);
     frame1 = std::make_shared<MeasurementImageFrame>(img1);
 
-    source.setIndexedProperty<MeasurementFrameImages>(0, frame0, 5, 5);
-    source.setIndexedProperty<MeasurementFrameImages>(1, frame1, 5, 5);
+    // The second stamp does not cover the whole curve, the rest is read from the frame
+    source.setIndexedProperty<MeasurementFrameCutout>(0, frame0, PixelCoordinate(0, 0), PixelCoordinate(4, 4));
+    source.setIndexedProperty<MeasurementFrameCutout>(1, frame1, PixelCoordinate(1, 1), PixelCoordinate(2, 2));
     source.setIndexedProperty<MeasurementFrameInfo>(0, 5, 5, 1, 65000, 1e6, 1);
     source.setIndexedProperty<MeasurementFrameInfo>(1, 5, 5, 1, 65000, 1e6, 1);
 
@@ -0,0 +1,69 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "SEImplementation/Property/PixelCoordinateList.h"
+
+using namespace SourceXtractor;
+
+BOOST_AUTO_TEST_SUITE (PixelCoordinateList_test)
+
+BOOST_AUTO_TEST_CASE( from_coordinates_test ) {
+  std::vector<PixelCoordinate> pixels{{1, 0}, {2, 0}, {3, 0}, {5, 0}, {0, 1}, {1, 1}, {7, 2}, {6, 2}};
+  PixelCoordinateList list(pixels);
+
+  BOOST_CHECK_EQUAL(list.size(), pixels.size());
+  BOOST_CHECK_EQUAL(list.getSpans().size(), 5);
+
+  // Iteration preserves the original order
+  std::vector<PixelCoordinate> iterated(list.begin(), list.end());
+  BOOST_CHECK(iterated == pixels);
+  BOOST_CHECK(list.getCoordinateList() == pixels);
+
+  // Copies share the same content
+  PixelCoordinateList copy(list);
+  BOOST_CHECK(copy.getCoordinateList() == pixels);
+}
+
+BOOST_AUTO_TEST_CASE( from_spans_test ) {
+  PixelCoordinateList list(std::vector<PixelSpan>{{4, 10, 13}, {5, 9, 10}});
+
+  BOOST_CHECK_EQUAL(list.size(), 4);
+
+  std::vector<PixelCoordinate> expected{{10, 4}, {11, 4}, {12, 4}, {9, 5}};
+  BOOST_CHECK(list.getCoordinateList() == expected);
+}
+
+BOOST_AUTO_TEST_CASE( contains_test ) {
+  PixelCoordinateList list(std::vector<PixelSpan>{{4, 10, 13}, {5, 9, 10}});
+
+  BOOST_CHECK(list.contains({10, 4}));
+  BOOST_CHECK(list.contains({12, 4}));
+  BOOST_CHECK(!list.contains({13, 4}));
+  BOOST_CHECK(list.contains({9, 5}));
+  BOOST_CHECK(!list.contains({9, 4}));
+}
+
+BOOST_AUTO_TEST_CASE( empty_test ) {
+  PixelCoordinateList list(std::vector<PixelCoordinate>{});
+
+  BOOST_CHECK_EQUAL(list.size(), 0);
+  BOOST_CHECK(list.begin() == list.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -16,6 +16,7 @@
  */
 #include "SEImplementation/Segmentation/BgConvolutionImageSource.h"
 #include "SEImplementation/Segmentation/BgDFTConvolutionImageSource.h"
+#include "SEImplementation/Segmentation/BackgroundConvolution.h"
 #include <boost/test/unit_test.hpp>
 #include <boost/mpl/list.hpp>
 #include <random>
@@ -173,4 +174,34 @@ BOOST_AUTO_TEST_CASE_TEMPLATE (kerneln_background, T, kernel_sizes) {
 
 //-----------------------------------------------------------------------------
 
+BOOST_AUTO_TEST_CASE (fused_image_and_variance) {
+  // The image and the variance are filtered at once, tiles ahead are filtered by the prefetch threads
+  auto image = generateImage(128);
+  auto variance = generateImage(128);
+  auto kernel = generateImage(9);
+
+  BackgroundConvolution filter(kernel, false, 2);
+  auto filtered = filter.processImageAndVariance(image, variance, 0.5);
+
+  auto direct_image = std::make_shared<BgConvolutionImageSource>(image, variance, 0.5, kernel);
+  auto direct_variance = std::make_shared<BgConvolutionImageSource>(variance, variance, 0.5, kernel);
+
+  for (int y = 0; y < 128; y += 32) {
+    for (int x = 0; x < 128; x += 64) {
+      auto image_chunk = filtered.first->getChunk(x, y, 64, 32);
+      auto variance_chunk = filtered.second->getChunk(x, y, 64, 32);
+
+      auto expected_image = std::dynamic_pointer_cast<ImageTileWithType<SeFloat>>(
+        direct_image->getImageTile(x, y, 64, 32))->getImage();
+      auto expected_variance = std::dynamic_pointer_cast<ImageTileWithType<SeFloat>>(
+        direct_variance->getImageTile(x, y, 64, 32))->getImage();
+
+      BOOST_CHECK(compareImages(expected_image, image_chunk, 1e-8, 1e-4));
+      BOOST_CHECK(compareImages(expected_variance, variance_chunk, 1e-8, 1e-4));
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE_END ()
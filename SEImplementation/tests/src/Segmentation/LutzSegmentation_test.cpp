@@ -22,6 +22,9 @@
 
 
 #include "SEImplementation/Segmentation/LutzSegmentation.h"
+#include "SEImplementation/Segmentation/BFSSegmentation.h"
+
+#include <algorithm>
 
 #include <boost/test/unit_test.hpp>
 
@@ -183,5 +186,81 @@ BOOST_FIXTURE_TEST_CASE( lutz_test, LutzFixture ) {
 
 //-----------------------------------------------------------------------------
 
+BOOST_FIXTURE_TEST_CASE( lutz_region_test, LutzFixture ) {
+  auto image = VectorImage<DetectionImage::PixelType>::create(10, 10);
+  image->setValue(1, 1, 1.);
+  image->setValue(5, 4, 1.);
+  image->setValue(6, 4, 1.);
+  image->setValue(8, 8, 1.);
+
+  Segmentation segmentation(nullptr);
+  segmentation.setLabelling<LutzSegmentation>(std::make_shared<SimpleSourceFactory>());
+  segmentation.setDetectionRegion(PixelRectangle(PixelCoordinate(3, 2), PixelCoordinate(7, 6)));
+  segmentation.Observable<SourceInterface>::addObserver(source_observer);
+
+  auto detection_frame = std::make_shared<DetectionImageFrame>(image);
+  detection_frame->setBackgroundLevel(ConstantImage<DetectionImage::PixelType>::create(10, 10, 0), 0.);
+  detection_frame->setVarianceMap(ConstantImage<DetectionImage::PixelType>::create(10, 10, 0.25));
+  segmentation.processFrame(detection_frame);
+
+  // Only the source inside the region, with coordinates relative to the full image
+  BOOST_REQUIRE_EQUAL(source_observer->m_list.size(), 1);
+  auto pixels = source_observer->m_list.front().getCoordinateList();
+  BOOST_REQUIRE_EQUAL(pixels.size(), 2);
+  BOOST_CHECK(pixels[0] == PixelCoordinate(5, 4));
+  BOOST_CHECK(pixels[1] == PixelCoordinate(6, 4));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( bfs_region_test ) {
+  // A source crossing the right border of the region, and another one only connected outside of it
+  auto image = VectorImage<DetectionImage::PixelType>::create(10, 10);
+  for (auto& pixel : {PixelCoordinate(5, 4), PixelCoordinate(6, 4), PixelCoordinate(7, 4), PixelCoordinate(8, 4),
+                      PixelCoordinate(8, 3), PixelCoordinate(3, 6), PixelCoordinate(3, 7), PixelCoordinate(4, 7),
+                      PixelCoordinate(5, 6)}) {
+    image->setValue(pixel, 1.);
+  }
+  auto detection_frame = std::make_shared<DetectionImageFrame>(image);
+  detection_frame->setBackgroundLevel(ConstantImage<DetectionImage::PixelType>::create(10, 10, 0), 0.);
+  detection_frame->setVarianceMap(ConstantImage<DetectionImage::PixelType>::create(10, 10, 0.25));
+
+  // Both labellings cut the sources at the border of the region
+  std::vector<std::vector<PixelCoordinate>> expected {
+    {PixelCoordinate(5, 4), PixelCoordinate(6, 4), PixelCoordinate(7, 4)},
+    {PixelCoordinate(3, 6)},
+    {PixelCoordinate(5, 6)}
+  };
+  for (bool bfs : {false, true}) {
+    auto source_observer = std::make_shared<SourceObserver>();
+    Segmentation segmentation(nullptr);
+    if (bfs) {
+      segmentation.setLabelling<BFSSegmentation>(std::make_shared<SimpleSourceFactory>(), 100);
+    }
+    else {
+      segmentation.setLabelling<LutzSegmentation>(std::make_shared<SimpleSourceFactory>());
+    }
+    segmentation.setDetectionRegion(PixelRectangle(PixelCoordinate(3, 2), PixelCoordinate(7, 6)));
+    segmentation.Observable<SourceInterface>::addObserver(source_observer);
+    segmentation.processFrame(detection_frame);
+
+    std::vector<std::vector<PixelCoordinate>> sources;
+    for (auto& source : source_observer->m_list) {
+      auto pixels = source.getCoordinateList();
+      std::sort(pixels.begin(), pixels.end(), [](const PixelCoordinate& a, const PixelCoordinate& b) {
+        return a.m_y < b.m_y || (a.m_y == b.m_y && a.m_x < b.m_x);
+      });
+      sources.emplace_back(pixels);
+    }
+    std::sort(sources.begin(), sources.end(), [](const std::vector<PixelCoordinate>& a,
+                                                 const std::vector<PixelCoordinate>& b) {
+      return a.front().m_y < b.front().m_y || (a.front().m_y == b.front().m_y && a.front().m_x < b.front().m_x);
+    });
+    BOOST_CHECK(sources == expected);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 BOOST_AUTO_TEST_SUITE_END ()
 
@@ -0,0 +1,65 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointFilter.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEMAIN_CHECKPOINTFILTER_H_
+#define _SEMAIN_CHECKPOINTFILTER_H_
+
+#include <functional>
+
+#include "SEFramework/Pipeline/PipelineStage.h"
+#include "SEFramework/Source/SourceGroupInterface.h"
+#include "SEImplementation/Output/CheckpointOutput.h"
+
+namespace SourceXtractor {
+
+/**
+ * @class CheckpointFilter
+ * @brief Drops the groups already measured by an interrupted run, before they reach the measurement
+ *
+ * @details
+ *  Their rows are restored by the CheckpointOutput instead. The skip callback lets the following
+ *  stages account for the groups that will never arrive (i.e. the Sorter).
+ */
+class CheckpointFilter : public PipelineReceiver<SourceGroupInterface>, public PipelineEmitter<SourceGroupInterface> {
+public:
+  using SkipCallback = std::function<void(const SourceGroupInterface&)>;
+
+  CheckpointFilter(std::shared_ptr<CheckpointOutput> checkpoint, SkipCallback on_skip);
+
+  virtual ~CheckpointFilter() = default;
+
+  void receiveSource(std::unique_ptr<SourceGroupInterface> source_group) override;
+  void receiveProcessSignal(const ProcessSourcesEvent& event) override;
+
+  size_t getSkippedCount() const {
+    return m_skipped;
+  }
+
+private:
+  std::shared_ptr<CheckpointOutput> m_checkpoint;
+  SkipCallback m_on_skip;
+  size_t m_skipped;
+};
+
+} // end SourceXtractor
+
+#endif // _SEMAIN_CHECKPOINTFILTER_H_
@@ -26,6 +26,7 @@
 
 #include "SEFramework/Source/SourceGroupInterface.h"
 #include "SEFramework/Pipeline/Segmentation.h"
+#include "SEFramework/Pipeline/Measurement.h"
 #include "SEUtils/Observable.h"
 #include <atomic>
 #include <mutex>
@@ -53,6 +54,7 @@ public:
   typedef Observer<SegmentationProgress> segmentation_observer_t;
   typedef Observer<SourceInterface>      source_observer_t;
   typedef Observer<SourceGroupInterface> group_observer_t;
+  typedef Observer<MeasurementQueueProgress> queue_observer_t;
 
   ~ProgressMediator() = default;
 
@@ -81,6 +83,11 @@ public:
    */
   std::shared_ptr<group_observer_t>& getMeasurementObserver(void);
 
+  /**
+   * @return An observer for the memory used by the measurement queue.
+   */
+  std::shared_ptr<queue_observer_t>& getMeasurementQueueObserver(void);
+
   /**
    * Notify that the process is completely done
    */
@@ -94,10 +101,14 @@ public:
 private:
   SegmentationProgress m_segmentation_progress;
   std::atomic_int m_detected, m_deblended, m_measured;
+  // Memory used by the measurement queue, in MiB. Only reported once the observer has been notified.
+  std::atomic_int m_queue_memory, m_queue_memory_limit;
+  std::atomic_bool m_queue_reported;
 
   std::shared_ptr<segmentation_observer_t> m_segmentation_listener;
   std::shared_ptr<source_observer_t> m_detection_listener;
   std::shared_ptr<group_observer_t> m_deblending_listener, m_measurement_listener;
+  std::shared_ptr<queue_observer_t> m_queue_listener;
 
   // Mediator serializes the notifications, so the observers do not need to worry about
   // being called from multiple threads
@@ -107,6 +118,7 @@ private:
   class ProgressCounter;
   class SourceCounter;
   class GroupCounter;
+  class QueueMemory;
 };
 
 } // end SourceXtractor
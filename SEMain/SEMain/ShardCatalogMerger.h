@@ -0,0 +1,44 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ShardCatalogMerger.h
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#ifndef _SEMAIN_SHARDCATALOGMERGER_H_
+#define _SEMAIN_SHARDCATALOGMERGER_H_
+
+#include <vector>
+
+#include "Table/Row.h"
+#include "Table/Table.h"
+
+namespace SourceXtractor {
+
+/**
+ * Concatenate the shard catalogs following the shard order, and renumber the ids so they are unique.
+ * Sources keep their order within a shard, so the result is deterministic.
+ * A group crossing the border between two shards has been measured by both, and each written only the
+ * sources within its core. If the group stamp is part of the output, it is used to assign the same
+ * id to both halves.
+ */
+std::vector<Euclid::Table::Row> mergeShardCatalogs(const std::vector<Euclid::Table::Table>& catalogs);
+
+} // end SourceXtractor
+
+#endif // _SEMAIN_SHARDCATALOGMERGER_H_
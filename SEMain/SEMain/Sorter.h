@@ -27,6 +27,7 @@
 #include "SEFramework/Pipeline/PipelineStage.h"
 #include "SEFramework/Source/SourceGroupInterface.h"
 #include <map>
+#include <mutex>
 
 namespace SourceXtractor {
 
@@ -39,9 +40,16 @@ public:
   void receiveSource(std::unique_ptr<SourceGroupInterface> source) override;
   void receiveProcessSignal(const ProcessSourcesEvent& event) override;
 
+  /// Account for a group that will not be received, so the following ones are not held back
+  void skipSource(const SourceGroupInterface& source);
+
 private:
-  std::map<int, std::unique_ptr<SourceGroupInterface>> m_output_buffer;
+  /// A null group is a skipped one, and the size is needed to advance past it
+  std::map<int, std::pair<unsigned int, std::unique_ptr<SourceGroupInterface>>> m_output_buffer;
   int m_output_next;
+  std::mutex m_mutex;
+
+  void emitReady();
 };
 
 } // end SourceXtractor
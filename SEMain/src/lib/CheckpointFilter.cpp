@@ -0,0 +1,52 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * CheckpointFilter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "SEImplementation/Plugin/SourceIDs/SourceID.h"
+#include "SEMain/CheckpointFilter.h"
+
+namespace SourceXtractor {
+
+CheckpointFilter::CheckpointFilter(std::shared_ptr<CheckpointOutput> checkpoint, SkipCallback on_skip)
+  : m_checkpoint(std::move(checkpoint)), m_on_skip(std::move(on_skip)), m_skipped(0) {
+}
+
+void CheckpointFilter::receiveSource(std::unique_ptr<SourceGroupInterface> source_group) {
+  // Skipped groups must consume their SourceIDs too, so the rest are numbered as in the original run
+  for (auto& source : *source_group) {
+    source.getProperty<SourceID>();
+  }
+
+  if (m_checkpoint->isCompleted(*source_group)) {
+    ++m_skipped;
+    if (m_on_skip) {
+      m_on_skip(*source_group);
+    }
+    return;
+  }
+  sendSource(std::move(source_group));
+}
+
+void CheckpointFilter::receiveProcessSignal(const ProcessSourcesEvent& event) {
+  sendProcessSignal(event);
+}
+
+} // end SourceXtractor
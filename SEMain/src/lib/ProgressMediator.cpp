@@ -77,12 +77,30 @@ private:
   std::atomic_int& m_counter;
 };
 
+class ProgressMediator::QueueMemory : public Observer<MeasurementQueueProgress> {
+public:
+  explicit QueueMemory(ProgressMediator& progress_listener) : m_progress_listener(progress_listener) {}
+
+  void handleMessage(const MeasurementQueueProgress& progress) override {
+    m_progress_listener.m_queue_memory = static_cast<int>(progress.bytes / (1024 * 1024));
+    m_progress_listener.m_queue_memory_limit =
+      progress.max_bytes > 0 ? static_cast<int>(progress.max_bytes / (1024 * 1024)) : -1;
+    m_progress_listener.m_queue_reported = true;
+    m_progress_listener.update();
+  }
+
+private:
+  ProgressMediator& m_progress_listener;
+};
+
 ProgressMediator::ProgressMediator() :
   m_segmentation_progress{0, 0}, m_detected{0}, m_deblended{0}, m_measured{0},
+  m_queue_memory{0}, m_queue_memory_limit{-1}, m_queue_reported{false},
   m_segmentation_listener{std::make_shared<ProgressCounter>(*this, m_segmentation_progress, m_mutex)},
   m_detection_listener{std::make_shared<SourceCounter>(*this, m_detected)},
   m_deblending_listener{std::make_shared<GroupCounter>(*this, m_deblended)},
-  m_measurement_listener{std::make_shared<GroupCounter>(*this, m_measured)} {
+  m_measurement_listener{std::make_shared<GroupCounter>(*this, m_measured)},
+  m_queue_listener{std::make_shared<QueueMemory>(*this)} {
 }
 
 std::shared_ptr<ProgressMediator::segmentation_observer_t>& ProgressMediator::getSegmentationObserver() {
@@ -101,14 +119,22 @@ std::shared_ptr<ProgressMediator::group_observer_t>& ProgressMediator::getMeasur
   return m_measurement_listener;
 }
 
+std::shared_ptr<ProgressMediator::queue_observer_t>& ProgressMediator::getMeasurementQueueObserver() {
+  return m_queue_listener;
+}
+
 void ProgressMediator::update(void) {
   std::lock_guard<std::mutex> guard(m_mutex);
-  this->ProgressObservable::notifyObservers(std::list<ProgressInfo>{
+  std::list<ProgressInfo> info{
     {"Segmentation", m_segmentation_progress.position, m_segmentation_progress.total},
     {"Detected",     m_detected,                       -1},
     {"Deblended",    m_deblended,                      -1},
     {"Measured",     m_measured,                       m_deblended},
-  });
+  };
+  if (m_queue_reported) {
+    info.emplace_back("Queued (MiB)", m_queue_memory, m_queue_memory_limit);
+  }
+  this->ProgressObservable::notifyObservers(info);
 }
 
 void ProgressMediator::done() {
@@ -0,0 +1,107 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * ShardCatalogMerger.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "Table/CastVisitor.h"
+#include "SEMain/ShardCatalogMerger.h"
+
+using Euclid::Table::Row;
+
+namespace SourceXtractor {
+
+namespace {
+
+int64_t getId(const Row::cell_type& cell) {
+  return boost::apply_visitor(Euclid::Table::CastVisitor<int64_t>{}, cell);
+}
+
+/// Replace the value of an integer cell, keeping its type
+Row::cell_type renumber(const Row::cell_type& cell, int64_t id) {
+  if (cell.type() == typeid(int32_t)) {
+    return static_cast<int32_t>(id);
+  }
+  return id;
+}
+
+} // end anonymous namespace
+
+std::vector<Row> mergeShardCatalogs(const std::vector<Euclid::Table::Table>& catalogs) {
+  std::vector<Row> merged;
+  std::map<std::string, int64_t> group_ids;
+  int64_t source_id = 0, detection_id = 0;
+
+  for (size_t shard = 0; shard < catalogs.size(); ++shard) {
+    auto& catalog = catalogs[shard];
+    if (catalog.size() == 0) {
+      continue;
+    }
+
+    auto column_info = catalog.getColumnInfo();
+    auto source_col = column_info->find("source_id");
+    auto detection_col = column_info->find("detection_id");
+    auto group_col = column_info->find("group_id");
+    std::vector<std::unique_ptr<size_t>> stamp_cols;
+    for (auto& name : {"group_stamp_left", "group_stamp_top", "group_stamp_width", "group_stamp_height"}) {
+      stamp_cols.emplace_back(column_info->find(name));
+    }
+    bool has_stamp = std::all_of(stamp_cols.begin(), stamp_cols.end(), [](const std::unique_ptr<size_t>& c) {
+      return c != nullptr;
+    });
+
+    std::map<int64_t, int64_t> detection_ids;
+    for (auto& row : catalog) {
+      std::vector<Row::cell_type> cells(row.begin(), row.end());
+      if (source_col) {
+        cells[*source_col] = renumber(cells[*source_col], ++source_id);
+      }
+      if (detection_col) {
+        auto id = detection_ids.emplace(getId(cells[*detection_col]), detection_id + 1);
+        if (id.second) {
+          ++detection_id;
+        }
+        cells[*detection_col] = renumber(cells[*detection_col], id.first->second);
+      }
+      if (group_col) {
+        std::ostringstream key;
+        if (has_stamp) {
+          for (auto& col : stamp_cols) {
+            key << getId(cells[*col]) << ',';
+          }
+        }
+        else {
+          key << shard << ':' << getId(cells[*group_col]);
+        }
+        auto id = group_ids.emplace(key.str(), group_ids.size() + 1);
+        cells[*group_col] = renumber(cells[*group_col], id.first->second);
+      }
+      merged.emplace_back(cells, column_info);
+    }
+  }
+  return merged;
+}
+
+} // end SourceXtractor
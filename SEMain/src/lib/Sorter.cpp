@@ -29,21 +29,37 @@ static unsigned int extractSourceId(const SourceInterface &i) {
 Sorter::Sorter(): m_output_next{1} {
 }
 
+static unsigned int firstSourceId(const SourceGroupInterface& group) {
+  std::vector<unsigned int> source_ids(group.size());
+  std::transform(group.cbegin(), group.cend(), source_ids.begin(), extractSourceId);
+  return *std::min_element(source_ids.begin(), source_ids.end());
+}
+
 void Sorter::receiveSource(std::unique_ptr<SourceGroupInterface> message) {
-  std::vector<unsigned int> source_ids(message->size());
-  std::transform(message->cbegin(), message->cend(), source_ids.begin(), extractSourceId);
-  std::sort(source_ids.begin(), source_ids.end());
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto first_source_id = firstSourceId(*message);
+  auto size = message->size();
+  m_output_buffer.emplace(first_source_id, std::make_pair(size, std::move(message)));
+  emitReady();
+}
 
-  auto first_source_id = source_ids.front();
-  m_output_buffer.emplace(first_source_id, std::move(message));
+void Sorter::skipSource(const SourceGroupInterface& source) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_output_buffer.emplace(firstSourceId(source), std::make_pair(source.size(), nullptr));
+  emitReady();
+}
 
+void Sorter::emitReady() {
   while (!m_output_buffer.empty() && m_output_buffer.begin()->first == m_output_next) {
     auto &next_group = m_output_buffer.begin()->second;
-    m_output_next += next_group->size();
-    sendSource(std::move(next_group));
+    m_output_next += next_group.first;
+    if (next_group.second) {
+      sendSource(std::move(next_group.second));
+    }
     m_output_buffer.erase(m_output_buffer.begin());
   }
 }
+
 void Sorter::receiveProcessSignal(const ProcessSourcesEvent& event) {
   sendProcessSignal(event);
 }
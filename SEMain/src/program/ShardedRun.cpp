@@ -0,0 +1,295 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file src/program/ShardedRun.cpp
+ * @date 10/19/26
+ */
+
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+
+#include <ElementsKernel/Exception.h>
+#include <ElementsKernel/Logging.h>
+#include <ElementsKernel/Program.h>
+#include <ElementsKernel/Main.h>
+#include <AlexandriaKernel/StringUtils.h>
+
+#include "Table/AsciiReader.h"
+#include "Table/AsciiWriter.h"
+#include "Table/FitsReader.h"
+#include "Table/FitsWriter.h"
+
+#include "SEFramework/FITS/FitsImageSource.h"
+#include "SEMain/ShardCatalogMerger.h"
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+using namespace Euclid;
+using Euclid::Table::Row;
+
+static Elements::Logging logger = Elements::Logging::getLogger("ShardedRun");
+
+/**
+ * A rectangular region of the detection image, processed by its own sourcextractor++ process
+ */
+struct Shard {
+  int m_x, m_y, m_width, m_height;
+
+  std::string getRegion() const {
+    std::ostringstream region;
+    region << m_x << ',' << m_y << ',' << m_width << ',' << m_height;
+    return region.str();
+  }
+};
+
+/**
+ * @class ShardedRun
+ * Split the detection image into shards, run one sourcextractor++ process per shard on the local machine,
+ * and merge the resulting catalogs.
+ *
+ * Each process detects sources on its shard plus a margin, and only writes those with the centroid inside the
+ * shard, so there are no duplicates. Source, detection and group ids are renumbered following the shard order.
+ *
+ * To spread the shards over several nodes, --print-commands gives one command line per shard, and
+ * --merge-only merges the catalogs once they are all done.
+ */
+class ShardedRun : public Elements::Program {
+private:
+  std::string m_sourcextractor;
+  std::vector<std::string> m_extra_args;
+  std::string m_detection_image, m_output_format;
+  fs::path m_work_dir;
+  int m_margin;
+
+  static std::vector<Shard> splitImage(int width, int height, int nx, int ny) {
+    std::vector<Shard> shards;
+    for (int j = 0; j < ny; ++j) {
+      int y0 = j * height / ny, y1 = (j + 1) * height / ny;
+      for (int i = 0; i < nx; ++i) {
+        int x0 = i * width / nx, x1 = (i + 1) * width / nx;
+        shards.emplace_back(Shard{x0, y0, x1 - x0, y1 - y0});
+      }
+    }
+    return shards;
+  }
+
+  fs::path getShardCatalog(size_t index) const {
+    auto extension = (m_output_format == "ASCII") ? ".txt" : ".fits";
+    return m_work_dir / ("shard_" + std::to_string(index) + extension);
+  }
+
+  std::vector<std::string> getShardCommand(const Shard& shard, size_t index) const {
+    std::vector<std::string> cmd{
+      m_sourcextractor,
+      "--detection-image", m_detection_image,
+      "--shard-region", shard.getRegion(),
+      "--shard-margin", std::to_string(m_margin),
+      "--output-catalog-filename", getShardCatalog(index).native(),
+      "--output-catalog-format", m_output_format,
+      "--log-file", (m_work_dir / ("shard_" + std::to_string(index) + ".log")).native()
+    };
+    cmd.insert(cmd.end(), m_extra_args.begin(), m_extra_args.end());
+    return cmd;
+  }
+
+  /// Spawn a process, with stdout and stderr redirected to log_path
+  static pid_t spawnProcess(const std::vector<std::string>& cmd, const fs::path& log_path) {
+    logger.debug() << boost::algorithm::join(cmd, " ");
+
+    std::vector<char*> argv;
+    for (auto& arg : cmd) {
+      argv.emplace_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.emplace_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+      throw Elements::Exception() << "Could not fork: " << std::strerror(errno);
+    }
+    if (pid == 0) {
+      int fd = open(log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd >= 0) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+      }
+      execvp(argv[0], argv.data());
+      _exit(127);
+    }
+    return pid;
+  }
+
+  /// Run all the shards, with at most `jobs` processes at the same time
+  void runShards(const std::vector<Shard>& shards, int jobs) const {
+    std::map<pid_t, size_t> running;
+    std::vector<size_t> failed;
+    size_t next = 0;
+
+    while (next < shards.size() || !running.empty()) {
+      while (next < shards.size() && running.size() < static_cast<size_t>(jobs)) {
+        auto log_path = m_work_dir / ("shard_" + std::to_string(next) + ".out");
+        running[spawnProcess(getShardCommand(shards[next], next), log_path)] = next;
+        logger.info() << "Started shard " << next << " (" << shards[next].getRegion() << ")";
+        ++next;
+      }
+
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, 0);
+      if (pid < 0) {
+        throw Elements::Exception() << "Could not wait for the shards: " << std::strerror(errno);
+      }
+      auto i = running.find(pid);
+      if (i == running.end()) {
+        continue;
+      }
+      if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        logger.error() << "Shard " << i->second << " failed, see " << (m_work_dir / ("shard_" + std::to_string(i->second) + ".out")).native();
+        failed.emplace_back(i->second);
+      }
+      else {
+        logger.info() << "Shard " << i->second << " done";
+      }
+      running.erase(i);
+    }
+
+    if (!failed.empty()) {
+      throw Elements::Exception() << failed.size() << " shard(s) failed";
+    }
+  }
+
+  static Table::Table readCatalog(const fs::path& path) {
+    try {
+      return Table::FitsReader(path.native()).read();
+    }
+    catch (...) {
+      return Table::AsciiReader(path.native()).read();
+    }
+  }
+
+  void writeCatalog(const std::string& path, const std::vector<Row>& rows) const {
+    if (rows.empty()) {
+      logger.warn() << "No sources detected, " << path << " not written";
+      return;
+    }
+    Table::Table table{rows};
+    if (m_output_format == "ASCII") {
+      Table::AsciiWriter(path, true).addData(table);
+    }
+    else {
+      Table::FitsWriter writer(path, true);
+      writer.setHduName("CATALOG");
+      writer.addData(table);
+    }
+  }
+
+public:
+
+  po::options_description defineSpecificProgramOptions() override {
+    po::options_description options{};
+    options.add_options()
+      ("detection-image", po::value<std::string>()->required(), "Detection image, split into shards")
+      ("output-catalog-filename", po::value<std::string>()->default_value(""), "Merged catalog")
+      ("output-catalog-format", po::value<std::string>()->default_value("FITS"), "Catalog format: ASCII or FITS")
+      ("shards", po::value<std::string>()->default_value("2,2"), "Number of shards along X and Y")
+      ("shard-margin", po::value<int>()->default_value(64),
+        "Pixels processed around each shard. Must be larger than the biggest expected source")
+      ("jobs", po::value<int>()->default_value(0), "Shards run at the same time (0 for all of them)")
+      ("work-area", po::value<std::string>()->default_value("."), "Directory for the shard catalogs and logs")
+      ("sourcextractor", po::value<std::string>()->default_value("sourcextractor++"), "sourcextractor++ executable")
+      ("sourcextractor-args", po::value<std::string>()->default_value(""),
+        "Additional arguments for every shard (i.e. --config-file, --python-config-file, --thread-count)")
+      ("print-commands", po::bool_switch(), "Print the command for each shard and exit, to run them elsewhere")
+      ("merge-only", po::bool_switch(), "Do not run the shards, only merge their catalogs");
+    return options;
+  }
+
+  Elements::ExitCode mainMethod(std::map<std::string, po::variable_value>& args) override {
+    m_sourcextractor = args.at("sourcextractor").as<std::string>();
+    auto extra_args = boost::trim_copy(args.at("sourcextractor-args").as<std::string>());
+    if (!extra_args.empty()) {
+      boost::split(m_extra_args, extra_args, boost::is_space(), boost::token_compress_on);
+    }
+    m_detection_image = args.at("detection-image").as<std::string>();
+    m_output_format = boost::to_upper_copy(args.at("output-catalog-format").as<std::string>());
+    if (m_output_format != "ASCII" && m_output_format != "FITS") {
+      throw Elements::Exception() << "Unsupported catalog format: " << m_output_format;
+    }
+    m_work_dir = args.at("work-area").as<std::string>();
+    m_margin = args.at("shard-margin").as<int>();
+    fs::create_directories(m_work_dir);
+
+    auto nshards = stringToVector<int>(args.at("shards").as<std::string>());
+    if (nshards.empty() || nshards.size() > 2 || nshards.front() <= 0 || nshards.back() <= 0) {
+      throw Elements::Exception() << "Invalid number of shards: " << args.at("shards").as<std::string>();
+    }
+
+    SourceXtractor::FitsImageSource image_source(m_detection_image);
+    auto shards = splitImage(image_source.getWidth(), image_source.getHeight(), nshards.front(), nshards.back());
+
+    if (args.at("print-commands").as<bool>()) {
+      for (size_t i = 0; i < shards.size(); ++i) {
+        std::cout << boost::algorithm::join(getShardCommand(shards[i], i), " ") << std::endl;
+      }
+      return Elements::ExitCode::OK;
+    }
+
+    if (!args.at("merge-only").as<bool>()) {
+      int jobs = args.at("jobs").as<int>();
+      runShards(shards, jobs > 0 ? jobs : static_cast<int>(shards.size()));
+    }
+
+    std::vector<Table::Table> catalogs;
+    for (size_t i = 0; i < shards.size(); ++i) {
+      auto path = getShardCatalog(i);
+      if (!fs::exists(path)) {
+        // A shard without any source does not write a catalog
+        logger.warn() << "Missing catalog for shard " << i << ": " << path.native();
+        continue;
+      }
+      catalogs.emplace_back(readCatalog(path));
+    }
+
+    auto merged = SourceXtractor::mergeShardCatalogs(catalogs);
+    logger.info() << merged.size() << " sources in " << shards.size() << " shards";
+
+    auto output = args.at("output-catalog-filename").as<std::string>();
+    if (output.empty()) {
+      if (!merged.empty()) {
+        Table::AsciiWriter(std::cout).addData(Table::Table{merged});
+      }
+    }
+    else {
+      writeCatalog(output, merged);
+      logger.info() << "Catalog written into " << output;
+    }
+    return Elements::ExitCode::OK;
+  }
+};
+
+MAIN_FOR(ShardedRun)
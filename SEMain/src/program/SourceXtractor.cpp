@@ -61,9 +61,12 @@
 #include "SEImplementation/Configuration/MultiThreadingConfig.h"
 #include "SEImplementation/Segmentation/SegmentationFactory.h"
 #include "SEImplementation/Output/OutputFactory.h"
+#include "SEImplementation/Output/CheckpointOutput.h"
 #include "SEImplementation/Grouping/GroupingFactory.h"
 #include "SEImplementation/Plugin/PixelCentroid/PixelCentroid.h"
 #include "SEImplementation/Partition/PartitionFactory.h"
+#include "SEImplementation/Partition/ParallelPartition.h"
+#include "SEImplementation/Deblending/ParallelDeblending.h"
 #include "SEImplementation/Deblending/DeblendingFactory.h"
 #include "SEImplementation/Measurement/MeasurementFactory.h"
 #include "SEImplementation/Configuration/DetectionImageConfig.h"
@@ -72,11 +75,14 @@
 #include "SEImplementation/Configuration/SE2BackgroundConfig.h"
 #include "SEImplementation/Configuration/WeightImageConfig.h"
 #include "SEImplementation/Configuration/MemoryConfig.h"
+#include "SEImplementation/Configuration/FFTConfig.h"
+#include "SEImplementation/Configuration/ProfilerConfig.h"
 #include "SEImplementation/Configuration/OutputConfig.h"
 #include "SEImplementation/Configuration/SamplingConfig.h"
 #include "SEImplementation/CheckImages/CheckImages.h"
 #include "SEImplementation/Prefetcher/Prefetcher.h"
 
+#include "SEMain/CheckpointFilter.h"
 #include "SEMain/ProgressReporterFactory.h"
 #include "SEMain/PluginConfig.h"
 #include "SEMain/Sorter.h"
@@ -166,7 +172,7 @@ class SEMain : public Elements::Program {
   PartitionFactory partition_factory {source_factory};
   GroupingFactory grouping_factory {group_factory};
   DeblendingFactory deblending_factory {source_factory};
-  MeasurementFactory measurement_factory { output_registry };
+  MeasurementFactory measurement_factory { output_registry, task_provider };
   ProgressReporterFactory progress_printer_factory {};
 
   bool config_initialized = false;
@@ -191,6 +197,8 @@ public:
       config_manager.registerConfiguration<BackgroundAnalyzerFactory>();
       config_manager.registerConfiguration<SamplingConfig>();
       config_manager.registerConfiguration<DetectionFrameConfig>();
+      config_manager.registerConfiguration<ProfilerConfig>();
+      config_manager.registerConfiguration<FFTConfig>();
 
       CheckImages::getInstance().reportConfigDependencies(config_manager);
 
@@ -364,9 +372,15 @@ public:
     std::shared_ptr<Measurement> measurement = measurement_factory.getMeasurement();
     std::shared_ptr<Output> output = output_factory.createOutput();
 
-    // Prefetcher
+    // Partition, prefetcher and deblending run on the thread pool, when available
+    std::shared_ptr<ParallelPartition> parallel_partition;
+    std::shared_ptr<ParallelDeblending> parallel_deblending;
     std::shared_ptr<Prefetcher> prefetcher;
     if (thread_pool) {
+      parallel_partition = std::make_shared<ParallelPartition>(partition, thread_pool,
+                                                               multithreading_config.getMaxQueueSize());
+      parallel_deblending = std::make_shared<ParallelDeblending>(deblending, thread_pool,
+                                                                 multithreading_config.getMaxQueueSize());
       auto prefetch = source_grouping->requiredProperties();
       auto deblending_prefetch =  deblending->requiredProperties();
       prefetch.insert(deblending_prefetch.begin(), deblending_prefetch.end());
@@ -377,33 +391,65 @@ public:
     }
 
     // Link together the pipeline's steps
-    segmentation->setNextStage(partition);
+    std::shared_ptr<PipelineEmitter<SourceInterface>> partition_stage;
+    if (parallel_partition) {
+      segmentation->setNextStage(parallel_partition);
+      partition_stage = parallel_partition;
+    }
+    else {
+      segmentation->setNextStage(partition);
+      partition_stage = partition;
+    }
 
     if (prefetcher) {
-      partition->setNextStage(prefetcher);
+      partition_stage->setNextStage(prefetcher);
       prefetcher->setNextStage(source_grouping);
     }
     else {
-      partition->setNextStage(source_grouping);
+      partition_stage->setNextStage(source_grouping);
     }
 
-    source_grouping->setNextStage(deblending);
-    deblending->setNextStage(measurement);
-
+    std::shared_ptr<PipelineEmitter<SourceGroupInterface>> deblending_stage;
+    if (parallel_deblending) {
+      source_grouping->setNextStage(parallel_deblending);
+      deblending_stage = parallel_deblending;
+    }
+    else {
+      source_grouping->setNextStage(deblending);
+      deblending_stage = deblending;
+    }
+    std::shared_ptr<Sorter> sorter;
     if (config_manager.getConfiguration<OutputConfig>().getOutputUnsorted()) {
       logger.info() << "Writing output following measure order";
       measurement->setNextStage(output);
     } else {
       logger.info() << "Writing output following segmentation order";
-      auto sorter = std::make_shared<Sorter>();
+      sorter = std::make_shared<Sorter>();
       measurement->setNextStage(sorter);
       sorter->setNextStage(output);
     }
 
+    // Groups restored from a checkpoint do not need to be measured again
+    std::shared_ptr<CheckpointFilter> checkpoint_filter;
+    auto checkpoint_output = std::dynamic_pointer_cast<CheckpointOutput>(output);
+    if (checkpoint_output && checkpoint_output->getRestoredGroupCount() > 0) {
+      CheckpointFilter::SkipCallback on_skip;
+      if (sorter) {
+        on_skip = [sorter](const SourceGroupInterface& group) { sorter->skipSource(group); };
+      }
+      checkpoint_filter = std::make_shared<CheckpointFilter>(checkpoint_output, on_skip);
+      deblending_stage->setNextStage(checkpoint_filter);
+      checkpoint_filter->setNextStage(measurement);
+    }
+    else {
+      deblending_stage->setNextStage(measurement);
+    }
+
     segmentation->Observable<SegmentationProgress>::addObserver(progress_mediator->getSegmentationObserver());
     segmentation->Observable<SourceInterface>::addObserver(progress_mediator->getDetectionObserver());
-    deblending->Observable<SourceGroupInterface>::addObserver(progress_mediator->getDeblendingObserver());
+    deblending_stage->addObserver(progress_mediator->getDeblendingObserver());
     measurement->Observable<SourceGroupInterface>::addObserver(progress_mediator->getMeasurementObserver());
+    measurement->Observable<MeasurementQueueProgress>::addObserver(progress_mediator->getMeasurementQueueObserver());
 
     // Add observers for CheckImages
     if (CheckImages::getInstance().getSegmentationImage(0) != nullptr) {
@@ -440,9 +486,15 @@ public:
           return Elements::ExitCode::NOT_OK;
         }
 
+        if (parallel_partition) {
+          parallel_partition->synchronize();
+        }
         if (prefetcher) {
           prefetcher->synchronize();
         }
+        if (parallel_deblending) {
+          parallel_deblending->synchronize();
+        }
         measurement->synchronizeThreads();
 
         size_t nb_writen_rows = output->flush();
@@ -473,9 +525,15 @@ public:
         return Elements::ExitCode::NOT_OK;
       }
 
+      if (parallel_partition) {
+        parallel_partition->synchronize();
+      }
       if (prefetcher) {
         prefetcher->synchronize();
       }
+      if (parallel_deblending) {
+        parallel_deblending->synchronize();
+      }
       measurement->synchronizeThreads();
 
       size_t nb_writen_rows = output->flush();
@@ -486,9 +544,15 @@ public:
       prev_writen_rows = nb_writen_rows;
     }
 
+    if (parallel_partition) {
+      parallel_partition->wait();
+    }
     if (prefetcher) {
       prefetcher->wait();
     }
+    if (parallel_deblending) {
+      parallel_deblending->wait();
+    }
     measurement->stopThreads();
 
     // Those check images can only be added AFTER the processing of the detection frames
@@ -501,6 +565,12 @@ public:
     CheckImages::getInstance().saveImages();
     TileManager::getInstance()->flush();
     progress_mediator->done();
+    config_manager.getConfiguration<ProfilerConfig>().writeProfile();
+    config_manager.getConfiguration<FFTConfig>().saveWisdom();
+
+    if (checkpoint_filter) {
+      logger.info() << checkpoint_filter->getSkippedCount() << " groups restored from the checkpoint";
+    }
 
     if (prev_writen_rows > 0) {
       logger.info() << "total " << prev_writen_rows << " sources detected";
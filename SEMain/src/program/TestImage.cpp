@@ -198,6 +198,7 @@ public:
         ("max-tile-memory", po::value<int>()->default_value(512), "Maximum memory used for image tiles cache in megabytes")
         ("tile-size", po::value<int>()->default_value(256), "Image tiles size in pixels")
         ("copy-coordinate-system", po::value<string>()->default_value(""), "Copy the coordinate system from another FITS file")
+        ("seed", po::value<unsigned int>()->default_value(0), "Seed for the random generator, 0 to use the current time")
         ;
 
     return config_options;
@@ -485,6 +486,11 @@ public:
   Elements::ExitCode mainMethod(std::map<std::string, po::variable_value>& args) override {
     Elements::Logging logger = Elements::Logging::getLogger("TestImage");
 
+    auto seed = args["seed"].as<unsigned int>();
+    if (seed != 0) {
+      m_rng.seed(seed);
+    }
+
     auto max_tile_memory = args["max-tile-memory"].as<int>();
     auto tile_size = args["tile-size"].as<int>();
     TileManager::getInstance()->setOptions(tile_size, tile_size, max_tile_memory);
@@ -0,0 +1,151 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/ShardCatalogMerger_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "SEMain/ShardCatalogMerger.h"
+
+using namespace SourceXtractor;
+using Euclid::Table::Row;
+using Euclid::Table::Table;
+
+namespace {
+
+const std::vector<std::string> columns {
+  "source_id", "detection_id", "group_id",
+  "group_stamp_left", "group_stamp_top", "group_stamp_width", "group_stamp_height", "flux"
+};
+
+/// A catalog with the given columns, and one row per source as {source, detection, group, stamp..., flux}
+Table createCatalog(const std::vector<std::string>& names, const std::vector<std::vector<int>>& sources) {
+  std::vector<Euclid::Table::ColumnInfo::info_type> info;
+  for (auto& name : names) {
+    info.emplace_back(name, name == "source_id" ? typeid(int32_t) : typeid(int64_t));
+  }
+  auto column_info = std::make_shared<Euclid::Table::ColumnInfo>(info);
+
+  std::vector<Row> rows;
+  for (auto& source : sources) {
+    std::vector<Row::cell_type> cells;
+    for (size_t i = 0; i < names.size(); ++i) {
+      if (names[i] == "source_id") {
+        cells.emplace_back(static_cast<int32_t>(source[i]));
+      }
+      else {
+        cells.emplace_back(static_cast<int64_t>(source[i]));
+      }
+    }
+    rows.emplace_back(cells, column_info);
+  }
+  return Table(rows);
+}
+
+std::vector<int64_t> getColumn(const std::vector<Row>& rows, const std::string& name) {
+  std::vector<int64_t> values;
+  for (auto& row : rows) {
+    auto& cell = row[name];
+    if (cell.type() == typeid(int32_t)) {
+      values.emplace_back(boost::get<int32_t>(cell));
+    }
+    else {
+      values.emplace_back(boost::get<int64_t>(cell));
+    }
+  }
+  return values;
+}
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE (ShardCatalogMerger_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( straddling_group_test ) {
+  // The core of the first shard ends at x = 49. The group with the stamp at x = 45 crosses into the second shard,
+  // which wrote the sources of that group within its own core.
+  std::vector<Table> catalogs {
+    createCatalog(columns, {
+      {1, 1, 1, 10, 10, 5, 5, 100},
+      {2, 2, 2, 45, 20, 12, 6, 200},
+    }),
+    createCatalog(columns, {
+      {1, 1, 1, 45, 20, 12, 6, 300},
+      {2, 2, 2, 70, 30, 4, 4, 400},
+      {3, 3, 2, 70, 30, 4, 4, 500},
+    }),
+  };
+
+  auto merged = mergeShardCatalogs(catalogs);
+  BOOST_REQUIRE_EQUAL(merged.size(), 5);
+  BOOST_CHECK(getColumn(merged, "source_id") == std::vector<int64_t>({1, 2, 3, 4, 5}));
+  BOOST_CHECK(getColumn(merged, "detection_id") == std::vector<int64_t>({1, 2, 3, 4, 5}));
+  // Both halves of the straddling group share the same id
+  BOOST_CHECK(getColumn(merged, "group_id") == std::vector<int64_t>({1, 2, 2, 3, 3}));
+  BOOST_CHECK(getColumn(merged, "flux") == std::vector<int64_t>({100, 200, 300, 400, 500}));
+  BOOST_CHECK(getColumn(merged, "group_stamp_left") == std::vector<int64_t>({10, 45, 45, 70, 70}));
+
+  // The type of the id columns is kept
+  BOOST_CHECK(merged[2]["source_id"].type() == typeid(int32_t));
+  BOOST_CHECK(merged[2]["group_id"].type() == typeid(int64_t));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( shared_detection_test ) {
+  // Several rows for the same detection (i.e. multiple measurement frames) keep sharing its id
+  std::vector<Table> catalogs {
+    createCatalog(columns, {
+      {1, 5, 1, 10, 10, 5, 5, 100},
+      {2, 5, 1, 10, 10, 5, 5, 200},
+    }),
+    createCatalog(columns, {
+      {1, 5, 1, 60, 10, 5, 5, 300},
+    }),
+  };
+
+  auto merged = mergeShardCatalogs(catalogs);
+  BOOST_REQUIRE_EQUAL(merged.size(), 3);
+  BOOST_CHECK(getColumn(merged, "source_id") == std::vector<int64_t>({1, 2, 3}));
+  BOOST_CHECK(getColumn(merged, "detection_id") == std::vector<int64_t>({1, 1, 2}));
+  BOOST_CHECK(getColumn(merged, "group_id") == std::vector<int64_t>({1, 1, 2}));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( without_stamp_test ) {
+  // Without the group stamp, groups can not be matched across shards, and are kept apart
+  std::vector<std::string> names {"source_id", "detection_id", "group_id"};
+  std::vector<Table> catalogs {
+    createCatalog(names, {{1, 1, 1}, {2, 2, 1}}),
+    createCatalog(names, {{1, 1, 1}, {2, 2, 2}}),
+  };
+
+  auto merged = mergeShardCatalogs(catalogs);
+  BOOST_REQUIRE_EQUAL(merged.size(), 4);
+  BOOST_CHECK(getColumn(merged, "source_id") == std::vector<int64_t>({1, 2, 3, 4}));
+  BOOST_CHECK(getColumn(merged, "group_id") == std::vector<int64_t>({1, 1, 2, 3}));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END ()
@@ -0,0 +1,104 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+/**
+ * @file tests/src/Sorter_test.cpp
+ * @date 10/19/26
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "AlexandriaKernel/memory_tools.h"
+#include "SEFramework/Source/SimpleSource.h"
+#include "SEFramework/Source/SimpleSourceGroup.h"
+#include "SEImplementation/Plugin/SourceIDs/SourceID.h"
+#include "SEMain/Sorter.h"
+
+using namespace SourceXtractor;
+
+namespace {
+
+/// A group of sources with consecutive ids starting at first_id
+std::unique_ptr<SourceGroupInterface> createGroup(unsigned int first_id, unsigned int sources) {
+  auto group = Euclid::make_unique<SimpleSourceGroup>();
+  for (unsigned int i = 0; i < sources; ++i) {
+    auto source = Euclid::make_unique<SimpleSource>();
+    source->setProperty<SourceID>(first_id + i, first_id + i);
+    group->addSource(std::move(source));
+  }
+  return std::move(group);
+}
+
+class Collector : public PipelineReceiver<SourceGroupInterface> {
+public:
+  void receiveSource(std::unique_ptr<SourceGroupInterface> group) override {
+    m_received.emplace_back(group->cbegin()->getProperty<SourceID>().getId());
+  }
+
+  void receiveProcessSignal(const ProcessSourcesEvent&) override {
+  }
+
+  std::vector<unsigned int> m_received;
+};
+
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(Sorter_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(sort_test) {
+  auto sorter = std::make_shared<Sorter>();
+  auto collector = std::make_shared<Collector>();
+  sorter->setNextStage(collector);
+
+  sorter->receiveSource(createGroup(3, 1));
+  sorter->receiveSource(createGroup(4, 2));
+  BOOST_CHECK(collector->m_received.empty());
+  sorter->receiveSource(createGroup(1, 2));
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({1, 3, 4}));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(skip_test) {
+  auto sorter = std::make_shared<Sorter>();
+  auto collector = std::make_shared<Collector>();
+  sorter->setNextStage(collector);
+
+  // Groups 1-3 and 7 are skipped, 4-6 and 8 received out of order
+  sorter->receiveSource(createGroup(8, 1));
+  sorter->receiveSource(createGroup(4, 3));
+  BOOST_CHECK(collector->m_received.empty());
+
+  auto skipped = createGroup(1, 3);
+  sorter->skipSource(*skipped);
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({4}));
+
+  auto skipped_last = createGroup(7, 1);
+  sorter->skipSource(*skipped_last);
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({4, 8}));
+
+  // Following groups are released as soon as they arrive
+  sorter->receiveSource(createGroup(9, 1));
+  BOOST_CHECK(collector->m_received == std::vector<unsigned int>({4, 8, 9}));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
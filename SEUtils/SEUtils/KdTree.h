@@ -18,6 +18,7 @@
 #ifndef _SEUTILS_KDTREE_H_
 #define _SEUTILS_KDTREE_H_
 
+#include <cassert>
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -50,7 +51,19 @@ public:
   explicit KdTree(const std::vector<T>& data);
   std::vector<T> findPointsWithinRadius(Coord coord, double radius) const;
 
+  /**
+   * @return The element closest to coord. The tree must not be empty.
+   *    On a tie, the one that comes first in the data passed to the constructor.
+   */
+  T findNearest(Coord coord) const;
+
 private:
+  /// An element, and its position on the data passed to the constructor
+  struct Entry {
+    T m_value;
+    size_t m_order;
+  };
+
   class Node;
   class Leaf;
   class Split;
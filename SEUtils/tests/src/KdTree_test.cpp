@@ -0,0 +1,124 @@
+/** Copyright © 2026 Université de Genève, LMU Munich - Faculty of Physics, IAP-CNRS/Sorbonne Université
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+
+#include "SEUtils/KdTree.h"
+
+namespace SourceXtractor {
+
+struct KdTest {
+  double m_x, m_y;
+};
+
+template <>
+struct KdTreeTraits<KdTest> {
+  static double getCoord(const KdTest& t, size_t index) {
+    if (index == 0) {
+      return t.m_x;
+    } else {
+      return t.m_y;
+    }
+  }
+};
+
+struct KdIndexedTest {
+  double m_x, m_y;
+  int m_index;
+};
+
+template <>
+struct KdTreeTraits<KdIndexedTest> {
+  static double getCoord(const KdIndexedTest& t, size_t index) {
+    if (index == 0) {
+      return t.m_x;
+    } else {
+      return t.m_y;
+    }
+  }
+};
+
+BOOST_AUTO_TEST_SUITE (KdTree_test)
+
+BOOST_AUTO_TEST_CASE( within_radius_test ) {
+  KdTree<KdTest> tree({{1, 2}, {3, 4}, {5, 6}});
+
+  BOOST_CHECK_EQUAL(tree.findPointsWithinRadius({{0, 0}}, 100).size(), 3);
+  BOOST_CHECK_EQUAL(tree.findPointsWithinRadius({{3, 4}}, 1).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE( nearest_test ) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0., 1000.);
+
+  std::vector<KdTest> points(2000);
+  for (auto& p : points) {
+    p = {uniform(generator), uniform(generator)};
+  }
+
+  KdTree<KdTest, 2, 16> tree(points);
+
+  for (int i = 0; i < 200; ++i) {
+    double x = uniform(generator), y = uniform(generator);
+
+    auto brute = std::min_element(points.begin(), points.end(), [x, y](const KdTest& a, const KdTest& b) {
+      return (a.m_x - x) * (a.m_x - x) + (a.m_y - y) * (a.m_y - y) < (b.m_x - x) * (b.m_x - x) + (b.m_y - y) * (b.m_y - y);
+    });
+    auto nearest = tree.findNearest({{x, y}});
+
+    BOOST_CHECK_EQUAL(nearest.m_x, brute->m_x);
+    BOOST_CHECK_EQUAL(nearest.m_y, brute->m_y);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( nearest_tie_test ) {
+  std::mt19937 generator(42);
+
+  // A regular grid, in a shuffled order, so the query points at the center of each cell
+  // are at the same distance of four points that end up in different leaves
+  std::vector<KdIndexedTest> points;
+  for (int y = 0; y < 20; ++y) {
+    for (int x = 0; x < 20; ++x) {
+      points.push_back({double(x), double(y), 0});
+    }
+  }
+  std::shuffle(points.begin(), points.end(), generator);
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].m_index = i;
+  }
+
+  KdTree<KdIndexedTest, 2, 4> tree(points);
+
+  for (int y = 0; y < 19; ++y) {
+    for (int x = 0; x < 19; ++x) {
+      double qx = x + .5, qy = y + .5;
+      // min_element returns the first of the closest points, as a linear scan
+      auto brute = std::min_element(points.begin(), points.end(), [qx, qy](const KdIndexedTest& a, const KdIndexedTest& b) {
+        return (a.m_x - qx) * (a.m_x - qx) + (a.m_y - qy) * (a.m_y - qy) < (b.m_x - qx) * (b.m_x - qx) + (b.m_y - qy) * (b.m_y - qy);
+      });
+      auto nearest = tree.findNearest({{qx, qy}});
+
+      BOOST_CHECK_EQUAL(nearest.m_index, brute->m_index);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END ()
+
+}